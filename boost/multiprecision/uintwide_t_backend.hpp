@@ -424,11 +424,16 @@
   {
     using local_wide_integer_type = typename uintwide_t_backend<MyWidth2, MyLimbType, MyAllocatorType>::representation_type;
 
-    typename uintwide_t_backend<MyWidth2, MyLimbType, MyAllocatorType>::representation_type rem;
+    using local_limb_type = typename local_wide_integer_type::limb_type;
 
-    local_wide_integer_type(x.crepresentation()).eval_divide_by_single_limb(n, 0U, &rem);
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using local_limb_divisor_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::limb_divisor<local_limb_type>;
+    #else
+    using local_limb_divisor_type = ::math::wide_integer::limb_divisor<local_limb_type>;
+    #endif
 
-    return static_cast<IntegralType>(rem);
+    // Obtain the remainder from the reciprocal of n, without copying x.
+    return static_cast<IntegralType>(local_limb_divisor_type(static_cast<local_limb_type>(n)).remainder(x.crepresentation()));
   }
 
   template<
@@ -554,6 +559,36 @@
     result.representation() = powm(b.crepresentation(), p.crepresentation(), m);
   }
 
+  template<
+  #if defined(WIDE_INTEGER_NAMESPACE)
+           const WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t MyWidth2,
+  #else
+           const ::math::wide_integer::size_t MyWidth2,
+  #endif
+           typename MyLimbType,
+           typename MyAllocatorType>
+  constexpr auto eval_gcd(      uintwide_t_backend<MyWidth2, MyLimbType, MyAllocatorType>& result,
+                          const uintwide_t_backend<MyWidth2, MyLimbType, MyAllocatorType>& a,
+                          const uintwide_t_backend<MyWidth2, MyLimbType, MyAllocatorType>& b) -> void
+  {
+    result.representation() = gcd(a.crepresentation(), b.crepresentation());
+  }
+
+  template<
+  #if defined(WIDE_INTEGER_NAMESPACE)
+           const WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t MyWidth2,
+  #else
+           const ::math::wide_integer::size_t MyWidth2,
+  #endif
+           typename MyLimbType,
+           typename MyAllocatorType>
+  constexpr auto eval_lcm(      uintwide_t_backend<MyWidth2, MyLimbType, MyAllocatorType>& result,
+                          const uintwide_t_backend<MyWidth2, MyLimbType, MyAllocatorType>& a,
+                          const uintwide_t_backend<MyWidth2, MyLimbType, MyAllocatorType>& b) -> void
+  {
+    result.representation() = lcm(a.crepresentation(), b.crepresentation());
+  }
+
   template<
   #if defined(WIDE_INTEGER_NAMESPACE)
            const WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t MyWidth2,
@@ -0,0 +1,240 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2018 - 2026.                 //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#include <examples/example_uintwide_t.h>
+#include <math/wide_integer/uintwide_t.h>
+#include <test/stopwatch.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace local_powm_ct_timing
+{
+  // This is a statistical timing test in the style of dudect
+  // (O. Reparaz, J. Balasch and I. Verbauwhede, "Dude, is my code
+  // constant time?", DATE 2017). Modular exponentiation is timed
+  // for two classes of exponents: a fixed, sparse exponent and
+  // random, dense exponents. The classes are randomly interleaved
+  // and the largest measurements are cropped. Welch's t-test then
+  // decides if the two timing distributions can be told apart.
+
+  constexpr std::uint32_t wide_integer_test5b_digits2 = static_cast<std::uint32_t>(UINT16_C(256));
+
+  constexpr std::size_t count_of_measurements = static_cast<std::size_t>(UINT16_C(4000));
+
+  // Drop the measurements above this percentile (of both classes
+  // together) since these are mostly disturbed by interrupts.
+  constexpr float crop_percentile = static_cast<float>(0.90L);
+
+  // A value of |t| above 4.5 is usually taken as evidence of a timing
+  // leak. The limit here is much looser, because the test needs to pass
+  // reliably on a busy build machine. It is still far below the values
+  // reached by the non-constant-time powm. The limit is only checked
+  // in the standalone example. When called from the unit tests,
+  // the t statistics are reported but do not decide the result,
+  // since wall-clock timings are not reproducible there.
+  constexpr float t_limit = static_cast<float>(10.0L);
+
+  // Use a fixed seed, so that the modulus and the exponents
+  // are the same in each run.
+  constexpr std::uint32_t rng_seed = static_cast<std::uint32_t>(UINT32_C(0x5EED005B));
+
+  #if defined(WIDE_INTEGER_NAMESPACE)
+  using local_limb_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uint_defaultlimb_t;
+  #else
+  using local_limb_type = ::math::wide_integer::uint_defaultlimb_t;
+  #endif
+
+  #if defined(WIDE_INTEGER_NAMESPACE)
+  using big_uint_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<wide_integer_test5b_digits2, local_limb_type, void, false>;
+  #else
+  using big_uint_type = ::math::wide_integer::uintwide_t<wide_integer_test5b_digits2, local_limb_type, void, false>;
+  #endif
+
+  #if defined(WIDE_INTEGER_NAMESPACE)
+  using distribution_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uniform_int_distribution<wide_integer_test5b_digits2, local_limb_type, void, false>;
+  #else
+  using distribution_type = ::math::wide_integer::uniform_int_distribution<wide_integer_test5b_digits2, local_limb_type, void, false>;
+  #endif
+
+  using random_engine_type =
+    std::linear_congruential_engine<std::uint32_t, UINT32_C(48271), UINT32_C(0), UINT32_C(2147483647)>;
+
+  using sample_array_type = std::array<std::vector<double>, static_cast<std::size_t>(UINT8_C(2))>;
+
+  auto welch_t(const sample_array_type& samples) -> float
+  {
+    // Crop both classes at the same threshold, then calculate
+    // Welch's t statistic for the remaining samples.
+
+    std::vector<double> all_samples(samples[0U]);
+
+    all_samples.insert(all_samples.end(), samples[1U].cbegin(), samples[1U].cend());
+
+    const auto crop_index = static_cast<std::size_t>(static_cast<float>(all_samples.size()) * crop_percentile);
+
+    std::nth_element(all_samples.begin(),
+                     all_samples.begin() + static_cast<std::ptrdiff_t>(crop_index),
+                     all_samples.end());
+
+    const double threshold { all_samples[crop_index] };
+
+    std::array<double, static_cast<std::size_t>(UINT8_C(2))> mean     { };
+    std::array<double, static_cast<std::size_t>(UINT8_C(2))> variance { };
+    std::array<double, static_cast<std::size_t>(UINT8_C(2))> count    { };
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < samples.size(); ++i)
+    {
+      // Use Welford's method for the running mean and variance.
+      double m2 { 0.0 };
+
+      for(const auto& x : samples[i])
+      {
+        if(x <= threshold)
+        {
+          count[i] += 1.0;
+
+          const double delta { x - mean[i] };
+
+          mean[i] += delta / count[i];
+
+          m2 += delta * (x - mean[i]);
+        }
+      }
+
+      variance[i] = ((count[i] > 1.0) ? (m2 / (count[i] - 1.0)) : 0.0);
+    }
+
+    const double denominator { std::sqrt((variance[0U] / count[0U]) + (variance[1U] / count[1U])) };
+
+    return ((denominator > 0.0) ? static_cast<float>((mean[0U] - mean[1U]) / denominator) : 0.0F);
+  }
+
+  template<typename PowmFunctionType>
+  auto measure(random_engine_type& rng, const big_uint_type& m, PowmFunctionType powm_function, bool& result_is_ok) -> float
+  {
+    // Exponent class 0 is fixed and sparse, class 1 is random and dense.
+    const big_uint_type p_fixed { static_cast<std::uint8_t>(UINT8_C(3)) };
+
+    distribution_type distribution { };
+
+    sample_array_type samples { };
+
+    samples[0U].reserve(count_of_measurements);
+    samples[1U].reserve(count_of_measurements);
+
+    using stopwatch_type = concurrency::stopwatch;
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count_of_measurements; ++i)
+    {
+      const auto class_index = static_cast<std::size_t>(rng() & static_cast<std::uint32_t>(UINT8_C(1)));
+
+      const big_uint_type b { distribution(rng) % m };
+      const big_uint_type p { (class_index == static_cast<std::size_t>(UINT8_C(0))) ? p_fixed : distribution(rng) };
+
+      stopwatch_type my_stopwatch { };
+
+      const big_uint_type r { powm_function(b, p, m) };
+
+      const auto elapsed = stopwatch_type::elapsed_time<double>(my_stopwatch);
+
+      samples[class_index].push_back(elapsed);
+
+      // Check each result, which also keeps the calculation from being optimized away.
+      result_is_ok = ((r == powm(b, p, m)) && result_is_ok);
+    }
+
+    return welch_t(samples);
+  }
+} // namespace local_powm_ct_timing
+
+#if defined(WIDE_INTEGER_NAMESPACE)
+auto WIDE_INTEGER_NAMESPACE::math::wide_integer::example005b_powm_ct_timing() -> bool
+#else
+auto ::math::wide_integer::example005b_powm_ct_timing() -> bool
+#endif
+{
+  using local_powm_ct_timing::big_uint_type;
+
+  local_powm_ct_timing::random_engine_type rng(local_powm_ct_timing::rng_seed); // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+  local_powm_ct_timing::distribution_type distribution { };
+
+  // Use a random, odd modulus with the top bit set.
+  big_uint_type m { distribution(rng) };
+
+  m |= big_uint_type(static_cast<std::uint8_t>(UINT8_C(1)));
+  m |= big_uint_type(static_cast<std::uint8_t>(UINT8_C(1))) << static_cast<unsigned>(std::numeric_limits<big_uint_type>::digits - 1);
+
+  auto result_is_ok = true;
+
+  const float t_powm_ct =
+    local_powm_ct_timing::measure
+    (
+      rng,
+      m,
+      [](const big_uint_type& b, const big_uint_type& p, const big_uint_type& mod) { return powm_ct(b, p, mod); },
+      result_is_ok
+    );
+
+  const float t_powm =
+    local_powm_ct_timing::measure
+    (
+      rng,
+      m,
+      [](const big_uint_type& b, const big_uint_type& p, const big_uint_type& mod) { return powm(b, p, mod); },
+      result_is_ok
+    );
+
+  {
+    const auto flg = std::cout.flags();
+
+    std::cout << "bits: "
+              << std::numeric_limits<big_uint_type>::digits
+              << ", t(powm_ct): "
+              << std::fixed
+              << std::setprecision(2)
+              << t_powm_ct
+              << ", t(powm): "
+              << t_powm
+              << std::endl;
+
+    std::cout.flags(flg);
+  }
+
+  #if defined(WIDE_INTEGER_STANDALONE_EXAMPLE005B_POWM_CT_TIMING)
+  result_is_ok = ((std::fabs(t_powm_ct) < local_powm_ct_timing::t_limit) && result_is_ok);
+  #endif
+
+  return result_is_ok;
+}
+
+// Enable this if you would like to activate this main() as a standalone example.
+#if defined(WIDE_INTEGER_STANDALONE_EXAMPLE005B_POWM_CT_TIMING)
+
+auto main() -> int
+{
+  #if defined(WIDE_INTEGER_NAMESPACE)
+  const auto result_is_ok = WIDE_INTEGER_NAMESPACE::math::wide_integer::example005b_powm_ct_timing();
+  #else
+  const auto result_is_ok = ::math::wide_integer::example005b_powm_ct_timing();
+  #endif
+
+  std::cout << "result_is_ok: " << std::boolalpha << result_is_ok << std::endl;
+
+  return (result_is_ok ? 0 : -1);
+}
+
+#endif
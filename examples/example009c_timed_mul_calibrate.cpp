@@ -0,0 +1,390 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2018 - 2026.                 //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#include <examples/example_uintwide_t.h>
+#include <math/wide_integer/uintwide_t.h>
+#include <test/stopwatch.h>
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#if defined(WIDE_INTEGER_STANDALONE_EXAMPLE009C_TIMED_MUL_CALIBRATE)
+#include <fstream>
+#endif
+
+namespace local_timed_mul_calibrate
+{
+  // This calibration measures the limb counts at which Karatsuba
+  // multiplication becomes faster than schoolbook multiplication
+  // on the host. It writes these in the form of a configuration
+  // header that sets the default multiplication_traits, which
+  // can be included prior to including uintwide_t.h. The Toom-3,
+  // NTT and Burnikel-Ziegler thresholds are not measured. The header
+  // records them with their default values.
+
+  // Each algorithm tag is carried by a distinct allocator type, so that
+  // multiplication_traits can be specialized for it. All of the timed
+  // types use the same (dynamic) storage, making the timings comparable.
+  template<const std::size_t KaratsubaThreshold,
+           const std::size_t SchoolbookFallback>
+  struct algorithm_tag { };
+
+  template<typename T,
+           typename AlgorithmTagType>
+  class calibration_allocator
+  {
+  public:
+    using value_type = T;
+
+    template<typename OtherType>
+    struct rebind
+    {
+      using other = calibration_allocator<OtherType, AlgorithmTagType>;
+    };
+
+    constexpr calibration_allocator() noexcept = default;
+
+    template<typename OtherType>
+    constexpr calibration_allocator(const calibration_allocator<OtherType, AlgorithmTagType>&) noexcept { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    auto allocate(const std::size_t count) -> value_type* { return std::allocator<value_type>().allocate(count); }
+
+    auto deallocate(value_type* p, const std::size_t count) -> void { std::allocator<value_type>().deallocate(p, count); }
+
+    constexpr auto operator==(const calibration_allocator&) const noexcept -> bool { return true; }
+    constexpr auto operator!=(const calibration_allocator&) const noexcept -> bool { return false; }
+  };
+} // namespace local_timed_mul_calibrate
+
+WIDE_INTEGER_NAMESPACE_BEGIN
+
+#if(__cplusplus >= 201703L)
+namespace math::wide_integer {
+#else
+namespace math { namespace wide_integer { // NOLINT(modernize-concat-nested-namespaces)
+#endif
+
+template<const size_t Width2,
+         typename LimbType,
+         const bool IsSigned,
+         const std::size_t KaratsubaThreshold,
+         const std::size_t SchoolbookFallback>
+struct multiplication_traits<Width2, LimbType, local_timed_mul_calibrate::calibration_allocator<void, local_timed_mul_calibrate::algorithm_tag<KaratsubaThreshold, SchoolbookFallback>>, IsSigned>
+  : public multiplication_traits_default
+{
+  static constexpr size_t number_of_limbs_karatsuba_threshold { static_cast<size_t>(KaratsubaThreshold) };
+  static constexpr size_t number_of_limbs_schoolbook_fallback { static_cast<size_t>(SchoolbookFallback) };
+};
+
+#if(__cplusplus >= 201703L)
+} // namespace math::wide_integer
+#else
+} // namespace wide_integer
+} // namespace math
+#endif
+
+WIDE_INTEGER_NAMESPACE_END
+
+namespace local_timed_mul_calibrate
+{
+  constexpr std::size_t schoolbook_only = static_cast<std::size_t>(UINT32_C(0x7FFFFFFF));
+
+  constexpr std::size_t default_fallback = static_cast<std::size_t>(WIDE_INTEGER_SCHOOLBOOK_FALLBACK);
+
+  #if defined(WIDE_INTEGER_NAMESPACE)
+  using local_limb_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uint_defaultlimb_t;
+  #else
+  using local_limb_type = ::math::wide_integer::uint_defaultlimb_t;
+  #endif
+
+  template<const std::size_t NumberOfLimbs,
+           const std::size_t KaratsubaThreshold,
+           const std::size_t SchoolbookFallback>
+  #if defined(WIDE_INTEGER_NAMESPACE)
+  using calibration_uint_type =
+    WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(NumberOfLimbs * static_cast<std::size_t>(std::numeric_limits<local_limb_type>::digits)),
+                                                           local_limb_type,
+                                                           calibration_allocator<void, algorithm_tag<KaratsubaThreshold, SchoolbookFallback>>>;
+  #else
+  using calibration_uint_type =
+    ::math::wide_integer::uintwide_t<static_cast<::math::wide_integer::size_t>(NumberOfLimbs * static_cast<std::size_t>(std::numeric_limits<local_limb_type>::digits)),
+                                     local_limb_type,
+                                     calibration_allocator<void, algorithm_tag<KaratsubaThreshold, SchoolbookFallback>>>;
+  #endif
+
+  using random_engine_type =
+    std::linear_congruential_engine<std::uint32_t, UINT32_C(48271), UINT32_C(0), UINT32_C(2147483647)>;
+
+  auto local_rng() -> random_engine_type&;
+
+  auto local_rng() -> random_engine_type&
+  {
+    static random_engine_type my_rng { }; // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+    return my_rng;
+  }
+
+  template<typename UintType>
+  auto get_random_operands(std::vector<UintType>& operands) -> void
+  {
+    for(auto& u : operands)
+    {
+      for(auto& limb : u.representation())
+      {
+        limb = static_cast<local_limb_type>(local_rng()());
+
+        if(std::numeric_limits<local_limb_type>::digits > 32)
+        {
+          limb = static_cast<local_limb_type>(static_cast<local_limb_type>(limb << 16U) ^ static_cast<local_limb_type>(local_rng()()));
+          limb = static_cast<local_limb_type>(static_cast<local_limb_type>(limb << 16U) ^ static_cast<local_limb_type>(local_rng()()));
+        }
+      }
+    }
+  }
+
+  template<typename UintType>
+  auto time_mul(const std::vector<UintType>& a, const std::vector<UintType>& b, std::vector<UintType>& c) -> float
+  {
+    // Run the multiplications for roughly 1/10 s, and return the best
+    // (smallest) time per multiplication of a few passes, in seconds.
+
+    using stopwatch_type = concurrency::stopwatch;
+
+    auto best = (std::numeric_limits<float>::max)();
+
+    stopwatch_type total_stopwatch { };
+
+    while(stopwatch_type::elapsed_time<float>(total_stopwatch) < static_cast<float>(0.1L)) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    {
+      stopwatch_type my_stopwatch { };
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < a.size(); ++i)
+      {
+        c[i] = a[i] * b[i];
+      }
+
+      best = (std::min)(best, static_cast<float>(stopwatch_type::elapsed_time<float>(my_stopwatch) / static_cast<float>(a.size())));
+    }
+
+    return best;
+  }
+
+  template<const std::size_t NumberOfLimbs,
+           const std::size_t KaratsubaThreshold,
+           const std::size_t SchoolbookFallback>
+  auto measure(std::vector<calibration_uint_type<NumberOfLimbs, schoolbook_only, default_fallback>>* p_products = nullptr) -> float
+  {
+    using local_uint_type = calibration_uint_type<NumberOfLimbs, KaratsubaThreshold, SchoolbookFallback>;
+
+    constexpr auto count = static_cast<std::size_t>(UINT8_C(16));
+
+    std::vector<local_uint_type> a(count);
+    std::vector<local_uint_type> b(count);
+    std::vector<local_uint_type> c(count);
+
+    local_rng().seed(static_cast<typename random_engine_type::result_type>(NumberOfLimbs));
+
+    get_random_operands(a);
+    get_random_operands(b);
+
+    const auto t = time_mul(a, b, c);
+
+    if(p_products != nullptr)
+    {
+      p_products->resize(count);
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+      {
+        std::copy(c[i].crepresentation().cbegin(), c[i].crepresentation().cend(), (*p_products)[i].representation().begin());
+      }
+    }
+
+    return t;
+  }
+
+  template<const std::size_t NumberOfLimbs>
+  auto measure_crossover_point(bool& result_is_ok) -> bool
+  {
+    // Time the same products with schoolbook and with Karatsuba
+    // multiplication, and also verify that the products agree.
+
+    using local_schoolbook_uint_type = calibration_uint_type<NumberOfLimbs, schoolbook_only, default_fallback>;
+
+    std::vector<local_schoolbook_uint_type> c_school;
+    std::vector<local_schoolbook_uint_type> c_kara;
+
+    const auto t_school = measure<NumberOfLimbs, schoolbook_only,                    default_fallback>(&c_school);
+    const auto t_kara   = measure<NumberOfLimbs, static_cast<std::size_t>(UINT8_C(1)), default_fallback>(&c_kara);
+
+    result_is_ok = ((c_school == c_kara) && (t_school > 0.0F) && (t_kara > 0.0F) && result_is_ok);
+
+    {
+      const auto flg = std::cout.flags();
+
+      std::cout << "limbs: "
+                << std::setw(4)
+                << NumberOfLimbs
+                << ", schoolbook (us): "
+                << std::fixed
+                << std::setprecision(3)
+                << std::setw(10)
+                << t_school * 1.0E6F
+                << ", karatsuba (us): "
+                << std::setw(10)
+                << t_kara * 1.0E6F
+                << std::endl;
+
+      std::cout.flags(flg);
+    }
+
+    return (t_kara < t_school);
+  }
+
+  auto make_config_header(const std::size_t karatsuba_threshold, const std::size_t schoolbook_fallback) -> std::string
+  {
+    std::stringstream strm;
+
+    strm << "// Multiplication thresholds of uintwide_t measured on this host\n"
+         << "// by example009c_timed_mul_calibrate for "
+         << std::numeric_limits<local_limb_type>::digits
+         << "-bit limbs.\n"
+         << "// Include this header prior to including uintwide_t.h.\n"
+         << "\n"
+         << "#ifndef UINTWIDE_T_MUL_CONFIG_H\n"
+         << "  #define UINTWIDE_T_MUL_CONFIG_H\n"
+         << "\n"
+         << "  #define WIDE_INTEGER_KARATSUBA_THRESHOLD " << karatsuba_threshold << "\n"
+         << "  #define WIDE_INTEGER_SCHOOLBOOK_FALLBACK " << schoolbook_fallback << "\n"
+         << "\n"
+         << "  // The following thresholds are not calibrated.\n"
+         << "  // They keep their default values.\n"
+         << "  #define WIDE_INTEGER_TOOM3_THRESHOLD " << WIDE_INTEGER_TOOM3_THRESHOLD << "\n"
+         << "  #define WIDE_INTEGER_NTT_THRESHOLD " << WIDE_INTEGER_NTT_THRESHOLD << "\n"
+         << "  #define WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD " << WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD << "\n"
+         << "\n"
+         << "#endif // UINTWIDE_T_MUL_CONFIG_H\n";
+
+    return strm.str();
+  }
+
+  auto local_config_header() -> std::string&;
+
+  auto local_config_header() -> std::string&
+  {
+    static std::string my_config_header { };
+
+    return my_config_header;
+  }
+} // namespace local_timed_mul_calibrate
+
+#if defined(WIDE_INTEGER_NAMESPACE)
+auto WIDE_INTEGER_NAMESPACE::math::wide_integer::example009c_timed_mul_calibrate() -> bool
+#else
+auto ::math::wide_integer::example009c_timed_mul_calibrate() -> bool
+#endif
+{
+  using local_timed_mul_calibrate::default_fallback;
+
+  auto result_is_ok = true;
+
+  // Find the best schoolbook fallback of the Karatsuba recursion,
+  // using Karatsuba multiplication for a large number of limbs.
+  // The recursion halves 256 limbs down to 64, 32, 16 or 8 limbs.
+  constexpr auto n_fallback = static_cast<std::size_t>(UINT16_C(256));
+
+  const std::array<float, static_cast<std::size_t>(UINT8_C(4))> t_fallback
+  {{
+    local_timed_mul_calibrate::measure<n_fallback, static_cast<std::size_t>(UINT8_C(1)), static_cast<std::size_t>(UINT8_C( 8))>(),
+    local_timed_mul_calibrate::measure<n_fallback, static_cast<std::size_t>(UINT8_C(1)), static_cast<std::size_t>(UINT8_C(16))>(),
+    local_timed_mul_calibrate::measure<n_fallback, static_cast<std::size_t>(UINT8_C(1)), static_cast<std::size_t>(UINT8_C(32))>(),
+    local_timed_mul_calibrate::measure<n_fallback, static_cast<std::size_t>(UINT8_C(1)), static_cast<std::size_t>(UINT8_C(64))>()
+  }};
+
+  const auto index_of_best_fallback = static_cast<std::size_t>(std::distance(t_fallback.cbegin(), std::min_element(t_fallback.cbegin(), t_fallback.cend())));
+
+  const auto schoolbook_fallback = static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(8)) << index_of_best_fallback);
+
+  // Find the Karatsuba threshold. This is the smallest limb count
+  // at which Karatsuba multiplication is faster, both at this limb
+  // count and at all larger limb counts that are checked.
+  const std::array<std::size_t, static_cast<std::size_t>(UINT8_C(9))> limb_counts
+  {{
+    static_cast<std::size_t>(UINT8_C( 16)), static_cast<std::size_t>(UINT8_C( 24)), static_cast<std::size_t>(UINT8_C( 32)),
+    static_cast<std::size_t>(UINT8_C( 48)), static_cast<std::size_t>(UINT8_C( 64)), static_cast<std::size_t>(UINT8_C( 96)),
+    static_cast<std::size_t>(UINT8_C(128)), static_cast<std::size_t>(UINT8_C(192)), static_cast<std::size_t>(UINT16_C(256))
+  }};
+
+  const std::array<bool, static_cast<std::size_t>(UINT8_C(9))> karatsuba_is_faster
+  {{
+    local_timed_mul_calibrate::measure_crossover_point<static_cast<std::size_t>(UINT8_C( 16))>(result_is_ok),
+    local_timed_mul_calibrate::measure_crossover_point<static_cast<std::size_t>(UINT8_C( 24))>(result_is_ok),
+    local_timed_mul_calibrate::measure_crossover_point<static_cast<std::size_t>(UINT8_C( 32))>(result_is_ok),
+    local_timed_mul_calibrate::measure_crossover_point<static_cast<std::size_t>(UINT8_C( 48))>(result_is_ok),
+    local_timed_mul_calibrate::measure_crossover_point<static_cast<std::size_t>(UINT8_C( 64))>(result_is_ok),
+    local_timed_mul_calibrate::measure_crossover_point<static_cast<std::size_t>(UINT8_C( 96))>(result_is_ok),
+    local_timed_mul_calibrate::measure_crossover_point<static_cast<std::size_t>(UINT8_C(128))>(result_is_ok),
+    local_timed_mul_calibrate::measure_crossover_point<static_cast<std::size_t>(UINT8_C(192))>(result_is_ok),
+    local_timed_mul_calibrate::measure_crossover_point<static_cast<std::size_t>(UINT16_C(256))>(result_is_ok)
+  }};
+
+  // If Karatsuba multiplication is not faster at the largest limb
+  // count checked, then the threshold is set beyond this.
+  auto karatsuba_threshold = static_cast<std::size_t>(limb_counts.back() * static_cast<std::size_t>(UINT8_C(2)));
+
+  for(auto i = karatsuba_is_faster.size(); ((i > static_cast<std::size_t>(UINT8_C(0))) && karatsuba_is_faster[i - 1U]); --i)
+  {
+    karatsuba_threshold = limb_counts[i - 1U];
+  }
+
+  local_timed_mul_calibrate::local_config_header() =
+    local_timed_mul_calibrate::make_config_header(karatsuba_threshold, schoolbook_fallback);
+
+  std::cout << "schoolbook fallback used for the crossover: " << default_fallback << '\n'
+            << '\n'
+            << local_timed_mul_calibrate::local_config_header()
+            << std::endl;
+
+  result_is_ok = ((karatsuba_threshold > static_cast<std::size_t>(UINT8_C(0))) && result_is_ok);
+
+  return result_is_ok;
+}
+
+// Enable this if you would like to activate this main() as a standalone example.
+#if defined(WIDE_INTEGER_STANDALONE_EXAMPLE009C_TIMED_MUL_CALIBRATE)
+
+auto main() -> int
+{
+  #if defined(WIDE_INTEGER_NAMESPACE)
+  const auto result_is_ok = WIDE_INTEGER_NAMESPACE::math::wide_integer::example009c_timed_mul_calibrate();
+  #else
+  const auto result_is_ok = ::math::wide_integer::example009c_timed_mul_calibrate();
+  #endif
+
+  // Write the configuration header to the working directory.
+  if(result_is_ok)
+  {
+    std::ofstream out("uintwide_t_mul_config.h");
+
+    out << local_timed_mul_calibrate::local_config_header();
+  }
+
+  std::cout << "result_is_ok: " << std::boolalpha << result_is_ok << std::endl;
+
+  return (result_is_ok ? 0 : -1);
+}
+
+#endif
@@ -0,0 +1,157 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2018 - 2026.                 //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+#include <examples/example_uintwide_t.h>
+#include <math/wide_integer/uintwide_t.h>
+#include <test/stopwatch.h>
+
+#include <util/utility/util_pseudorandom_time_point_seed.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+namespace local_timed_sqr
+{
+  // Time the squaring x * x against the multiplication x * y
+  // of distinct operands having the same value. The squaring
+  // is detected by aliasing and only forms the symmetric
+  // cross products once.
+
+  using random_engine_type =
+    std::linear_congruential_engine<std::uint32_t, UINT32_C(48271), UINT32_C(0), UINT32_C(2147483647)>;
+
+  #if defined(WIDE_INTEGER_NAMESPACE)
+  using local_limb_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uint_defaultlimb_t;
+  #else
+  using local_limb_type = ::math::wide_integer::uint_defaultlimb_t;
+  #endif
+
+  constexpr auto measurement_seconds = static_cast<float>(0.25L);
+
+  template<typename TimingFunctionType>
+  auto measure_kops(TimingFunctionType timing_function) -> float
+  {
+    std::uint64_t count = 0U;
+
+    using stopwatch_type = concurrency::stopwatch;
+
+    stopwatch_type my_stopwatch { };
+
+    while(stopwatch_type::elapsed_time<float>(my_stopwatch) < measurement_seconds)
+    {
+      timing_function(static_cast<std::size_t>(count));
+
+      ++count;
+    }
+
+    return static_cast<float>(count) / static_cast<float>(stopwatch_type::elapsed_time<float>(my_stopwatch) * 1000.0F);
+  }
+
+  template<const std::size_t Width2>
+  auto run(random_engine_type& rng) -> bool
+  {
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using big_uint_type     = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<Width2, local_limb_type, std::allocator<void>, false>;
+    using distribution_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uniform_int_distribution<Width2, local_limb_type, std::allocator<void>, false>;
+    #else
+    using big_uint_type     = ::math::wide_integer::uintwide_t<Width2, local_limb_type, std::allocator<void>, false>;
+    using distribution_type = ::math::wide_integer::uniform_int_distribution<Width2, local_limb_type, std::allocator<void>, false>;
+    #endif
+
+    distribution_type distribution { };
+
+    std::vector<big_uint_type> a(static_cast<std::size_t>(UINT8_C(32)));
+    std::vector<big_uint_type> b(a.size());
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < a.size(); ++i)
+    {
+      a[i] = distribution(rng);
+      b[i] = a[i];
+    }
+
+    auto result_is_ok = true;
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < a.size(); ++i)
+    {
+      result_is_ok = (((a[i] * a[i]) == (a[i] * b[i])) && result_is_ok);
+    }
+
+    // The products are accumulated in a sink, which keeps them from being optimized away.
+    big_uint_type sink { };
+
+    const float kops_mul = measure_kops([&a, &b, &sink](const std::size_t index) { sink ^= (a[index % a.size()] * b[index % a.size()]); });
+    const float kops_sqr = measure_kops([&a, &sink]    (const std::size_t index) { sink ^= (a[index % a.size()] * a[index % a.size()]); });
+
+    {
+      const auto flg = std::cout.flags();
+
+      std::cout << "bits: "
+                << std::setw(6)
+                << std::numeric_limits<big_uint_type>::digits
+                << ", kops_per_sec(mul): "
+                << std::fixed
+                << std::setprecision(3)
+                << kops_mul
+                << ", kops_per_sec(sqr): "
+                << kops_sqr
+                << ", ratio: "
+                << std::setprecision(2)
+                << (kops_sqr / kops_mul)
+                << std::endl;
+
+      std::cout.flags(flg);
+    }
+
+    result_is_ok = ((kops_sqr > (std::numeric_limits<float>::min)()) && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace local_timed_sqr
+
+#if defined(WIDE_INTEGER_NAMESPACE)
+auto WIDE_INTEGER_NAMESPACE::math::wide_integer::example009d_timed_sqr() -> bool
+#else
+auto ::math::wide_integer::example009d_timed_sqr() -> bool
+#endif
+{
+  local_timed_sqr::random_engine_type rng; // NOLINT(cert-msc32-c,cert-msc51-cpp)
+
+  rng.seed(::util::util_pseudorandom_time_point_seed::value<typename local_timed_sqr::random_engine_type::result_type>());
+
+  auto result_is_ok = true;
+
+  result_is_ok = (local_timed_sqr::run<static_cast<std::size_t>(UINT32_C(  256))>(rng) && result_is_ok);
+  result_is_ok = (local_timed_sqr::run<static_cast<std::size_t>(UINT32_C( 1024))>(rng) && result_is_ok);
+  result_is_ok = (local_timed_sqr::run<static_cast<std::size_t>(UINT32_C( 4096))>(rng) && result_is_ok);
+  result_is_ok = (local_timed_sqr::run<static_cast<std::size_t>(UINT32_C(32768))>(rng) && result_is_ok);
+
+  return result_is_ok;
+}
+
+// Enable this if you would like to activate this main() as a standalone example.
+#if defined(WIDE_INTEGER_STANDALONE_EXAMPLE009D_TIMED_SQR)
+
+auto main() -> int
+{
+  #if defined(WIDE_INTEGER_NAMESPACE)
+  const auto result_is_ok = WIDE_INTEGER_NAMESPACE::math::wide_integer::example009d_timed_sqr();
+  #else
+  const auto result_is_ok = ::math::wide_integer::example009d_timed_sqr();
+  #endif
+
+  std::cout << "result_is_ok: " << std::boolalpha << result_is_ok << std::endl;
+
+  return (result_is_ok ? 0 : -1);
+}
+
+#endif
@@ -7,9 +7,14 @@
 
 #include <examples/example_uintwide_t.h>
 #include <math/wide_integer/uintwide_t.h>
+#include <test/stopwatch.h>
 
 #include <util/utility/util_pseudorandom_time_point_seed.h>
 
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <limits>
 #include <random>
 #include <string>
 
@@ -107,14 +112,42 @@ namespace local_rsa
                                                             allocator_type>;
     #endif
 
+    // The type of the primes p and q and of the private-key components
+    // that are used with the Chinese remainder theorem (CRT).
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using my_half_uintwide_t = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(bit_count / 2U),
+                                                                                      LimbType,
+                                                                                      allocator_type>;
+    #else
+    using my_half_uintwide_t = ::math::wide_integer::uintwide_t<static_cast<math::wide_integer::size_t>(bit_count / 2U),
+                                                                LimbType,
+                                                                allocator_type>;
+    #endif
+
     using limb_type = typename my_uintwide_t::limb_type;
 
+    // The Montgomery contexts of the primes p and q.
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using my_montgomery_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::montgomery_context<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(bit_count / 2U), LimbType, allocator_type>;
+    #else
+    using my_montgomery_type = ::math::wide_integer::montgomery_context<static_cast<math::wide_integer::size_t>(bit_count / 2U), LimbType, allocator_type>;
+    #endif
+
+    // Besides the private exponent s and the primes, the private key
+    // holds dp = s mod (p - 1), dq = s mod (q - 1) and q_inv = q^-1 mod p,
+    // as well as the Montgomery contexts of p and q. These are set up
+    // once with the key, and not for each private-key operation.
     using private_key_type =
       struct
       {
-        my_uintwide_t s;
-        my_uintwide_t p;
-        my_uintwide_t q;
+        my_uintwide_t      s;
+        my_uintwide_t      p;
+        my_uintwide_t      q;
+        my_half_uintwide_t dp;
+        my_half_uintwide_t dq;
+        my_half_uintwide_t q_inv;
+        my_montgomery_type mont_p;
+        my_montgomery_type mont_q;
       };
 
     using public_key_type =
@@ -126,37 +159,6 @@ namespace local_rsa
 
     virtual ~rsa_base() = default;
 
-    struct euclidean
-    {
-      template<typename IntegerType>
-      static auto extended_euclidean(const IntegerType& a, // NOLINT(misc-no-recursion)
-                                     const IntegerType& b,
-                                           IntegerType* x, // NOLINT(bugprone-easily-swappable-parameters)
-                                           IntegerType* y) -> IntegerType
-      {
-        // Recursive extended Euclidean algorithm.
-        using local_integer_type = IntegerType;
-
-        if(a == 0)
-        {
-          *x = local_integer_type { 0U };
-          *y = local_integer_type { 1U };
-
-          return b;
-        }
-
-        local_integer_type tmp_x { };
-        local_integer_type tmp_y { };
-
-        local_integer_type gcd_ext = extended_euclidean(b % a, a, &tmp_x, &tmp_y);
-
-        *x = std::move(tmp_y - ((b / a) * tmp_x));
-        *y = std::move(tmp_x);
-
-        return gcd_ext;
-      }
-    };
-
     class encryptor
     {
     public:
@@ -184,7 +186,7 @@ namespace local_rsa
 
       auto decrypt(const my_uintwide_t& cry_in) -> std::string
       {
-        const my_uintwide_t tmp { powm(cry_in, private_key.s, private_key.q * private_key.p) };
+        const my_uintwide_t tmp { private_op(private_key, cry_in) };
 
         std::stringstream strm { };
 
@@ -260,6 +262,74 @@ namespace local_rsa
       return decryptor(private_key).decrypt(cry_in);
     }
 
+    WIDE_INTEGER_NODISCARD auto sign(const my_uintwide_t& msg) const -> my_uintwide_t
+    {
+      return private_op(private_key, msg);
+    }
+
+    WIDE_INTEGER_NODISCARD auto verify(const my_uintwide_t& msg, const my_uintwide_t& sig) const -> bool
+    {
+      return (powm(sig, public_key.r, public_key.m) == msg);
+    }
+
+    static auto private_op(const private_key_type& key, const my_uintwide_t& x) -> my_uintwide_t
+    {
+      // Calculate x^s mod (p * q) with the CRT. The exponentiations
+      // modulo p and modulo q use the Montgomery contexts of the key
+      // at half the width and with exponents of half the length.
+      // Garner's formula combines their results m_p and m_q to the result
+      //   m_q + q * ((q_inv * (m_p - m_q)) mod p).
+
+      const my_half_uintwide_t& p = key.mont_p.modulus();
+
+      const my_half_uintwide_t m_p { key.mont_p.powm(my_half_uintwide_t(x % key.p), key.dp) };
+      const my_half_uintwide_t m_q { key.mont_q.powm(my_half_uintwide_t(x % key.q), key.dq) };
+
+      // Reduce m_q modulo p, since q may be larger than p.
+      const my_half_uintwide_t m_q_mod_p { m_q % p };
+
+      const my_half_uintwide_t m_dif { (m_p >= m_q_mod_p) ? my_half_uintwide_t(m_p - m_q_mod_p) : my_half_uintwide_t((p - m_q_mod_p) + m_p) };
+
+      const my_uintwide_t h { (my_uintwide_t(key.q_inv) * my_uintwide_t(m_dif)) % key.p };
+
+      return (h * key.q) + my_uintwide_t(m_q);
+    }
+
+    template<typename RandomEngineType>
+    static auto make_prime(const my_uintwide_t& e, RandomEngineType& generator) -> my_uintwide_t
+    {
+      // Draw odd random numbers of half the key width with their two
+      // highest bits set, so that the product of two of them has the full
+      // key width. Return the first one that passes the Miller-Rabin test
+      // and for which p - 1 is coprime to the public exponent e.
+
+      #if defined(WIDE_INTEGER_NAMESPACE)
+      using local_distribution_type =
+        WIDE_INTEGER_NAMESPACE::math::wide_integer::uniform_int_distribution<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(bit_count / 2U), limb_type, allocator_type>;
+      #else
+      using local_distribution_type =
+        ::math::wide_integer::uniform_int_distribution<static_cast<math::wide_integer::size_t>(bit_count / 2U), limb_type, allocator_type>;
+      #endif
+
+      local_distribution_type distribution;
+
+      const my_half_uintwide_t e_half(e);
+      const my_half_uintwide_t top_bits { my_half_uintwide_t(3U) << static_cast<unsigned>((bit_count / 2U) - 2U) };
+
+      my_half_uintwide_t p { };
+
+      bool p_is_ok { false };
+
+      while(!p_is_ok)
+      {
+        p = (distribution(generator) | top_bits) | 1U;
+
+        p_is_ok = ((gcd(my_half_uintwide_t(p - 1U), e_half) == 1U) && miller_rabin(p, 25U, distribution, generator));
+      }
+
+      return my_uintwide_t(p);
+    }
+
     template<typename RandomEngineType = std::minstd_rand>
     static auto is_prime(const my_uintwide_t& p,
                          const RandomEngineType& generator = RandomEngineType(util::util_pseudorandom_time_point_seed::value<typename RandomEngineType::result_type>())) -> bool
@@ -290,54 +360,41 @@ namespace local_rsa
     my_uintwide_t    my_m;            // NOLINT(cppcoreguidelines-non-private-member-variables-in-classes,misc-non-private-member-variables-in-classes,readability-identifier-naming)
     my_uintwide_t    phi_of_m    { }; // NOLINT(cppcoreguidelines-non-private-member-variables-in-classes,misc-non-private-member-variables-in-classes,readability-identifier-naming)
     public_key_type  public_key  { }; // NOLINT(cppcoreguidelines-non-private-member-variables-in-classes,misc-non-private-member-variables-in-classes,readability-identifier-naming)
-    private_key_type private_key { }; // NOLINT(cppcoreguidelines-non-private-member-variables-in-classes,misc-non-private-member-variables-in-classes,readability-identifier-naming)
+    private_key_type private_key;     // NOLINT(cppcoreguidelines-non-private-member-variables-in-classes,misc-non-private-member-variables-in-classes,readability-identifier-naming)
 
     rsa_base(my_uintwide_t p_in,
              my_uintwide_t q_in,
              my_uintwide_t r_in) : my_p(std::move(p_in)),
                                    my_q(std::move(q_in)),
                                    my_r(std::move(r_in)),
-                                   my_m(my_p * my_q)
+                                   my_m(my_p * my_q),
+                                   private_key
+                                   {
+                                     my_uintwide_t { },
+                                     my_p,
+                                     my_q,
+                                     my_half_uintwide_t { },
+                                     my_half_uintwide_t { },
+                                     my_half_uintwide_t { },
+                                     my_montgomery_type(my_half_uintwide_t(my_p)),
+                                     my_montgomery_type(my_half_uintwide_t(my_q))
+                                   }
     {
       public_key = public_key_type { my_r, my_m }; // NOLINT(cppcoreguidelines-prefer-member-initializer)
     }
 
     auto calculate_private_key() -> void
     {
-      my_uintwide_t a { phi_of_m };
-      my_uintwide_t b { my_r };
-
-      my_uintwide_t x { };
-      my_uintwide_t s { };
-
-      euclidean::extended_euclidean(a, b, &x, &s);
-
-      if(is_neg(s))
-      {
-        s = std::move(make_positive(s, phi_of_m));
-      }
-
-      private_key = std::move( private_key_type { std::move(s), my_p, my_q } );
-    }
-
-  private:
-    static auto is_neg(const my_uintwide_t& x) -> bool
-    {
-      const bool x_is_neg = ((x & (my_uintwide_t(1U) << (std::numeric_limits<my_uintwide_t>::digits - 1))) != 0);
+      // The private exponent is the inverse of the public exponent modulo phi(m).
+      const my_uintwide_t my_one(1U);
 
-      return x_is_neg;
-    }
+      const my_uintwide_t s { invmod(my_r, phi_of_m) };
 
-    static auto make_positive(const my_uintwide_t& number, const my_uintwide_t& modulus) -> my_uintwide_t // NOLINT(bugprone-easily-swappable-parameters)
-    {
-      my_uintwide_t tmp { number };
-
-      while(is_neg(tmp)) // NOLINT(altera-id-dependent-backward-branch)
-      {
-        tmp += modulus;
-      }
-
-      return tmp;
+      // The primes and their Montgomery contexts are already set up.
+      private_key.s     = s;
+      private_key.dp    = my_half_uintwide_t(s % (my_p - my_one));
+      private_key.dq    = my_half_uintwide_t(s % (my_q - my_one));
+      private_key.q_inv = invmod(my_half_uintwide_t(my_q % my_p), my_half_uintwide_t(my_p));
     }
   };
 
@@ -424,6 +481,70 @@ namespace local_rsa
       return *this;
     }
   };
+
+  template<typename RsaType>
+  auto time_private_ops(const RsaType& rsa) -> bool
+  {
+    // Time the private operation over the full modulus against the one
+    // with the CRT, each for about a quarter of a second.
+
+    using local_uintwide_t = typename RsaType::my_uintwide_t;
+
+    using stopwatch_type = concurrency::stopwatch;
+
+    const local_uintwide_t x { rsa.encrypt("Hello wide-integer RSA") };
+
+    local_uintwide_t y_full { };
+    local_uintwide_t y_crt  { };
+
+    std::uint64_t count_full = 0U;
+    std::uint64_t count_crt  = 0U;
+
+    stopwatch_type my_stopwatch { };
+
+    while(stopwatch_type::elapsed_time<float>(my_stopwatch) < static_cast<float>(0.25L)) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    {
+      y_full = powm(x, rsa.get_d(), rsa.get_n());
+
+      ++count_full;
+    }
+
+    const float ops_full = static_cast<float>(count_full) / stopwatch_type::elapsed_time<float>(my_stopwatch);
+
+    my_stopwatch.reset();
+
+    while(stopwatch_type::elapsed_time<float>(my_stopwatch) < static_cast<float>(0.25L)) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    {
+      y_crt = rsa.sign(x);
+
+      ++count_crt;
+    }
+
+    const float ops_crt = static_cast<float>(count_crt) / stopwatch_type::elapsed_time<float>(my_stopwatch);
+
+    {
+      const auto flg = std::cout.flags();
+
+      std::cout << "rsa bits: "
+                << RsaType::bit_count
+                << ", full ops_per_sec: "
+                << std::fixed
+                << std::setprecision(1)
+                << ops_full
+                << ", crt ops_per_sec: "
+                << ops_crt
+                << std::endl;
+
+      std::cout.flags(flg);
+    }
+
+    return
+    (
+         (y_full == y_crt)
+      && (ops_full > (std::numeric_limits<float>::min)())
+      && (ops_crt  > (std::numeric_limits<float>::min)())
+    );
+  }
 } // namespace local_rsa
 
 #if defined(WIDE_INTEGER_NAMESPACE)
@@ -481,6 +602,47 @@ auto ::math::wide_integer::example012_rsa_crypto() -> bool
 
   result_is_ok = ((msg_recover == message_in) && result_is_ok);
 
+  {
+    // Sign and verify with the private operation that uses the CRT,
+    // and check it against the exponentiation over the full modulus.
+
+    const rsa_type::my_uintwide_t sig { rsa.sign(cipher_text) };
+
+    result_is_ok = ((rsa.verify(cipher_text, sig) && (sig == powm(cipher_text, d, n))) && result_is_ok);
+  }
+
+  {
+    // Generate a 1024-bit key with the public exponent 65537.
+
+    using rsa_1024_type          = local_rsa::rsa_fips<static_cast<std::size_t>(UINT32_C(1024))>;
+    using rsa_1024_integral_type = typename rsa_1024_type::my_uintwide_t;
+
+    using local_random_engine_type = std::mt19937;
+
+    local_random_engine_type generator(::util::util_pseudorandom_time_point_seed::value<typename std::mt19937::result_type>());
+
+    const rsa_1024_integral_type e_1024(UINT32_C(65537));
+
+    const rsa_1024_integral_type p_1024 { rsa_1024_type::make_prime(e_1024, generator) };
+
+    rsa_1024_integral_type q_1024 { p_1024 };
+
+    while(q_1024 == p_1024)
+    {
+      q_1024 = rsa_1024_type::make_prime(e_1024, generator);
+    }
+
+    const rsa_1024_type rsa_1024(p_1024, q_1024, e_1024);
+
+    result_is_ok = ((std::numeric_limits<rsa_1024_integral_type>::digits - static_cast<int>(msb(rsa_1024.get_n())) == 1) && result_is_ok);
+
+    result_is_ok = ((rsa_1024.decrypt(rsa_1024.encrypt(message_in)) == message_in) && result_is_ok);
+
+    // Report the private operations per second for both key sizes.
+    result_is_ok = (local_rsa::time_private_ops(rsa_1024) && result_is_ok);
+    result_is_ok = (local_rsa::time_private_ops(rsa)      && result_is_ok);
+  }
+
   return result_is_ok;
 }
 
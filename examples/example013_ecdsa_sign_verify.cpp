@@ -53,7 +53,10 @@ THE SOFTWARE.
 //   from: https://github.com/imahjoub/hash_sha256
 
 #include <algorithm>
+#include <array>
 #include <cstdint>
+#include <iterator>
+#include <memory>
 #include <random>
 #include <string>
 #include <utility>
@@ -378,6 +381,699 @@ namespace example013_ecdsa
       };
   };
 
+  template<const unsigned CurveBits,
+           typename LimbType>
+  class weierstrass_curve_engine
+  {
+    // This is a point-arithmetic engine for the short Weierstrass curve
+    // y^2 = x^3 + a*x + b over the prime field F_p. Points are held in
+    // Jacobian coordinates (X, Y, Z), representing the affine point
+    // (X / Z^2, Y / Z^3), so the group law needs no field inversion.
+    // The field elements are held at the native width of the curve.
+    // For a prime p of pseudo-Mersenne shape (as in secp256k1), they
+    // are reduced by the folding of special_modulus, and otherwise,
+    // they are kept in Montgomery form. Doubling has dedicated formulas for a = 0
+    // (as in secp256k1) and a = -3 (as in the NIST prime curves).
+    // The formulas are from the Explicit-Formulas Database,
+    //   see also: https://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian.html
+
+  public:
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using uint_type          = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(CurveBits), LimbType, void, false>;
+    using field_context_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::montgomery_context<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(CurveBits), LimbType, void, false>;
+    using field_special_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::special_modulus<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(CurveBits), LimbType, void, false>;
+    #else
+    using uint_type          = ::math::wide_integer::uintwide_t<static_cast<::math::wide_integer::size_t>(CurveBits), LimbType, void, false>;
+    using field_context_type = ::math::wide_integer::montgomery_context<static_cast<::math::wide_integer::size_t>(CurveBits), LimbType, void, false>;
+    using field_special_type = ::math::wide_integer::special_modulus<static_cast<::math::wide_integer::size_t>(CurveBits), LimbType, void, false>;
+    #endif
+
+    using limb_type = LimbType;
+
+    using affine_point_type = std::pair<uint_type, uint_type>;
+
+    struct jacobian_point_type
+    {
+      uint_type my_x { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      uint_type my_y { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      uint_type my_z { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    template<const WIDE_INTEGER_NAMESPACE::math::wide_integer::unsigned_fast_type ExponentBits,
+             const WIDE_INTEGER_NAMESPACE::math::wide_integer::unsigned_fast_type WindowBits>
+    using fixed_base_table_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::fixed_base_table<jacobian_point_type, ExponentBits, WindowBits>;
+    #else
+    template<const ::math::wide_integer::unsigned_fast_type ExponentBits,
+             const ::math::wide_integer::unsigned_fast_type WindowBits>
+    using fixed_base_table_type = ::math::wide_integer::fixed_base_table<jacobian_point_type, ExponentBits, WindowBits>;
+    #endif
+
+    // The group law written as mul() and sqr(), in the way
+    // of the policies of exponentiation (as for fixed_base_table).
+    struct group_policy_type
+    {
+      const weierstrass_curve_engine& engine; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+
+      WIDE_INTEGER_NODISCARD auto mul(const jacobian_point_type& a, const jacobian_point_type& b) const -> jacobian_point_type { return engine.point_add(a, b); }
+      WIDE_INTEGER_NODISCARD auto sqr(const jacobian_point_type& a) const -> jacobian_point_type { return engine.point_double(a); }
+    };
+
+    // The width of the non-adjacent form used in scalar multiplication.
+    static constexpr auto wnaf_width = static_cast<unsigned>(UINT8_C(5));
+
+    // Set up the engine for the prime p and the coefficients 0 <= a, b < p.
+    // The coefficient b is only needed by the complete addition formulas
+    // of fixed_base_mult_ct().
+    weierstrass_curve_engine(const uint_type& p, const uint_type& a, const uint_type& b = uint_type { }) // NOLINT(bugprone-easily-swappable-parameters)
+      : my_field(p),
+        my_special(p),
+        my_one(to_field(uint_type(static_cast<unsigned>(UINT8_C(1))))),
+        my_a(to_field(a)),
+        my_a_kind
+        (
+          (a == 0)
+            ? coefficient_a_kind::is_zero
+            : ((a == (p - static_cast<unsigned>(UINT8_C(3)))) ? coefficient_a_kind::is_minus_three
+                                                               : coefficient_a_kind::is_generic)
+        ),
+        my_a_mont(my_field.to_montgomery(a)),
+        my_b3_mont(add_ct(add_ct(my_field.to_montgomery(b), my_field.to_montgomery(b)), my_field.to_montgomery(b))) { }
+
+    weierstrass_curve_engine() = delete;
+
+    weierstrass_curve_engine(const weierstrass_curve_engine&) = default;
+    weierstrass_curve_engine(weierstrass_curve_engine&&) noexcept = default;
+
+    ~weierstrass_curve_engine() = default;
+
+    auto operator=(const weierstrass_curve_engine&) -> weierstrass_curve_engine& = default;
+    auto operator=(weierstrass_curve_engine&&) noexcept -> weierstrass_curve_engine& = default;
+
+    static auto is_infinity(const jacobian_point_type& point) -> bool { return (point.my_z == 0); }
+
+    WIDE_INTEGER_NODISCARD auto group_policy() const -> group_policy_type { return group_policy_type { *this }; }
+
+    WIDE_INTEGER_NODISCARD auto from_affine(const affine_point_type& point) const -> jacobian_point_type
+    {
+      // The affine point (0, 0) stands for the point at infinity.
+
+      if((point.first == 0) && (point.second == 0))
+      {
+        return jacobian_point_type { };
+      }
+
+      return
+      {
+        to_field(point.first),
+        to_field(point.second),
+        my_one
+      };
+    }
+
+    WIDE_INTEGER_NODISCARD auto to_affine(const jacobian_point_type& point) const -> affine_point_type
+    {
+      if(is_infinity(point))
+      {
+        return affine_point_type { };
+      }
+
+      // This is the one and only field inversion: (x, y) = (X / Z^2, Y / Z^3).
+
+      const auto z_inv =
+        to_field(invmod(from_field(point.my_z), my_field.modulus()));
+
+      const auto z_inv2 = sqr(z_inv);
+
+      return
+      {
+        from_field(mul(point.my_x, z_inv2)),
+        from_field(mul(point.my_y, mul(z_inv2, z_inv)))
+      };
+    }
+
+    WIDE_INTEGER_NODISCARD auto is_on_curve(const affine_point_type& point, const uint_type& b) const -> bool
+    {
+      // Test y^2 == x^3 + a * x + b (mod p) for the affine point (x, y),
+      // with 0 <= x, y, b < p.
+
+      const auto x = to_field(point.first);
+      const auto y = to_field(point.second);
+
+      return (sqr(y) == add(mul(add(sqr(x), my_a), x), to_field(b)));
+    }
+
+    WIDE_INTEGER_NODISCARD auto point_neg(const jacobian_point_type& point) const -> jacobian_point_type
+    {
+      return { point.my_x, sub(uint_type { }, point.my_y), point.my_z };
+    }
+
+    WIDE_INTEGER_NODISCARD auto point_double(const jacobian_point_type& point) const -> jacobian_point_type
+    {
+      if(is_infinity(point))
+      {
+        return point;
+      }
+
+      // A point with Y = 0 has order two. The formulas below
+      // result in Z = 0 for it, being the point at infinity.
+
+      const auto& x1 = point.my_x;
+      const auto& y1 = point.my_y;
+      const auto& z1 = point.my_z;
+
+      jacobian_point_type result { };
+
+      if(my_a_kind == coefficient_a_kind::is_zero)
+      {
+        // dbl-2009-l, 2M + 5S.
+        const auto a = sqr(x1);
+        const auto b = sqr(y1);
+        const auto c = sqr(b);
+        const auto d = twice(sub(sub(sqr(add(x1, b)), a), c));
+        const auto e = add(twice(a), a);
+
+        result.my_x = sub(sqr(e), twice(d));
+        result.my_y = sub(mul(e, sub(d, result.my_x)), twice(twice(twice(c))));
+        result.my_z = twice(mul(y1, z1));
+      }
+      else if(my_a_kind == coefficient_a_kind::is_minus_three)
+      {
+        // dbl-2001-b, 3M + 5S.
+        const auto delta = sqr(z1);
+        const auto gamma = sqr(y1);
+        const auto beta4 = twice(twice(mul(x1, gamma)));
+        const auto t     = mul(sub(x1, delta), add(x1, delta));
+        const auto alpha = add(twice(t), t);
+
+        result.my_x = sub(sqr(alpha), twice(beta4));
+        result.my_y = sub(mul(alpha, sub(beta4, result.my_x)), twice(twice(twice(sqr(gamma)))));
+        result.my_z = sub(sub(sqr(add(y1, z1)), gamma), delta);
+      }
+      else
+      {
+        // dbl-2007-bl, 1M + 8S + 1*a.
+        const auto xx   = sqr(x1);
+        const auto yy   = sqr(y1);
+        const auto yyyy = sqr(yy);
+        const auto zz   = sqr(z1);
+        const auto s    = twice(sub(sub(sqr(add(x1, yy)), xx), yyyy));
+        const auto m    = add(add(twice(xx), xx), mul(my_a, sqr(zz)));
+
+        result.my_x = sub(sqr(m), twice(s));
+        result.my_y = sub(mul(m, sub(s, result.my_x)), twice(twice(twice(yyyy))));
+        result.my_z = sub(sub(sqr(add(y1, z1)), yy), zz);
+      }
+
+      return result;
+    }
+
+    WIDE_INTEGER_NODISCARD auto point_add(const jacobian_point_type& point1, const jacobian_point_type& point2) const -> jacobian_point_type
+    {
+      if(is_infinity(point1)) { return point2; }
+      if(is_infinity(point2)) { return point1; }
+
+      if(point2.my_z == my_one) { return point_add_mixed(point1, point2); }
+      if(point1.my_z == my_one) { return point_add_mixed(point2, point1); }
+
+      // add-2007-bl, 11M + 5S.
+      const auto z1z1 = sqr(point1.my_z);
+      const auto z2z2 = sqr(point2.my_z);
+      const auto u1   = mul(point1.my_x, z2z2);
+      const auto u2   = mul(point2.my_x, z1z1);
+      const auto s1   = mul(point1.my_y, mul(point2.my_z, z2z2));
+      const auto s2   = mul(point2.my_y, mul(point1.my_z, z1z1));
+      const auto h    = sub(u2, u1);
+      const auto r    = twice(sub(s2, s1));
+
+      if(h == 0)
+      {
+        // Here, point1 is either equal to point2 or to -point2.
+        return ((r == 0) ? point_double(point1) : jacobian_point_type { });
+      }
+
+      const auto i = sqr(twice(h));
+      const auto j = mul(h, i);
+      const auto v = mul(u1, i);
+
+      jacobian_point_type result { };
+
+      result.my_x = sub(sub(sqr(r), j), twice(v));
+      result.my_y = sub(mul(r, sub(v, result.my_x)), twice(mul(s1, j)));
+      result.my_z = mul(sub(sub(sqr(add(point1.my_z, point2.my_z)), z1z1), z2z2), h);
+
+      return result;
+    }
+
+    WIDE_INTEGER_NODISCARD auto scalar_mult(const uint_type& k, const jacobian_point_type& point) const -> jacobian_point_type
+    {
+      // Calculate k * point as a sum having one single term.
+
+      const std::pair<uint_type, jacobian_point_type> term { k, point };
+
+      return multi_scalar_mult(&term, &term + 1U); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    }
+
+    template<typename InputIterator>
+    WIDE_INTEGER_NODISCARD auto multi_scalar_mult(InputIterator first, InputIterator last) const -> jacobian_point_type
+    {
+      // Calculate the sum of k_i * point_i for the pairs (k_i, point_i)
+      // in [first, last) from the width-w non-adjacent forms (wNAF)
+      // of the k_i, having on average one nonzero digit in (w + 1) digits.
+      // The odd multiples point_i, 3 * point_i, ..., (2^(w-1) - 1) * point_i
+      // are precomputed and brought to Z = 1 with one shared inversion.
+      // All of the terms share one chain of doublings (Straus' method),
+      // and the tabulated points are added with mixed additions.
+
+      using digits_type = std::vector<std::int8_t>;
+      using table_type  = std::vector<jacobian_point_type>;
+
+      constexpr auto table_size = static_cast<std::size_t>(static_cast<unsigned>(UINT8_C(1)) << static_cast<unsigned>(wnaf_width - static_cast<unsigned>(UINT8_C(2))));
+
+      std::vector<digits_type> digits { };
+
+      table_type table { };
+
+      auto digit_count = static_cast<std::size_t>(UINT8_C(0));
+
+      for( ; first != last; ++first)
+      {
+        if((first->first != 0) && (!is_infinity(first->second)))
+        {
+          digits.push_back(wnaf_digits(first->first));
+
+          digit_count = (std::max)(digit_count, digits.back().size());
+
+          const auto point_twice = point_double(first->second);
+
+          table.push_back(first->second);
+
+          for(auto i = static_cast<std::size_t>(UINT8_C(1)); i < table_size; ++i)
+          {
+            table.push_back(point_add(table.back(), point_twice));
+          }
+        }
+      }
+
+      normalize(table.begin(), table.end());
+
+      jacobian_point_type result { };
+
+      for(auto pos = digit_count; pos > static_cast<std::size_t>(UINT8_C(0)); --pos) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        result = point_double(result);
+
+        for(auto j = static_cast<std::size_t>(UINT8_C(0)); j < digits.size(); ++j)
+        {
+          const auto digit =
+            static_cast<int>
+            (
+              (pos <= digits[j].size()) ? digits[j][static_cast<std::size_t>(pos - 1U)] : static_cast<std::int8_t>(INT8_C(0))
+            );
+
+          if(digit != static_cast<int>(INT8_C(0)))
+          {
+            const auto& entry = table[static_cast<std::size_t>((j * table_size) + static_cast<std::size_t>(((digit > 0) ? digit : -digit) / 2))];
+
+            result = point_add(result, ((digit > 0) ? entry : point_neg(entry)));
+          }
+        }
+      }
+
+      return result;
+    }
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    template<const WIDE_INTEGER_NAMESPACE::math::wide_integer::unsigned_fast_type ExponentBits,
+             const WIDE_INTEGER_NAMESPACE::math::wide_integer::unsigned_fast_type WindowBits>
+    #else
+    template<const ::math::wide_integer::unsigned_fast_type ExponentBits,
+             const ::math::wide_integer::unsigned_fast_type WindowBits>
+    #endif
+    WIDE_INTEGER_NODISCARD auto fixed_base_mult_ct(const fixed_base_table_type<ExponentBits, WindowBits>& table, const uint_type& k) const -> affine_point_type
+    {
+      // Calculate k * g for a secret 0 <= k < 2^ExponentBits from the table
+      // of the multiples of the fixed base g, the entries of which must have
+      // been brought to Z = 1 with normalize(). Unlike the table's pow(),
+      // every entry of each row is read, and the one for the w-bit digit
+      // of k is picked with conditional_select. A zero digit picks the
+      // identity. The picked points are summed with the complete addition
+      // formulas of Renes, Costello and Batina in homogeneous projective
+      // coordinates, which have no exceptional cases to branch on.
+      //   see also: https://eprint.iacr.org/2015/1060
+      // All field elements are kept in Montgomery form here, even for
+      // special primes, since the Montgomery multiplication and the
+      // modular addition and subtraction below do not branch on values.
+      // The final inversion uses invmod_ct(). So the sequence of operations
+      // and memory accesses does not depend on k, except for the result
+      // being the point at infinity (k = 0 modulo the order of g).
+
+      static_assert((static_cast<unsigned>(std::numeric_limits<limb_type>::digits) % static_cast<unsigned>(WindowBits)) == static_cast<unsigned>(UINT8_C(0)),
+                    "Error: The digits of the window may not straddle two limbs");
+
+      using table_type = fixed_base_table_type<ExponentBits, WindowBits>;
+
+      #if defined(WIDE_INTEGER_NAMESPACE)
+      using WIDE_INTEGER_NAMESPACE::math::wide_integer::unsigned_fast_type;
+      using WIDE_INTEGER_NAMESPACE::math::wide_integer::detail::exponent_bits_ct;
+      using WIDE_INTEGER_NAMESPACE::math::wide_integer::detail::is_equal_ct;
+      #else
+      using ::math::wide_integer::unsigned_fast_type;
+      using ::math::wide_integer::detail::exponent_bits_ct;
+      using ::math::wide_integer::detail::is_equal_ct;
+      #endif
+
+      // The identity of the projective coordinates is (0 : 1 : 0).
+      projective_point_type result { uint_type { }, my_field.to_montgomery(uint_type(static_cast<unsigned>(UINT8_C(1)))), uint_type { } };
+
+      auto it = table.begin();
+
+      for(auto row = static_cast<std::size_t>(UINT8_C(0)); row < table_type::row_count; ++row)
+      {
+        const auto digit = exponent_bits_ct(k, static_cast<unsigned_fast_type>(row * static_cast<std::size_t>(WindowBits)), WindowBits);
+
+        jacobian_point_type entry { uint_type { }, my_one, uint_type { } };
+
+        for(auto j = static_cast<std::size_t>(UINT8_C(1)); j <= table_type::row_size; ++j)
+        {
+          const auto is_digit = is_equal_ct(static_cast<unsigned_fast_type>(j), digit);
+
+          entry.my_x.conditional_select(it->my_x, is_digit);
+          entry.my_y.conditional_select(it->my_y, is_digit);
+          entry.my_z.conditional_select(it->my_z, is_digit);
+
+          ++it;
+        }
+
+        // An entry at Z = 1 is the same point in Jacobian
+        // and in homogeneous projective coordinates.
+        result = point_add_complete(result, projective_point_type { to_mont(entry.my_x), to_mont(entry.my_y), to_mont(entry.my_z) });
+      }
+
+      if(result.my_z == 0)
+      {
+        return affine_point_type { };
+      }
+
+      // The product of a Montgomery residue with a plain one is plain,
+      // giving (x, y) = (X / Z, Y / Z).
+
+      const auto z_inv = invmod_ct(my_field.from_montgomery(result.my_z), my_field.modulus());
+
+      return
+      {
+        my_field.mont_mul(result.my_x, z_inv),
+        my_field.mont_mul(result.my_y, z_inv)
+      };
+    }
+
+    template<typename IteratorType>
+    auto normalize(IteratorType first, IteratorType last) const -> void
+    {
+      // Bring the points in [first, last) to Z = 1 using one batch
+      // inversion of their Z. Points at infinity can not be normalized,
+      // and all points are then left in their Jacobian form.
+
+      const auto count = static_cast<std::size_t>(std::distance(first, last));
+
+      std::vector<uint_type> z(count);
+      std::vector<uint_type> z_inv(count);
+
+      auto it = first;
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+      {
+        z[i] = from_field((it++)->my_z);
+      }
+
+      if(!batch_invmod(z.cbegin(), z.cend(), my_field.modulus(), z_inv.begin()))
+      {
+        return; // LCOV_EXCL_LINE
+      }
+
+      it = first;
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+      {
+        const auto zi  = to_field(z_inv[i]);
+        const auto zi2 = sqr(zi);
+
+        it->my_x = mul(it->my_x, zi2);
+        it->my_y = mul(it->my_y, mul(zi2, zi));
+        it->my_z = my_one;
+
+        ++it;
+      }
+    }
+
+  private:
+    enum class coefficient_a_kind : std::uint8_t
+    {
+      is_zero,
+      is_minus_three,
+      is_generic
+    };
+
+    field_context_type my_field;
+    field_special_type my_special;
+    uint_type          my_one;
+    uint_type          my_a;
+    coefficient_a_kind my_a_kind;
+    uint_type          my_a_mont;
+    uint_type          my_b3_mont;
+
+    struct projective_point_type
+    {
+      uint_type my_x { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      uint_type my_y { }; // NOLINT(misc-non-private-member-variables-in-classes)
+      uint_type my_z { }; // NOLINT(misc-non-private-member-variables-in-classes)
+    };
+
+    // Field operations on elements in the representation of the engine,
+    // which is the plain residue for special primes and Montgomery form
+    // otherwise.
+    WIDE_INTEGER_NODISCARD auto to_field  (const uint_type& u) const -> uint_type { return (my_special.is_special() ? u : my_field.to_montgomery(u)); }
+    WIDE_INTEGER_NODISCARD auto from_field(const uint_type& u) const -> uint_type { return (my_special.is_special() ? u : my_field.from_montgomery(u)); }
+
+    WIDE_INTEGER_NODISCARD auto mul(const uint_type& u, const uint_type& v) const -> uint_type { return (my_special.is_special() ? my_special.mul_mod(u, v) : my_field.mont_mul(u, v)); }
+    WIDE_INTEGER_NODISCARD auto sqr(const uint_type& u)                     const -> uint_type { return (my_special.is_special() ? my_special.sqr_mod(u) : my_field.mont_sqr(u)); }
+
+    WIDE_INTEGER_NODISCARD auto add(const uint_type& u, const uint_type& v) const -> uint_type
+    {
+      // The sum may overflow the native width when p is close to 2^bits.
+      // The wrapped subtraction of p recovers the correct result then.
+
+      uint_type result = u + v;
+
+      if((result < u) || (result >= my_field.modulus()))
+      {
+        result -= my_field.modulus();
+      }
+
+      return result;
+    }
+
+    WIDE_INTEGER_NODISCARD auto sub(const uint_type& u, const uint_type& v) const -> uint_type
+    {
+      uint_type result = u - v;
+
+      if(u < v)
+      {
+        result += my_field.modulus();
+      }
+
+      return result;
+    }
+
+    WIDE_INTEGER_NODISCARD auto twice(const uint_type& u) const -> uint_type { return add(u, u); }
+
+    // Field operations in Montgomery form, without branching on
+    // the values of the field elements, for fixed_base_mult_ct().
+    WIDE_INTEGER_NODISCARD auto to_mont(const uint_type& u) const -> uint_type { return (my_special.is_special() ? my_field.to_montgomery(u) : u); }
+
+    WIDE_INTEGER_NODISCARD auto mul_ct(const uint_type& u, const uint_type& v) const -> uint_type { return my_field.mont_mul(u, v); }
+
+    WIDE_INTEGER_NODISCARD auto add_ct(const uint_type& u, const uint_type& v) const -> uint_type
+    {
+      // The sum is at least p, if it carries out of the native width
+      // or if the subtraction of p does not borrow.
+
+      uint_type result { u };
+
+      const auto carry = result.conditional_add(v, true);
+
+      uint_type result_minus_p { result };
+
+      const auto borrow = result_minus_p.conditional_subtract(my_field.modulus(), true);
+
+      result.conditional_select(result_minus_p, (static_cast<limb_type>(carry | static_cast<limb_type>(borrow ^ static_cast<limb_type>(UINT8_C(1)))) != static_cast<limb_type>(UINT8_C(0))));
+
+      return result;
+    }
+
+    WIDE_INTEGER_NODISCARD auto sub_ct(const uint_type& u, const uint_type& v) const -> uint_type
+    {
+      uint_type result { u };
+
+      const auto borrow = result.conditional_subtract(v, true);
+
+      static_cast<void>(result.conditional_add(my_field.modulus(), (borrow != static_cast<limb_type>(UINT8_C(0)))));
+
+      return result;
+    }
+
+    WIDE_INTEGER_NODISCARD auto point_add_complete(const projective_point_type& point1, const projective_point_type& point2) const -> projective_point_type
+    {
+      // Complete addition in homogeneous projective coordinates, (x, y) = (X / Z, Y / Z),
+      // valid for all inputs including the identity (0 : 1 : 0) and doubling.
+      // The steps follow Algorithm 7 (a = 0, 12M + 2*b3) and Algorithm 1
+      // (generic a, 12M + 3*a + 2*b3) of Renes, Costello and Batina.
+
+      const auto& x1 = point1.my_x;
+      const auto& y1 = point1.my_y;
+      const auto& z1 = point1.my_z;
+      const auto& x2 = point2.my_x;
+      const auto& y2 = point2.my_y;
+      const auto& z2 = point2.my_z;
+
+      auto t0 = mul_ct(x1, x2);
+      auto t1 = mul_ct(y1, y2);
+      auto t2 = mul_ct(z1, z2);
+      auto t3 = sub_ct(mul_ct(add_ct(x1, y1), add_ct(x2, y2)), add_ct(t0, t1));
+
+      projective_point_type result { };
+
+      if(my_a_kind == coefficient_a_kind::is_zero)
+      {
+        // Algorithm 7.
+        auto t4 = sub_ct(mul_ct(add_ct(y1, z1), add_ct(y2, z2)), add_ct(t1, t2));
+        auto y3 = sub_ct(mul_ct(add_ct(x1, z1), add_ct(x2, z2)), add_ct(t0, t2));
+
+        t0 = add_ct(add_ct(t0, t0), t0);
+        t2 = mul_ct(my_b3_mont, t2);
+
+        auto z3 = add_ct(t1, t2);
+
+        t1 = sub_ct(t1, t2);
+        y3 = mul_ct(my_b3_mont, y3);
+
+        result.my_x = sub_ct(mul_ct(t3, t1), mul_ct(t4, y3));
+        result.my_y = add_ct(mul_ct(t1, z3), mul_ct(y3, t0));
+        result.my_z = add_ct(mul_ct(z3, t4), mul_ct(t0, t3));
+      }
+      else
+      {
+        // Algorithm 1.
+        auto t4 = sub_ct(mul_ct(add_ct(x1, z1), add_ct(x2, z2)), add_ct(t0, t2));
+        auto t5 = sub_ct(mul_ct(add_ct(y1, z1), add_ct(y2, z2)), add_ct(t1, t2));
+        auto z3 = add_ct(mul_ct(my_b3_mont, t2), mul_ct(my_a_mont, t4));
+        auto x3 = sub_ct(t1, z3);
+
+        z3 = add_ct(t1, z3);
+
+        auto y3 = mul_ct(x3, z3);
+
+        t1 = add_ct(add_ct(t0, t0), t0);
+        t2 = mul_ct(my_a_mont, t2);
+        t4 = mul_ct(my_b3_mont, t4);
+        t1 = add_ct(t1, t2);
+        t2 = mul_ct(my_a_mont, sub_ct(t0, t2));
+        t4 = add_ct(t4, t2);
+
+        result.my_x = sub_ct(mul_ct(t3, x3), mul_ct(t5, t4));
+        result.my_y = add_ct(y3, mul_ct(t1, t4));
+        result.my_z = add_ct(mul_ct(t5, z3), mul_ct(t3, t1));
+      }
+
+      return result;
+    }
+
+    WIDE_INTEGER_NODISCARD auto point_add_mixed(const jacobian_point_type& point1, const jacobian_point_type& point2) const -> jacobian_point_type
+    {
+      // madd-2007-bl, 7M + 4S, for point2 having Z = 1.
+      const auto z1z1 = sqr(point1.my_z);
+      const auto u2   = mul(point2.my_x, z1z1);
+      const auto s2   = mul(point2.my_y, mul(point1.my_z, z1z1));
+      const auto h    = sub(u2, point1.my_x);
+      const auto r    = twice(sub(s2, point1.my_y));
+
+      if(h == 0)
+      {
+        return ((r == 0) ? point_double(point1) : jacobian_point_type { });
+      }
+
+      const auto hh = sqr(h);
+      const auto i  = twice(twice(hh));
+      const auto j  = mul(h, i);
+      const auto v  = mul(point1.my_x, i);
+
+      jacobian_point_type result { };
+
+      result.my_x = sub(sub(sqr(r), j), twice(v));
+      result.my_y = sub(mul(r, sub(v, result.my_x)), twice(mul(point1.my_y, j)));
+      result.my_z = sub(sub(sqr(add(point1.my_z, h)), z1z1), hh);
+
+      return result;
+    }
+
+    static auto wnaf_digits(const uint_type& k) -> std::vector<std::int8_t>
+    {
+      // Recode k to the digits d_i (least significant first) of its wNAF.
+      // Each digit is either zero or odd with |d_i| < 2^(w-1), and
+      // in any w consecutive digits at most one digit is nonzero.
+
+      constexpr auto window_mask = static_cast<unsigned>((static_cast<unsigned>(UINT8_C(1)) << wnaf_width) - static_cast<unsigned>(UINT8_C(1)));
+      constexpr auto window_half = static_cast<int>(static_cast<unsigned>(UINT8_C(1)) << static_cast<unsigned>(wnaf_width - static_cast<unsigned>(UINT8_C(1))));
+
+      std::vector<std::int8_t> digits { };
+
+      digits.reserve(static_cast<std::size_t>(CurveBits + static_cast<unsigned>(UINT8_C(1))));
+
+      uint_type k_val(k);
+
+      while(k_val != 0) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        auto digit = static_cast<int>(INT8_C(0));
+
+        auto carry = false;
+
+        if((static_cast<unsigned>(k_val) & static_cast<unsigned>(UINT8_C(1))) != static_cast<unsigned>(UINT8_C(0)))
+        {
+          digit = static_cast<int>(static_cast<unsigned>(k_val) & window_mask);
+
+          if(digit >= window_half)
+          {
+            // Round k up to the next multiple of 2^w. This can carry
+            // out of the native width, and the carry bit is shifted
+            // back into the top bit right below.
+            digit -= static_cast<int>(window_mask + static_cast<unsigned>(UINT8_C(1)));
+
+            const uint_type k_before(k_val);
+
+            k_val += static_cast<unsigned>(-digit);
+
+            carry = (k_val < k_before);
+          }
+          else
+          {
+            k_val -= static_cast<unsigned>(digit);
+          }
+        }
+
+        digits.push_back(static_cast<std::int8_t>(digit));
+
+        k_val >>= static_cast<unsigned>(UINT8_C(1));
+
+        if(carry)
+        {
+          k_val |= (uint_type(static_cast<unsigned>(UINT8_C(1))) << static_cast<unsigned>(CurveBits - static_cast<unsigned>(UINT8_C(1)))); // LCOV_EXCL_LINE
+        }
+      }
+
+      return digits;
+    }
+  };
+
   template<const unsigned CurveBits,
            typename LimbType,
            const char* CurveName,
@@ -397,34 +1093,90 @@ namespace example013_ecdsa
     using double_sint_type = typename base_class_type::double_sint_type;
     using limb_type        = typename base_class_type::limb_type;
 
-    using keypair_type = std::pair<uint_type, std::pair<uint_type, uint_type>>;
+    using engine_type = weierstrass_curve_engine<CurveBits, LimbType>;
 
     #if defined(WIDE_INTEGER_NAMESPACE)
-    using quadruple_sint_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(std::numeric_limits<uint_type>::digits * static_cast<int>(INT8_C(4))), limb_type, void, true>;
+    using generator_table_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::fixed_base_table<typename engine_type::jacobian_point_type, static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::unsigned_fast_type>(CurveBits)>;
     #else
-    using quadruple_sint_type = ::math::wide_integer::uintwide_t<static_cast<::math::wide_integer::size_t>(std::numeric_limits<uint_type>::digits * static_cast<int>(INT8_C(4))), limb_type, void, true>;
+    using generator_table_type = ::math::wide_integer::fixed_base_table<typename engine_type::jacobian_point_type, static_cast<::math::wide_integer::unsigned_fast_type>(CurveBits)>;
     #endif
 
+    using keypair_type = std::pair<uint_type, std::pair<uint_type, uint_type>>;
+
     #if defined(WIDE_INTEGER_NAMESPACE)
     using sexatuple_sint_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(std::numeric_limits<uint_type>::digits * static_cast<int>(INT8_C(6))), limb_type, void, true>;
     #else
     using sexatuple_sint_type = ::math::wide_integer::uintwide_t<static_cast<::math::wide_integer::size_t>(std::numeric_limits<uint_type>::digits * static_cast<int>(INT8_C(6))), limb_type, void, true>;
     #endif
 
+    // The curve parameters are parsed from their strings once, at compile
+    // time, and are then handed out by reference on each use.
     #if defined(WIDE_INTEGER_NAMESPACE)
-    using duodectuple_sint_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(std::numeric_limits<uint_type>::digits * static_cast<int>(INT8_C(12))), limb_type, void, true>;
+    template<const char* StrValue>
+    using constant_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::from_string_constant<double_sint_type, StrValue>;
     #else
-    using duodectuple_sint_type = ::math::wide_integer::uintwide_t<static_cast<::math::wide_integer::size_t>(std::numeric_limits<uint_type>::digits * static_cast<int>(INT8_C(12))), limb_type, void, true>;
+    template<const char* StrValue>
+    using constant_type = ::math::wide_integer::from_string_constant<double_sint_type, StrValue>;
     #endif
 
-    static constexpr auto curve_p () noexcept -> double_sint_type { return double_sint_type(FieldCharacteristicP); } // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
-    static constexpr auto curve_a () noexcept -> double_sint_type { return double_sint_type(CurveCoefficientA); }    // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
-    static constexpr auto curve_b () noexcept -> double_sint_type { return double_sint_type(CurveCoefficientB); }    // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+    static constexpr auto curve_p () noexcept -> const double_sint_type& { return constant_type<FieldCharacteristicP>::value; }
+    static constexpr auto curve_a () noexcept -> const double_sint_type& { return constant_type<CurveCoefficientA>::value; }
+    static constexpr auto curve_b () noexcept -> const double_sint_type& { return constant_type<CurveCoefficientB>::value; }
+
+    static constexpr auto curve_gx() noexcept -> const double_sint_type& { return constant_type<CoordGx>::value; }
+    static constexpr auto curve_gy() noexcept -> const double_sint_type& { return constant_type<CoordGy>::value; }
+
+    static constexpr auto curve_n () noexcept -> const double_sint_type& { return constant_type<SubGroupOrderN>::value; }
+
+    static auto curve_engine() -> const engine_type&
+    {
+      // The point-arithmetic engine of the curve, including the
+      // Montgomery context of its field, is set up only once.
+
+      static const engine_type engine
+      {
+        uint_type(curve_p()),
+        uint_type((curve_a() < 0) ? (curve_a() % curve_p()) + curve_p() : curve_a() % curve_p()),
+        uint_type((curve_b() < 0) ? (curve_b() % curve_p()) + curve_p() : curve_b() % curve_p())
+      };
+
+      return engine;
+    }
+
+    static auto generator_table() -> const generator_table_type&
+    {
+      // The multiples of the base point G are tabulated only once.
+      // These are brought to Z = 1 for the faster mixed additions.
+
+      static const generator_table_type table =
+        []()
+        {
+          const auto& engine = curve_engine();
+
+          generator_table_type tbl(to_jacobian(point_type(curve_gx(), curve_gy())), typename engine_type::jacobian_point_type { }, engine.group_policy());
+
+          engine.normalize(tbl.begin(), tbl.end());
+
+          return tbl;
+        }();
+
+      return table;
+    }
+
+    static auto generator_mult(const uint_type& k) -> typename engine_type::jacobian_point_type
+    {
+      // Returns k * G from the fixed-base table of G.
+
+      return generator_table().pow(k, curve_engine().group_policy());
+    }
 
-    static constexpr auto curve_gx() noexcept -> double_sint_type { return double_sint_type(CoordGx); }              // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
-    static constexpr auto curve_gy() noexcept -> double_sint_type { return double_sint_type(CoordGy); }              // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+    static auto generator_mult_ct(const uint_type& k) -> typename engine_type::affine_point_type
+    {
+      // Returns k * G in affine coordinates for a secret k, such as a
+      // private key or a nonce, in constant time with respect to k.
 
-    static constexpr auto curve_n () noexcept -> double_sint_type { return double_sint_type(SubGroupOrderN); }       // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+      return curve_engine().fixed_base_mult_ct(generator_table(), k);
+    }
 
     static auto inverse_mod(const double_sint_type& k, const double_sint_type& p) -> double_sint_type // NOLINT(misc-no-recursion)
     {
@@ -444,25 +1196,29 @@ namespace example013_ecdsa
         return p - inverse_mod(-k, p);
       }
 
-      // Extended Euclidean algorithm.
-      auto s     = double_sint_type(static_cast<unsigned>(UINT8_C(0)));
-      auto old_s = double_sint_type(static_cast<unsigned>(UINT8_C(1)));
+      // The inverse is found at the width of the curve.
+      return double_sint_type(invmod(uint_type(divmod(k, p).second), uint_type(p)));
+    }
 
-      auto r     = p;
-      auto old_r = k;
+    static auto inverse_mod_ct(const double_sint_type& k, const double_sint_type& p) -> double_sint_type
+    {
+      // Returns the inverse of the secret 0 < k < p modulo p.
+      // The inverse is found in constant time with respect to k.
 
-      while(r != 0U) // NOLINT(altera-id-dependent-backward-branch)
-      {
-        const auto quotient = divmod(old_r, r).first;
+      return double_sint_type(invmod_ct(uint_type(k), uint_type(p)));
+    }
 
-        const auto tmp_r = r; r = old_r - (quotient * r); old_r = tmp_r;
-        const auto tmp_s = s; s = old_s - (quotient * s); old_s = tmp_s;
-      }
+    // Functions that work on curve points
 
-      return divmod(old_s, p).second;
+    static auto to_jacobian(const point_type& point) -> typename engine_type::jacobian_point_type
+    {
+      return curve_engine().from_affine({ uint_type(point.my_x), uint_type(point.my_y) });
     }
 
-    // Functions that work on curve points
+    static auto to_point(const typename engine_type::affine_point_type& point) -> point_type
+    {
+      return point_type(double_sint_type(point.first), double_sint_type(point.second));
+    }
 
     static auto is_on_curve(const point_type& point) -> bool
     {
@@ -475,19 +1231,9 @@ namespace example013_ecdsa
 
       // Test the condition:
       //   (y * y - x * x * x - curve.a * x -curve.b) % curve.p == 0
+      // in the field arithmetic of the curve engine.
 
-      const auto num =
-        quadruple_sint_type
-        (
-            (quadruple_sint_type(point.my_y) *  quadruple_sint_type(point.my_y))
-          - (quadruple_sint_type(point.my_x) * (quadruple_sint_type(point.my_x) * quadruple_sint_type(point.my_x)))
-          - (quadruple_sint_type(point.my_x) *  quadruple_sint_type(curve_a()))
-          -  quadruple_sint_type(curve_b())
-        );
-
-      const auto divmod_result = divmod(num, quadruple_sint_type(curve_p())).second;
-
-      return (divmod_result == 0);
+      return curve_engine().is_on_curve({ uint_type(point.my_x), uint_type(point.my_y) }, uint_type(curve_b()));
     }
 
     // LCOV_EXCL_START
@@ -512,101 +1258,27 @@ namespace example013_ecdsa
     {
       // Returns the result of (point1 + point2) according to the group law.
 
-      const auto& x1 = point1.my_x; const auto& y1 = point1.my_y;
-      const auto& x2 = point2.my_x; const auto& y2 = point2.my_y;
-
-      if((x1 == 0) && (y1 == 0))
-      {
-        // 0 + point2 = point2
-        return point_type(point2);
-      }
-
-      if((x2 == 0) && (y2 == 0))
-      {
-        // point1 + 0 = point1
-        return point_type(point1); // LCOV_EXCL_LINE
-      }
-
-      if((x1 == x2) && (y1 != y2))
-      {
-        // Equivalent to: point1 + (-point1) = 0
-        return point_type { }; // LCOV_EXCL_LINE
-      }
+      const auto& engine = curve_engine();
 
-      // Differentiate the cases (point1 == point2) and (point1 != point2).
-
-      const auto m =
-        quadruple_sint_type
-        (
-          (x1 == x2)
-            ? (quadruple_sint_type(x1) * quadruple_sint_type(x1) * 3 + quadruple_sint_type(curve_a())) * quadruple_sint_type(inverse_mod(y1 * 2, curve_p()))
-            : quadruple_sint_type(y1 - y2) * quadruple_sint_type(inverse_mod(x1 - x2, curve_p()))
-        );
-
-      const auto x3 =
-        duodectuple_sint_type
-        (
-          duodectuple_sint_type(m) * duodectuple_sint_type(m) - duodectuple_sint_type(x1 + x2)
-        );
-
-      auto y3 =
-        duodectuple_sint_type
-        (
-          duodectuple_sint_type(y1) + duodectuple_sint_type(m) * (x3 - duodectuple_sint_type(x1))
-        );
-
-      // Negate y3 for the modulus operation below.
-      y3.negate();
-
-      return
-      point_type
-      (
-        double_sint_type(divmod(x3, duodectuple_sint_type(curve_p())).second),
-        double_sint_type(divmod(y3, duodectuple_sint_type(curve_p())).second)
-      );
+      return to_point(engine.to_affine(engine.point_add(to_jacobian(point1), to_jacobian(point2))));
     }
 
-    static auto scalar_mult(const double_sint_type& k, const point_type& point) -> point_type // NOLINT(misc-no-recursion)
+    static auto scalar_mult(const double_sint_type& k, const point_type& point) -> point_type
     {
-      // Returns k * point computed using the double and point_add algorithm.
+      // Returns k * point computed in Jacobian coordinates
+      // with the wNAF method of the curve engine.
 
-      if(((k % curve_n()) == 0) || ((point.my_x == 0) && (point.my_y == 0)))
-      {
-        return point_type { }; // LCOV_EXCL_LINE
-      }
+      auto k_mod_n = k % curve_n();
 
-      if(k < 0)
+      if(k_mod_n < 0)
       {
-        // k * point = -k * (-point)
-        return scalar_mult(-k, point_neg(point)); // LCOV_EXCL_LINE
+        // k * point = (k + n) * point
+        k_mod_n += curve_n(); // LCOV_EXCL_LINE
       }
 
-      point_type result { };
-      point_type addend = point;
-
-      double_sint_type k_val(k);
+      const auto& engine = curve_engine();
 
-      while(k_val != 0) // NOLINT(altera-id-dependent-backward-branch)
-      {
-        const auto lo_bit =
-          static_cast<unsigned>
-          (
-            static_cast<unsigned>(k_val) & static_cast<unsigned>(UINT8_C(1))
-          );
-
-        if(lo_bit != static_cast<unsigned>(UINT8_C(0)))
-        {
-          // Add.
-          result = point_add(result, addend);
-        }
-
-        // Double.
-        addend = point_add(addend, addend);
-
-        k_val >>= static_cast<unsigned>(UINT8_C(1));
-      }
-
-      return result;
+      return to_point(engine.to_affine(engine.scalar_mult(uint_type(k_mod_n), to_jacobian(point))));
     }
 
     template<typename UnknownWideUintType>
@@ -652,15 +1324,12 @@ namespace example013_ecdsa
             : *p_uint_seed
         );
 
-      const auto public_key  = scalar_mult(private_key, point_type(curve_gx(), curve_gy()));
+      const auto public_key  = generator_mult_ct(private_key);
 
       return
       {
         private_key,
-        {
-          uint_type { public_key.my_x },
-          uint_type { public_key.my_y }
-        }
+        public_key
       };
     }
 
@@ -720,15 +1389,19 @@ namespace example013_ecdsa
 
         const double_sint_type k { uk };
 
-        const point_type pt(scalar_mult(k, point_type(curve_gx(), curve_gy())));
+        // The point k * G and the inverse of k are found in constant
+        // time with respect to the nonce k. The rest of the arithmetic
+        // modulo n (the reductions with divmod) is not constant-time,
+        // so this signing is not hardened against timing attacks.
+        const auto pt = generator_mult_ct(uint_type(divmod(k, curve_n()).second));
 
-        r = divmod(pt.my_x, curve_n()).second;
+        r = divmod(double_sint_type(pt.first), curve_n()).second;
 
         const sexatuple_sint_type
           num
           {
              (sexatuple_sint_type(z) + (sexatuple_sint_type(r) * pk))
-            * sexatuple_sint_type(inverse_mod(k, curve_n()))
+            * sexatuple_sint_type(inverse_mod_ct(divmod(k, curve_n()).second, curve_n()))
           };
 
         s = double_sint_type { divmod(num, n).second };
@@ -753,19 +1426,25 @@ namespace example013_ecdsa
 
       const auto z = hash_message(msg_first, msg_last);
 
-      const double_sint_type u1(divmod(sexatuple_sint_type(z)         * w, n).second);
-      const double_sint_type u2(divmod(sexatuple_sint_type(sig.first) * w, n).second);
+      const uint_type u1(divmod(sexatuple_sint_type(z)         * w, n).second);
+      const uint_type u2(divmod(sexatuple_sint_type(sig.first) * w, n).second);
+
+      // Sum up u1 * G + u2 * pub in Jacobian coordinates,
+      // and convert only the final result to affine.
+
+      const auto& engine = curve_engine();
+
+      const std::array<std::pair<uint_type, typename engine_type::jacobian_point_type>, 2U> terms { { { u1, to_jacobian(point_type(curve_gx(), curve_gy())) }, { u2, engine.from_affine(pub) } } };
 
       const auto pt =
-        point_add
+        engine.to_affine
         (
-          scalar_mult(u1,point_type(curve_gx(), curve_gy())),
-          scalar_mult(u2,point_type(pub.first,  pub.second))
+          engine.multi_scalar_mult(terms.cbegin(), terms.cend())
         );
 
       return
       (
-        divmod(double_sint_type(sig.first), curve_n()).second == divmod(pt.my_x, curve_n()).second
+        divmod(double_sint_type(sig.first), curve_n()).second == double_sint_type(pt.first % uint_type(curve_n()))
       );
     }
   };
@@ -850,7 +1529,7 @@ auto ::math::wide_integer::example013_ecdsa_sign_verify() -> bool
     // Test ECC key generation, sign and verify. In this case we use random (but pre-defined seeds
     // for both keygen as well as signing.
 
-    const auto seed_keygen = elliptic_curve_type::uint_type("0xC6455BF2F380F6B81F5FD1A1DBC2392B3783ED1E7D91B62942706E5584BA0B92");
+    constexpr auto seed_keygen = elliptic_curve_type::uint_type("0xC6455BF2F380F6B81F5FD1A1DBC2392B3783ED1E7D91B62942706E5584BA0B92");
 
     const auto keypair = elliptic_curve_type::make_keypair(&seed_keygen);
 
@@ -879,7 +1558,7 @@ auto ::math::wide_integer::example013_ecdsa_sign_verify() -> bool
 
     result_is_ok = (result_is_on_curve_is_ok && result_keygen_is_ok && result_is_ok);
 
-    const auto priv = elliptic_curve_type::uint_type("0x6F73D8E95D6DDBF0EB352A9F0B2CE91931511EDAF9AC8F128D5A4F877C4F0450");
+    constexpr auto priv = elliptic_curve_type::uint_type("0x6F73D8E95D6DDBF0EB352A9F0B2CE91931511EDAF9AC8F128D5A4F877C4F0450");
 
     const auto sig =
       elliptic_curve_type::sign_message(std::get<0>(keypair), msg_as_string.cbegin(), msg_as_string.cend(), &priv);
@@ -957,6 +1636,87 @@ auto ::math::wide_integer::example013_ecdsa_sign_verify() -> bool
     result_is_ok = (result_verify_expected_fail_is_ok && result_is_ok);
   }
 
+  {
+    // Check the constant-time multiples of G (using the complete addition
+    // for a = 0) against those from the table's pow(), including k = 0.
+
+    using uint_type = typename elliptic_curve_type::uint_type;
+
+    const auto n = uint_type(elliptic_curve_type::curve_n());
+
+    const std::array<uint_type, 5U> ks
+    {
+      uint_type { },
+      uint_type { static_cast<unsigned>(UINT8_C(1)) },
+      n - static_cast<unsigned>(UINT8_C(1)),
+      elliptic_curve_type::get_pseudo_random_uint<uint_type>(uint_type { static_cast<unsigned>(UINT8_C(1)) }, n),
+      elliptic_curve_type::get_pseudo_random_uint<uint_type>(uint_type { static_cast<unsigned>(UINT8_C(1)) }, n)
+    };
+
+    for(const auto& k : ks)
+    {
+      const auto pt_ct = elliptic_curve_type::generator_mult_ct(k);
+      const auto pt    = elliptic_curve_type::curve_engine().to_affine(elliptic_curve_type::generator_mult(k));
+
+      result_is_ok = ((pt_ct == pt) && result_is_ok);
+    }
+  }
+
+  {
+    // Exercise the a = -3 formulas of the curve engine on NIST P-256.
+    // Check that n * G is the point at infinity and (n - 1) * G = -G.
+
+    using engine_type = typename elliptic_curve_type::engine_type;
+    using uint_type   = typename engine_type::uint_type;
+
+    constexpr auto p256_p = uint_type("0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF");
+    constexpr auto p256_n = uint_type("0xFFFFFFFF00000000FFFFFFFFFFFFFFFFBCE6FAADA7179E84F3B9CAC2FC632551");
+
+    const auto p256_g =
+      typename engine_type::affine_point_type
+      {
+        uint_type("0x6B17D1F2E12C4247F8BCE6E563A440F277037D812DEB33A0F4A13945D898C296"),
+        uint_type("0x4FE342E2FE1A7F9B8EE7EB4A7C0F9E162BCE33576B315ECECBB6406837BF51F5")
+      };
+
+    constexpr auto p256_b = uint_type("0x5AC635D8AA3A93E7B3EBBD55769886BC651D06B0CC53B0F63BCE3C3E27D2604B");
+
+    const engine_type engine(p256_p, p256_p - static_cast<unsigned>(UINT8_C(3)), p256_b);
+
+    const auto g = engine.from_affine(p256_g);
+
+    const auto result_n_g_is_ok = engine_type::is_infinity(engine.scalar_mult(p256_n, g));
+
+    const auto minus_g = engine.to_affine(engine.scalar_mult(p256_n - static_cast<unsigned>(UINT8_C(1)), g));
+
+    const auto result_minus_g_is_ok =
+    (
+         (minus_g.first  == p256_g.first)
+      && (minus_g.second == (p256_p - p256_g.second))
+    );
+
+    result_is_ok = (result_n_g_is_ok && result_minus_g_is_ok && result_is_ok);
+
+    // Exercise the complete addition for generic a with a table
+    // of 2-bit windows. The table is too large for the stack.
+
+    using table_type = typename engine_type::template fixed_base_table_type<static_cast<unsigned>(UINT16_C(256)), static_cast<unsigned>(UINT8_C(2))>;
+
+    auto p_table = std::make_unique<table_type>(g, typename engine_type::jacobian_point_type { }, engine.group_policy());
+
+    engine.normalize(p_table->begin(), p_table->end());
+
+    const auto k = elliptic_curve_type::get_pseudo_random_uint<uint_type>();
+
+    const auto result_ct_is_ok =
+    (
+         (engine.fixed_base_mult_ct(*p_table, p256_n - static_cast<unsigned>(UINT8_C(1))) == minus_g)
+      && (engine.fixed_base_mult_ct(*p_table, k) == engine.to_affine(engine.scalar_mult(k, g)))
+    );
+
+    result_is_ok = (result_ct_is_ok && result_is_ok);
+  }
+
   return result_is_ok;
 }
 
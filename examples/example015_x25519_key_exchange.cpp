@@ -0,0 +1,834 @@
+///////////////////////////////////////////////////////////////////
+//  Copyright Christopher Kormanyos 2026.                        //
+//  Distributed under the Boost Software License,                //
+//  Version 1.0. (See accompanying file LICENSE_1_0.txt          //
+//  or copy at http://www.boost.org/LICENSE_1_0.txt)             //
+///////////////////////////////////////////////////////////////////
+
+// For algorithm description of X25519 (the Montgomery ladder on
+// Curve25519), the test vectors and the Diffie-Hellman exchange,
+//   see also: https://www.rfc-editor.org/rfc/rfc7748
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <vector>
+
+#include <examples/example_uintwide_t.h>
+#include <math/wide_integer/uintwide_t.h>
+#include <test/stopwatch.h>
+
+namespace example015_x25519
+{
+  // The field elements are 256-bit integers. Their limbs are 64 bits
+  // wide when WIDE_INTEGER_HAS_LIMB_TYPE_UINT64 is defined.
+
+  #if defined(WIDE_INTEGER_NAMESPACE)
+  using limb_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uint_defaultlimb_t;
+  using uint_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(UINT16_C(256)), limb_type>;
+  #else
+  using limb_type = ::math::wide_integer::uint_defaultlimb_t;
+  using uint_type = ::math::wide_integer::uintwide_t<static_cast<::math::wide_integer::size_t>(UINT16_C(256)), limb_type>;
+  #endif
+
+  using double_limb_type = typename uint_type::double_limb_type;
+
+  using key_type = std::array<std::uint8_t, static_cast<std::size_t>(UINT8_C(32))>;
+
+  // Arithmetic modulo p = 2^255 - 19 on the limbs of uint_type.
+  // The elements are kept in the range [0, 2^256) and are only
+  // reduced to [0, p) when encoded. Since 2^256 = 38 (mod p), the
+  // upper half of a product is folded onto the lower half with
+  // a multiplication by 38. There is no division, and all loops,
+  // memory accesses and carries are independent of the values.
+  // The special_modulus of the library is not used here, since
+  // its final conditional subtraction branches on the value.
+
+  class field25519
+  {
+  public:
+    using size_type = typename uint_type::representation_type::size_type;
+
+    static constexpr auto limb_digits = static_cast<unsigned>(std::numeric_limits<limb_type>::digits);
+    static constexpr auto limb_count  = static_cast<size_type>(std::numeric_limits<uint_type>::digits / std::numeric_limits<limb_type>::digits);
+
+    static auto add(uint_type& r, const uint_type& a, const uint_type& b) -> void
+    {
+      auto carry = static_cast<limb_type>(UINT8_C(0));
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < limb_count; ++i)
+      {
+        const auto sum =
+          static_cast<double_limb_type>
+          (
+              static_cast<double_limb_type>(a.crepresentation()[i])
+            + static_cast<double_limb_type>(b.crepresentation()[i])
+            + carry
+          );
+
+        r.representation()[i] = static_cast<limb_type>(sum);
+
+        carry = static_cast<limb_type>(sum >> limb_digits);
+      }
+
+      fold_carry(r, static_cast<limb_type>(carry * static_cast<limb_type>(UINT8_C(38))));
+    }
+
+    static auto sub(uint_type& r, const uint_type& a, const uint_type& b) -> void
+    {
+      auto borrow = static_cast<limb_type>(UINT8_C(0));
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < limb_count; ++i)
+      {
+        const auto dif =
+          static_cast<double_limb_type>
+          (
+              static_cast<double_limb_type>(a.crepresentation()[i])
+            - static_cast<double_limb_type>(b.crepresentation()[i])
+            - borrow
+          );
+
+        r.representation()[i] = static_cast<limb_type>(dif);
+
+        borrow = static_cast<limb_type>(static_cast<limb_type>(dif >> limb_digits) & static_cast<limb_type>(UINT8_C(1)));
+      }
+
+      // A borrow out of the top limb means that 2^256 has been added,
+      // which is 38 too much modulo p. The second borrow can only occur
+      // when the result is near 2^256, so subtracting 38 more from the
+      // lowest limb does not borrow again.
+      borrow = static_cast<limb_type>(borrow * static_cast<limb_type>(UINT8_C(38)));
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < limb_count; ++i)
+      {
+        const auto dif =
+          static_cast<double_limb_type>
+          (
+              static_cast<double_limb_type>(r.crepresentation()[i])
+            - borrow
+          );
+
+        r.representation()[i] = static_cast<limb_type>(dif);
+
+        borrow = static_cast<limb_type>(static_cast<limb_type>(dif >> limb_digits) & static_cast<limb_type>(UINT8_C(1)));
+      }
+
+      r.representation()[0U] = static_cast<limb_type>(r.crepresentation()[0U] - static_cast<limb_type>(borrow * static_cast<limb_type>(UINT8_C(38))));
+    }
+
+    static auto mul(uint_type& r, const uint_type& a, const uint_type& b) -> void
+    {
+      std::array<limb_type, static_cast<size_type>(limb_count * 2U)> t { };
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < limb_count; ++i)
+      {
+        auto carry = static_cast<limb_type>(UINT8_C(0));
+
+        for(auto j = static_cast<size_type>(UINT8_C(0)); j < limb_count; ++j)
+        {
+          const auto prod =
+            static_cast<double_limb_type>
+            (
+                static_cast<double_limb_type>(static_cast<double_limb_type>(a.crepresentation()[i]) * b.crepresentation()[j])
+              + t[i + j]
+              + carry
+            );
+
+          t[i + j] = static_cast<limb_type>(prod);
+
+          carry = static_cast<limb_type>(prod >> limb_digits);
+        }
+
+        t[i + limb_count] = carry;
+      }
+
+      fold_product(r, t);
+    }
+
+    static auto sqr(uint_type& r, const uint_type& a) -> void
+    {
+      // The cross products a[i] * a[j] with i < j are accumulated once
+      // and doubled, and then the squares on the diagonal are added.
+
+      std::array<limb_type, static_cast<size_type>(limb_count * 2U)> t { };
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < limb_count; ++i)
+      {
+        auto carry = static_cast<limb_type>(UINT8_C(0));
+
+        for(auto j = static_cast<size_type>(i + 1U); j < limb_count; ++j)
+        {
+          const auto prod =
+            static_cast<double_limb_type>
+            (
+                static_cast<double_limb_type>(static_cast<double_limb_type>(a.crepresentation()[i]) * a.crepresentation()[j])
+              + t[i + j]
+              + carry
+            );
+
+          t[i + j] = static_cast<limb_type>(prod);
+
+          carry = static_cast<limb_type>(prod >> limb_digits);
+        }
+
+        t[i + limb_count] = carry;
+      }
+
+      auto carry = static_cast<limb_type>(UINT8_C(0));
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < static_cast<size_type>(limb_count * 2U); ++i)
+      {
+        const auto next = static_cast<limb_type>(t[i] >> (limb_digits - 1U));
+
+        t[i] = static_cast<limb_type>(static_cast<limb_type>(t[i] << 1U) | carry);
+
+        carry = next;
+      }
+
+      carry = static_cast<limb_type>(UINT8_C(0));
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < limb_count; ++i)
+      {
+        const auto sq = static_cast<double_limb_type>(static_cast<double_limb_type>(a.crepresentation()[i]) * a.crepresentation()[i]);
+
+        const auto lo =
+          static_cast<double_limb_type>
+          (
+              static_cast<double_limb_type>(t[2U * i])
+            + static_cast<limb_type>(sq)
+            + carry
+          );
+
+        t[2U * i] = static_cast<limb_type>(lo);
+
+        const auto hi =
+          static_cast<double_limb_type>
+          (
+              static_cast<double_limb_type>(t[(2U * i) + 1U])
+            + static_cast<limb_type>(sq >> limb_digits)
+            + static_cast<limb_type>(lo >> limb_digits)
+          );
+
+        t[(2U * i) + 1U] = static_cast<limb_type>(hi);
+
+        carry = static_cast<limb_type>(hi >> limb_digits);
+      }
+
+      fold_product(r, t);
+    }
+
+    static auto sqr_n(uint_type& r, const uint_type& a, const unsigned n) -> void
+    {
+      sqr(r, a);
+
+      for(auto i = static_cast<unsigned>(UINT8_C(1)); i < n; ++i)
+      {
+        sqr(r, r);
+      }
+    }
+
+    static auto mul_small(uint_type& r, const uint_type& a, const limb_type s) -> void
+    {
+      auto carry = static_cast<limb_type>(UINT8_C(0));
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < limb_count; ++i)
+      {
+        const auto prod =
+          static_cast<double_limb_type>
+          (
+              static_cast<double_limb_type>(static_cast<double_limb_type>(a.crepresentation()[i]) * s)
+            + carry
+          );
+
+        r.representation()[i] = static_cast<limb_type>(prod);
+
+        carry = static_cast<limb_type>(prod >> limb_digits);
+      }
+
+      fold_carry(r, static_cast<limb_type>(carry * static_cast<limb_type>(UINT8_C(38))));
+    }
+
+    static auto invert(uint_type& r, const uint_type& z) -> void
+    {
+      // Compute z^(p - 2) with the fixed addition chain of 254 squarings
+      // and 11 multiplications. The zero element is mapped onto zero.
+
+      uint_type z2        { };
+      uint_type z9        { };
+      uint_type z11       { };
+      uint_type z2_5_0    { };
+      uint_type z2_10_0   { };
+      uint_type z2_20_0   { };
+      uint_type z2_50_0   { };
+      uint_type z2_100_0  { };
+      uint_type t         { };
+
+      sqr(z2, z);                  // 2
+      sqr_n(t, z2, 2U);            // 8
+      mul(z9, t, z);               // 9
+      mul(z11, z9, z2);            // 11
+      sqr(t, z11);                 // 22
+      mul(z2_5_0, t, z9);          // 2^5 - 1
+      sqr_n(t, z2_5_0, 5U);
+      mul(z2_10_0, t, z2_5_0);     // 2^10 - 1
+      sqr_n(t, z2_10_0, 10U);
+      mul(z2_20_0, t, z2_10_0);    // 2^20 - 1
+      sqr_n(t, z2_20_0, 20U);
+      mul(t, t, z2_20_0);          // 2^40 - 1
+      sqr_n(t, t, 10U);
+      mul(z2_50_0, t, z2_10_0);    // 2^50 - 1
+      sqr_n(t, z2_50_0, 50U);
+      mul(z2_100_0, t, z2_50_0);   // 2^100 - 1
+      sqr_n(t, z2_100_0, 100U);
+      mul(t, t, z2_100_0);         // 2^200 - 1
+      sqr_n(t, t, 50U);
+      mul(t, t, z2_50_0);          // 2^250 - 1
+      sqr_n(t, t, 5U);
+      mul(r, t, z11);              // 2^255 - 21
+    }
+
+    static auto cswap(uint_type& a, uint_type& b, const limb_type swap) -> void
+    {
+      const auto mask = static_cast<limb_type>(static_cast<limb_type>(UINT8_C(0)) - swap);
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < limb_count; ++i)
+      {
+        const auto x = static_cast<limb_type>(mask & static_cast<limb_type>(a.crepresentation()[i] ^ b.crepresentation()[i]));
+
+        a.representation()[i] = static_cast<limb_type>(a.crepresentation()[i] ^ x);
+        b.representation()[i] = static_cast<limb_type>(b.crepresentation()[i] ^ x);
+      }
+    }
+
+    static auto canonical(uint_type& r) -> void
+    {
+      // Fold the top bit with 2^255 = 19 (mod p), which leaves r below
+      // 2^255 + 19. Then subtract p when r + 19 reaches 2^255.
+
+      const auto top = static_cast<limb_type>(r.crepresentation()[limb_count - 1U] >> (limb_digits - 1U));
+
+      r.representation()[limb_count - 1U] = static_cast<limb_type>(r.crepresentation()[limb_count - 1U] & static_cast<limb_type>((std::numeric_limits<limb_type>::max)() >> 1U));
+
+      fold_carry(r, static_cast<limb_type>(top * static_cast<limb_type>(UINT8_C(19))));
+
+      uint_type t { };
+
+      auto carry = static_cast<limb_type>(UINT8_C(19));
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < limb_count; ++i)
+      {
+        const auto sum = static_cast<double_limb_type>(static_cast<double_limb_type>(r.crepresentation()[i]) + carry);
+
+        t.representation()[i] = static_cast<limb_type>(sum);
+
+        carry = static_cast<limb_type>(sum >> limb_digits);
+      }
+
+      const auto ge_p = static_cast<limb_type>(t.crepresentation()[limb_count - 1U] >> (limb_digits - 1U));
+
+      t.representation()[limb_count - 1U] = static_cast<limb_type>(t.crepresentation()[limb_count - 1U] & static_cast<limb_type>((std::numeric_limits<limb_type>::max)() >> 1U));
+
+      cswap(r, t, ge_p);
+    }
+
+    static auto is_zero_mask(const uint_type& a) -> limb_type
+    {
+      // Return all ones if a = 0 (mod p), and zero otherwise.
+
+      uint_type c { a };
+
+      canonical(c);
+
+      auto acc = static_cast<limb_type>(UINT8_C(0));
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < limb_count; ++i)
+      {
+        acc = static_cast<limb_type>(acc | c.crepresentation()[i]);
+      }
+
+      const auto non_zero = static_cast<limb_type>(static_cast<limb_type>(acc | static_cast<limb_type>(static_cast<limb_type>(UINT8_C(0)) - acc)) >> (limb_digits - 1U));
+
+      return static_cast<limb_type>(non_zero - static_cast<limb_type>(UINT8_C(1)));
+    }
+
+  private:
+    static auto fold_carry(uint_type& r, limb_type c) -> void
+    {
+      // Add the small value c < 2^(limb_digits - 1) to r. A carry out of
+      // the top limb is 2^256 = 38 (mod p) and goes back to the lowest
+      // limb, which is then small enough for the sum not to carry again.
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < limb_count; ++i)
+      {
+        const auto sum = static_cast<double_limb_type>(static_cast<double_limb_type>(r.crepresentation()[i]) + c);
+
+        r.representation()[i] = static_cast<limb_type>(sum);
+
+        c = static_cast<limb_type>(sum >> limb_digits);
+      }
+
+      r.representation()[0U] = static_cast<limb_type>(r.crepresentation()[0U] + static_cast<limb_type>(c * static_cast<limb_type>(UINT8_C(38))));
+    }
+
+    static auto fold_product(uint_type& r, const std::array<limb_type, static_cast<size_type>(limb_count * 2U)>& t) -> void
+    {
+      auto carry = static_cast<limb_type>(UINT8_C(0));
+
+      for(auto i = static_cast<size_type>(UINT8_C(0)); i < limb_count; ++i)
+      {
+        const auto sum =
+          static_cast<double_limb_type>
+          (
+              static_cast<double_limb_type>(static_cast<double_limb_type>(t[i + limb_count]) * static_cast<limb_type>(UINT8_C(38)))
+            + t[i]
+            + carry
+          );
+
+        r.representation()[i] = static_cast<limb_type>(sum);
+
+        carry = static_cast<limb_type>(sum >> limb_digits);
+      }
+
+      fold_carry(r, static_cast<limb_type>(carry * static_cast<limb_type>(UINT8_C(38))));
+    }
+  };
+
+  auto decode_u(const key_type& u) -> uint_type
+  {
+    // Read the little-endian u-coordinate and mask its top bit.
+    // Non-canonical values in [p, 2^255) are accepted as they are.
+
+    uint_type x { };
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < u.size(); ++i)
+    {
+      auto byte = static_cast<limb_type>(u[i]);
+
+      if(i == static_cast<std::size_t>(u.size() - 1U))
+      {
+        byte = static_cast<limb_type>(byte & static_cast<limb_type>(UINT8_C(0x7F)));
+      }
+
+      const auto idx = static_cast<field25519::size_type>(i / sizeof(limb_type));
+      const auto shl = static_cast<unsigned>((i % sizeof(limb_type)) * 8U);
+
+      x.representation()[idx] = static_cast<limb_type>(x.crepresentation()[idx] | static_cast<limb_type>(byte << shl));
+    }
+
+    return x;
+  }
+
+  auto encode_u(uint_type x) -> key_type
+  {
+    field25519::canonical(x);
+
+    key_type u { };
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < u.size(); ++i)
+    {
+      const auto idx = static_cast<field25519::size_type>(i / sizeof(limb_type));
+      const auto shr = static_cast<unsigned>((i % sizeof(limb_type)) * 8U);
+
+      u[i] = static_cast<std::uint8_t>(x.crepresentation()[idx] >> shr);
+    }
+
+    return u;
+  }
+
+  auto clamp_scalar(key_type k) -> key_type
+  {
+    k.front() = static_cast<std::uint8_t>(k.front() & static_cast<std::uint8_t>(UINT8_C(248)));
+    k.back()  = static_cast<std::uint8_t>(k.back()  & static_cast<std::uint8_t>(UINT8_C(127)));
+    k.back()  = static_cast<std::uint8_t>(k.back()  | static_cast<std::uint8_t>(UINT8_C(64)));
+
+    return k;
+  }
+
+  auto ladder(const key_type& scalar, const uint_type& x1, uint_type& x2, uint_type& z2) -> void
+  {
+    // Run the Montgomery ladder of RFC 7748, Section 5, and leave the
+    // projective result x2 / z2. Every step performs the same field
+    // operations, and the scalar bits only enter the masked swaps.
+
+    const key_type k = clamp_scalar(scalar);
+
+    x2 = static_cast<unsigned>(UINT8_C(1));
+    z2 = static_cast<unsigned>(UINT8_C(0));
+
+    uint_type x3 { x1 };
+    uint_type z3 { static_cast<unsigned>(UINT8_C(1)) };
+
+    uint_type a  { }; uint_type aa { };
+    uint_type b  { }; uint_type bb { };
+    uint_type c  { }; uint_type d  { };
+    uint_type e  { }; uint_type da { }; uint_type cb { };
+
+    auto swap = static_cast<limb_type>(UINT8_C(0));
+
+    for(auto t = static_cast<int>(INT16_C(254)); t >= 0; --t)
+    {
+      const auto k_t =
+        static_cast<limb_type>
+        (
+          static_cast<limb_type>(k[static_cast<std::size_t>(t / 8)] >> static_cast<unsigned>(t % 8)) & static_cast<limb_type>(UINT8_C(1))
+        );
+
+      swap = static_cast<limb_type>(swap ^ k_t);
+
+      field25519::cswap(x2, x3, swap);
+      field25519::cswap(z2, z3, swap);
+
+      swap = k_t;
+
+      field25519::add(a, x2, z2);
+      field25519::sqr(aa, a);
+      field25519::sub(b, x2, z2);
+      field25519::sqr(bb, b);
+      field25519::sub(e, aa, bb);
+      field25519::add(c, x3, z3);
+      field25519::sub(d, x3, z3);
+      field25519::mul(da, d, a);
+      field25519::mul(cb, c, b);
+
+      field25519::add(x3, da, cb);
+      field25519::sqr(x3, x3);
+      field25519::sub(z3, da, cb);
+      field25519::sqr(z3, z3);
+      field25519::mul(z3, z3, x1);
+      field25519::mul(x2, aa, bb);
+      field25519::mul_small(z2, e, static_cast<limb_type>(UINT32_C(121665)));
+      field25519::add(z2, z2, aa);
+      field25519::mul(z2, z2, e);
+    }
+
+    field25519::cswap(x2, x3, swap);
+    field25519::cswap(z2, z3, swap);
+  }
+
+  auto base_point() -> const key_type&
+  {
+    static const key_type my_base_point { static_cast<std::uint8_t>(UINT8_C(9)) };
+
+    return my_base_point;
+  }
+
+  auto x25519(const key_type& scalar, const key_type& u) -> key_type
+  {
+    uint_type x2 { };
+    uint_type z2 { };
+
+    ladder(scalar, decode_u(u), x2, z2);
+
+    // For points of small order z2 is zero. Its inverse is then zero
+    // as well, and so is the result.
+    field25519::invert(z2, z2);
+    field25519::mul(x2, x2, z2);
+
+    return encode_u(x2);
+  }
+
+  auto x25519_base(const key_type& scalar) -> key_type
+  {
+    return x25519(scalar, base_point());
+  }
+
+  template<typename ScalarIteratorType,
+           typename UIteratorType,
+           typename OutputIteratorType>
+  auto x25519_batch(ScalarIteratorType first_scalar,
+                    ScalarIteratorType last_scalar,
+                    UIteratorType      first_u,
+                    OutputIteratorType first_out) -> void
+  {
+    // Evaluate x25519(scalar[i], u[i]) for a whole range. The ladders run
+    // one after the other, and their final inversions are shared. With
+    // Montgomery's trick, n inversions cost one inversion and 3(n - 1)
+    // multiplications, which removes nearly a tenth of the work per key.
+    // The zero elements from points of small order are replaced by one
+    // before entering the product and their results are masked to zero,
+    // all without branches.
+
+    const auto count = static_cast<std::size_t>(std::distance(first_scalar, last_scalar));
+
+    if(count == static_cast<std::size_t>(UINT8_C(0))) { return; }
+
+    std::vector<uint_type> x (count);
+    std::vector<uint_type> z (count);
+    std::vector<uint_type> zm(count);
+    std::vector<limb_type> is_zero(count);
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      ladder(*first_scalar++, decode_u(*first_u++), x[i], z[i]);
+
+      is_zero[i] = field25519::is_zero_mask(z[i]);
+
+      uint_type one { static_cast<unsigned>(UINT8_C(1)) };
+
+      field25519::cswap(z[i], one, static_cast<limb_type>(is_zero[i] & static_cast<limb_type>(UINT8_C(1))));
+
+      // The prefix products z[0] * ... * z[i].
+      zm[i] = z[i];
+
+      if(i != static_cast<std::size_t>(UINT8_C(0)))
+      {
+        field25519::mul(zm[i], zm[i - 1U], z[i]);
+      }
+    }
+
+    uint_type inv { };
+
+    field25519::invert(inv, zm.back());
+
+    for(auto i = static_cast<std::size_t>(count - 1U); i != static_cast<std::size_t>(UINT8_C(0)); --i)
+    {
+      uint_type zi_inv { };
+
+      field25519::mul(zi_inv, inv, zm[i - 1U]);
+      field25519::mul(inv, inv, z[i]);
+
+      z[i] = zi_inv;
+    }
+
+    z.front() = inv;
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < count; ++i)
+    {
+      field25519::mul(x[i], x[i], z[i]);
+
+      uint_type zero { };
+
+      field25519::cswap(x[i], zero, static_cast<limb_type>(is_zero[i] & static_cast<limb_type>(UINT8_C(1))));
+
+      *first_out++ = encode_u(x[i]);
+    }
+  }
+
+  auto key_from_hex(const char* str_hex) -> key_type
+  {
+    // Read 64 hexadecimal characters in the byte order of RFC 7748.
+
+    key_type k { };
+
+    const auto nibble =
+      [](const char c) -> std::uint8_t
+      {
+        return
+          static_cast<std::uint8_t>
+          (
+            ((c >= '0') && (c <= '9')) ? static_cast<std::uint8_t>(c - '0')
+                                       : static_cast<std::uint8_t>(static_cast<std::uint8_t>(c - 'a') + static_cast<std::uint8_t>(UINT8_C(10)))
+          );
+      };
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < k.size(); ++i)
+    {
+      k[i] =
+        static_cast<std::uint8_t>
+        (
+            static_cast<std::uint8_t>(nibble(str_hex[(2U * i) + 0U]) << 4U) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          | nibble(str_hex[(2U * i) + 1U])                                    // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        );
+    }
+
+    return k;
+  }
+} // namespace example015_x25519
+
+#if defined(WIDE_INTEGER_NAMESPACE)
+auto WIDE_INTEGER_NAMESPACE::math::wide_integer::example015_x25519_key_exchange() -> bool
+#else
+auto ::math::wide_integer::example015_x25519_key_exchange() -> bool
+#endif
+{
+  using example015_x25519::key_type;
+  using example015_x25519::key_from_hex;
+  using example015_x25519::x25519;
+  using example015_x25519::x25519_base;
+  using example015_x25519::x25519_batch;
+
+  bool result_is_ok { true };
+
+  {
+    // The test vectors of RFC 7748, Section 5.2.
+
+    const auto r0 = x25519(key_from_hex("a546e36bf0527c9d3b16154b82465edd62144c0ac1fc5a18506a2244ba449ac4"),
+                           key_from_hex("e6db6867583030db3594c1a424b15f7c726624ec26b3353b10a903a6d0ab1c4c"));
+
+    const auto r1 = x25519(key_from_hex("4b66e9d4d1b4673c5ad22691957d6af5c11b6421e0ea01d42ca4169e7918ba0d"),
+                           key_from_hex("e5210f12786811d3f4b7959d0538ae2c31dbe7106fc03c3efc4cd549c715a493"));
+
+    const auto result_vectors_are_ok =
+    (
+         (r0 == key_from_hex("c3da55379de9c6908e94ea4df28d084f32eccf03491c71f754b4075577a28552"))
+      && (r1 == key_from_hex("95cbde9476e8907d7aade45cb4b873f88b595a68799fa152e6f8f7647aac7957"))
+    );
+
+    result_is_ok = (result_vectors_are_ok && result_is_ok);
+  }
+
+  {
+    // The iterated test of RFC 7748, Section 5.2, starting with k = u = 9.
+
+    key_type k { example015_x25519::base_point() };
+    key_type u { example015_x25519::base_point() };
+
+    for(auto i = static_cast<unsigned>(UINT8_C(1)); i <= static_cast<unsigned>(UINT16_C(1000)); ++i)
+    {
+      const key_type r = x25519(k, u);
+
+      u = k;
+      k = r;
+
+      if(i == static_cast<unsigned>(UINT8_C(1)))
+      {
+        result_is_ok = ((k == key_from_hex("422c8e7a6227d7bca1350b3e2bb7279f7897b87bb6854b783c60e80311ae3079")) && result_is_ok);
+      }
+    }
+
+    result_is_ok = ((k == key_from_hex("684cf59ba83309552800ef566f2f4d3c1c3887c49360e3875f2eb94d99532c51")) && result_is_ok);
+  }
+
+  {
+    // The Diffie-Hellman exchange of RFC 7748, Section 6.1.
+
+    const auto alice_private = key_from_hex("77076d0a7318a57d3c16c17251b26645df4c2f87ebc0992ab177fba51db92c2a");
+    const auto bob_private   = key_from_hex("5dab087e624a8a4b79e17f8b83800ee66f3bb1292618b6fd1c2f8b27ff88e0eb");
+
+    const auto alice_public = x25519_base(alice_private);
+    const auto bob_public   = x25519_base(bob_private);
+
+    const auto alice_shared = x25519(alice_private, bob_public);
+    const auto bob_shared   = x25519(bob_private, alice_public);
+
+    const auto result_exchange_is_ok =
+    (
+         (alice_public == key_from_hex("8520f0098930a754748b7ddcb43ef75a0dbf3a0d26381af4eba4a98eaa9b4e6a"))
+      && (bob_public   == key_from_hex("de9edb7d7b7dc1b4d35b61c2ece435373f8343c85b78674dadfc7e146f882b4f"))
+      && (alice_shared == key_from_hex("4a5d9d5ba4ce2de1728e3bf480350f25e07e21c947d19e3376f09b3c1e161742"))
+      && (bob_shared   == alice_shared)
+    );
+
+    result_is_ok = (result_exchange_is_ok && result_is_ok);
+  }
+
+  // Draw random scalars and u-coordinates. The points of small order
+  // u = 0 and u = 1 are mixed in, since they must give zero results
+  // without disturbing the shared inversion of the batch.
+
+  using random_engine_type = std::mt19937;
+
+  random_engine_type rng { static_cast<typename random_engine_type::result_type>(UINT32_C(0x15A4D0F3)) };
+
+  std::uniform_int_distribution<unsigned> dist { 0U, 255U };
+
+  constexpr auto batch_size = static_cast<std::size_t>(UINT8_C(32));
+
+  std::vector<key_type> scalars(batch_size);
+  std::vector<key_type> us     (batch_size);
+  std::vector<key_type> out    (batch_size);
+
+  for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < batch_size; ++i)
+  {
+    for(auto j = static_cast<std::size_t>(UINT8_C(0)); j < scalars[i].size(); ++j)
+    {
+      scalars[i][j] = static_cast<std::uint8_t>(dist(rng));
+      us[i][j]      = static_cast<std::uint8_t>(dist(rng));
+    }
+  }
+
+  us[3U]  = key_type { };
+  us[17U] = key_type { static_cast<std::uint8_t>(UINT8_C(1)) };
+
+  {
+    x25519_batch(scalars.cbegin(), scalars.cend(), us.cbegin(), out.begin());
+
+    bool result_batch_is_ok { (out[3U] == key_type { }) && (out[17U] == key_type { }) };
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < batch_size; ++i)
+    {
+      result_batch_is_ok = ((out[i] == x25519(scalars[i], us[i])) && result_batch_is_ok);
+    }
+
+    result_is_ok = (result_batch_is_ok && result_is_ok);
+  }
+
+  {
+    // Time single and batched evaluation for about half a second each.
+
+    using stopwatch_type = concurrency::stopwatch;
+
+    std::uint64_t count_single = 0U;
+    std::uint64_t count_batch  = 0U;
+
+    stopwatch_type my_stopwatch { };
+
+    while(stopwatch_type::elapsed_time<float>(my_stopwatch) < static_cast<float>(0.5L)) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    {
+      const auto index = static_cast<std::size_t>(count_single % batch_size);
+
+      out[index] = x25519(scalars[index], us[index]);
+
+      ++count_single;
+    }
+
+    const float ops_single = static_cast<float>(count_single) / stopwatch_type::elapsed_time<float>(my_stopwatch);
+
+    my_stopwatch.reset();
+
+    while(stopwatch_type::elapsed_time<float>(my_stopwatch) < static_cast<float>(0.5L)) // NOLINT(cppcoreguidelines-avoid-magic-numbers,readability-magic-numbers)
+    {
+      x25519_batch(scalars.cbegin(), scalars.cend(), us.cbegin(), out.begin());
+
+      count_batch += batch_size;
+    }
+
+    const float ops_batch = static_cast<float>(count_batch) / stopwatch_type::elapsed_time<float>(my_stopwatch);
+
+    {
+      const auto flg = std::cout.flags();
+
+      std::cout << "x25519 limb bits: "
+                << std::numeric_limits<example015_x25519::limb_type>::digits
+                << ", single ops_per_sec: "
+                << std::fixed
+                << std::setprecision(1)
+                << ops_single
+                << ", batch ops_per_sec: "
+                << ops_batch
+                << std::endl;
+
+      std::cout.flags(flg);
+    }
+
+    result_is_ok = ((ops_single > (std::numeric_limits<float>::min)()) && (ops_batch > (std::numeric_limits<float>::min)()) && result_is_ok);
+  }
+
+  return result_is_ok;
+}
+
+// Enable this if you would like to activate this main() as a standalone example.
+#if defined(WIDE_INTEGER_STANDALONE_EXAMPLE015_X25519_KEY_EXCHANGE)
+
+#include <iomanip>
+#include <iostream>
+
+auto main() -> int
+{
+  #if defined(WIDE_INTEGER_NAMESPACE)
+  const auto result_is_ok = WIDE_INTEGER_NAMESPACE::math::wide_integer::example015_x25519_key_exchange();
+  #else
+  const auto result_is_ok = ::math::wide_integer::example015_x25519_key_exchange();
+  #endif
+
+  std::cout << "result_is_ok: " << std::boolalpha << result_is_ok << std::endl;
+
+  return (result_is_ok ? 0 : -1);
+}
+
+#endif
@@ -30,6 +30,7 @@
   auto example004_rootk_pow                () -> bool;
   auto example005_powm                     () -> bool;
   auto example005a_pow_factors_of_p99      () -> bool;
+  auto example005b_powm_ct_timing          () -> bool;
   auto example006_gcd                      () -> bool;
   auto example007_random_generator         () -> bool;
   auto example008_miller_rabin_prime       () -> bool;
@@ -38,11 +39,14 @@
   auto example009_timed_mul                () -> bool;
   auto example009a_timed_mul_4_by_4        () -> bool;
   auto example009b_timed_mul_8_by_8        () -> bool;
+  auto example009c_timed_mul_calibrate     () -> bool;
+  auto example009d_timed_sqr               () -> bool;
   auto example010_uint48_t                 () -> bool;
   auto example011_uint24_t                 () -> bool;
   auto example012_rsa_crypto               () -> bool;
   auto example013_ecdsa_sign_verify        () -> bool;
   auto example014_pi_spigot_wide           () -> bool;
+  auto example015_x25519_key_exchange      () -> bool;
 
   #if(__cplusplus >= 201703L)
   } // namespace math::wide_integer
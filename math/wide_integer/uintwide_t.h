@@ -1193,6 +1193,241 @@
     }
   }
 
+  constexpr auto exponent_window_bits_limit = static_cast<std::uint_fast8_t>(UINT8_C(6));
+
+  constexpr auto exponent_window_bits_for(const unsigned_fast_type exponent_bit_count) -> std::uint_fast8_t
+  {
+    // Select the window width of sliding-window exponentiation for
+    // an exponent having the given number of bits. This balances the
+    // size of the table of odd powers against the saved multiplications.
+    return
+      static_cast<std::uint_fast8_t>
+      (
+          (exponent_bit_count <= static_cast<unsigned_fast_type>(UINT8_C(  6))) ? UINT8_C(1)
+        : (exponent_bit_count <= static_cast<unsigned_fast_type>(UINT8_C( 24))) ? UINT8_C(2)
+        : (exponent_bit_count <= static_cast<unsigned_fast_type>(UINT8_C( 80))) ? UINT8_C(3)
+        : (exponent_bit_count <= static_cast<unsigned_fast_type>(UINT8_C(240))) ? UINT8_C(4)
+        : (exponent_bit_count <= static_cast<unsigned_fast_type>(UINT16_C(672))) ? UINT8_C(5)
+        : exponent_window_bits_limit
+      );
+  }
+
+  // Arithmetic in the prime field of Prime having the primitive root
+  // Root, together with its radix-2 number-theoretic transform (NTT).
+  // The primes used are below 2^30, so all products fit in 64 bits.
+  template<const std::uint32_t Prime,
+           const std::uint32_t Root>
+  struct ntt_field
+  {
+    static constexpr auto prime() noexcept -> std::uint32_t { return Prime; }
+
+    static constexpr auto mul(const std::uint32_t a, const std::uint32_t b) noexcept -> std::uint32_t
+    {
+      return static_cast<std::uint32_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(a) * b) % Prime);
+    }
+
+    static constexpr auto add(const std::uint32_t a, const std::uint32_t b) noexcept -> std::uint32_t
+    {
+      const auto s = static_cast<std::uint32_t>(a + b);
+
+      return ((s >= Prime) ? static_cast<std::uint32_t>(s - Prime) : s);
+    }
+
+    static constexpr auto sub(const std::uint32_t a, const std::uint32_t b) noexcept -> std::uint32_t
+    {
+      return ((a >= b) ? static_cast<std::uint32_t>(a - b) : static_cast<std::uint32_t>(static_cast<std::uint32_t>(a + Prime) - b));
+    }
+
+    static constexpr auto pow(std::uint32_t b, std::uint32_t p) noexcept -> std::uint32_t
+    {
+      auto result = static_cast<std::uint32_t>(UINT8_C(1));
+
+      while(p != static_cast<std::uint32_t>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        if(static_cast<std::uint32_t>(p & static_cast<std::uint32_t>(UINT8_C(1))) != static_cast<std::uint32_t>(UINT8_C(0)))
+        {
+          result = mul(result, b);
+        }
+
+        b = mul(b, b);
+
+        p >>= 1U;
+      }
+
+      return result;
+    }
+
+    static constexpr auto inv(const std::uint32_t a) noexcept -> std::uint32_t
+    {
+      return pow(a, static_cast<std::uint32_t>(Prime - static_cast<std::uint32_t>(UINT8_C(2))));
+    }
+
+    static constexpr auto shoup(const std::uint32_t w) noexcept -> std::uint32_t
+    {
+      // The precomputed quotient floor(w * 2^32 / Prime) of Shoup's
+      // modular multiplication by the fixed factor w.
+      return static_cast<std::uint32_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(w) << 32U) / Prime);
+    }
+
+    static constexpr auto mul_shoup(const std::uint32_t a, const std::uint32_t w, const std::uint32_t w_shoup) noexcept -> std::uint32_t
+    {
+      // Calculate a * w mod Prime without division. The estimated
+      // quotient is off by at most one, so r is below 2 * Prime.
+      const auto q = static_cast<std::uint32_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(a) * w_shoup) >> 32U);
+
+      const auto r = static_cast<std::uint32_t>(static_cast<std::uint32_t>(a * w) - static_cast<std::uint32_t>(q * Prime));
+
+      return ((r >= Prime) ? static_cast<std::uint32_t>(r - Prime) : r);
+    }
+
+    template<typename IteratorType>
+    static constexpr auto make_twiddles(IteratorType tw, const unsigned_fast_type n) -> void
+    {
+      // Store the powers w^j (for j < n/2) of the primitive n-th root
+      // of unity w in tw, followed by their Shoup quotients.
+      using local_difference_type = typename iterator_detail::iterator_traits<IteratorType>::difference_type;
+
+      const auto half = static_cast<unsigned_fast_type>(n >> 1U);
+
+      const auto w = pow(Root, static_cast<std::uint32_t>(static_cast<std::uint32_t>(Prime - 1U) / static_cast<std::uint32_t>(n)));
+
+      auto wj = static_cast<std::uint32_t>(UINT8_C(1));
+
+      for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < half; ++j)
+      {
+        tw[static_cast<local_difference_type>(j)]        = wj;
+        tw[static_cast<local_difference_type>(j + half)] = shoup(wj);
+
+        wj = mul(wj, w);
+      }
+    }
+
+    template<typename IteratorType,
+             typename TwiddleIteratorType>
+    static constexpr auto transform(IteratorType a, const unsigned_fast_type n, TwiddleIteratorType tw, const bool is_inverse) -> void
+    {
+      // Transform the n values in a in place, where n is a power of 2
+      // that divides Prime - 1 and tw holds the twiddles of make_twiddles.
+      // This is the iterative Cooley-Tukey NTT with the bit-reversal
+      // permutation done up front. The inverse transform is the forward
+      // transform followed by reversing a[1 .. n) and dividing by n.
+      using local_difference_type = typename iterator_detail::iterator_traits<IteratorType>::difference_type;
+      using local_twiddle_difference_type = typename iterator_detail::iterator_traits<TwiddleIteratorType>::difference_type;
+
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(1)), j = static_cast<unsigned_fast_type>(UINT8_C(0)); i < n; ++i)
+      {
+        auto bit = static_cast<unsigned_fast_type>(n >> 1U);
+
+        for( ; static_cast<unsigned_fast_type>(j & bit) != static_cast<unsigned_fast_type>(UINT8_C(0)); bit >>= 1U) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          j = static_cast<unsigned_fast_type>(j ^ bit);
+        }
+
+        j = static_cast<unsigned_fast_type>(j ^ bit);
+
+        if(i < j)
+        {
+          const auto tmp = a[static_cast<local_difference_type>(i)];
+
+          a[static_cast<local_difference_type>(i)] = a[static_cast<local_difference_type>(j)];
+          a[static_cast<local_difference_type>(j)] = tmp;
+        }
+      }
+
+      const auto n_half = static_cast<unsigned_fast_type>(n >> 1U);
+
+      for(auto len = static_cast<unsigned_fast_type>(UINT8_C(2)); len <= n; len <<= 1U)
+      {
+        const auto half   = static_cast<unsigned_fast_type>(len >> 1U);
+        const auto stride = static_cast<unsigned_fast_type>(n / len);
+
+        for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < n; i += len)
+        {
+          for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < half; ++j)
+          {
+            const auto k = static_cast<unsigned_fast_type>(j * stride);
+
+            const auto u = a[static_cast<local_difference_type>(i + j)];
+            const auto v = mul_shoup(a[static_cast<local_difference_type>(i + j + half)],
+                                     tw[static_cast<local_twiddle_difference_type>(k)],
+                                     tw[static_cast<local_twiddle_difference_type>(k + n_half)]);
+
+            a[static_cast<local_difference_type>(i + j)]        = add(u, v);
+            a[static_cast<local_difference_type>(i + j + half)] = sub(u, v);
+          }
+        }
+      }
+
+      if(is_inverse)
+      {
+        for(auto i = static_cast<unsigned_fast_type>(UINT8_C(1)), j = static_cast<unsigned_fast_type>(n - 1U); i < j; ++i, --j)
+        {
+          const auto tmp = a[static_cast<local_difference_type>(i)];
+
+          a[static_cast<local_difference_type>(i)] = a[static_cast<local_difference_type>(j)];
+          a[static_cast<local_difference_type>(j)] = tmp;
+        }
+
+        const auto n_inv       = inv(static_cast<std::uint32_t>(n));
+        const auto n_inv_shoup = shoup(n_inv);
+
+        for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < n; ++i)
+        {
+          a[static_cast<local_difference_type>(i)] = mul_shoup(a[static_cast<local_difference_type>(i)], n_inv, n_inv_shoup);
+        }
+      }
+    }
+  };
+
+  // The three NTT primes c * 2^k + 1, each having the primitive root 3.
+  // Their product exceeds 2^85, so the coefficients of the convolution
+  // of up to 2^21 digits of 32 bits can be recovered with the CRT.
+  using ntt_field_0 = ntt_field<static_cast<std::uint32_t>(UINT32_C(998244353)), static_cast<std::uint32_t>(UINT8_C(3))>; // 119 * 2^23 + 1
+  using ntt_field_1 = ntt_field<static_cast<std::uint32_t>(UINT32_C(167772161)), static_cast<std::uint32_t>(UINT8_C(3))>; //   5 * 2^25 + 1
+  using ntt_field_2 = ntt_field<static_cast<std::uint32_t>(UINT32_C(469762049)), static_cast<std::uint32_t>(UINT8_C(3))>; //   7 * 2^26 + 1
+
+  constexpr auto ntt_max_digits = static_cast<unsigned_fast_type>(UINT32_C(0x200000));
+
+  // The twiddles (see make_twiddles) of FieldType for the transform
+  // size TransformSize. These are computed once, on first use, and are
+  // then shared by all of the NTT multiplications of this size.
+  template<typename FieldType,
+           const unsigned_fast_type TransformSize>
+  class ntt_twiddle_table final
+  {
+  public:
+    static auto values() -> const std::uint32_t*
+    {
+      static const ntt_twiddle_table my_table { };
+
+      return my_table.my_twiddles.data();
+    }
+
+  private:
+    using twiddles_array_type = array_detail::array<std::uint32_t, static_cast<std::size_t>(TransformSize)>;
+
+    twiddles_array_type my_twiddles { };
+
+    ntt_twiddle_table()
+    {
+      FieldType::make_twiddles(my_twiddles.begin(), TransformSize);
+    }
+  };
+
+  constexpr auto ntt_transform_size(const unsigned_fast_type digit_count) -> unsigned_fast_type
+  {
+    // The smallest power of 2 holding all 2 * digit_count - 1
+    // coefficients of the (non-wrapping) convolution.
+    unsigned_fast_type n { static_cast<unsigned_fast_type>(UINT8_C(1)) };
+
+    while(n < static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(digit_count * 2U) - 1U)) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      n <<= 1U;
+    }
+
+    return n;
+  }
+
   } // namespace detail
 
   using detail::size_t;
@@ -1208,6 +1443,58 @@
            const bool IsSigned = false>
   class uintwide_t;
 
+  #if !defined(WIDE_INTEGER_KARATSUBA_THRESHOLD)
+  #define WIDE_INTEGER_KARATSUBA_THRESHOLD 128 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  #if !defined(WIDE_INTEGER_SCHOOLBOOK_FALLBACK)
+  #define WIDE_INTEGER_SCHOOLBOOK_FALLBACK 24 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  #if !defined(WIDE_INTEGER_TOOM3_THRESHOLD)
+  #define WIDE_INTEGER_TOOM3_THRESHOLD 256 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  #if !defined(WIDE_INTEGER_NTT_THRESHOLD)
+  #define WIDE_INTEGER_NTT_THRESHOLD 8192 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  #if !defined(WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD)
+  #define WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD 512 // NOLINT(cppcoreguidelines-macro-usage)
+  #endif
+
+  // The multiplication traits hold the limb counts at which uintwide_t
+  // switches multiplication algorithms. Products having at least
+  // number_of_limbs_karatsuba_threshold limbs use Karatsuba multiplication,
+  // which recurses down to schoolbook multiplication for pieces having
+  // number_of_limbs_schoolbook_fallback limbs or fewer. Pieces having
+  // at least number_of_limbs_toom3_threshold limbs are split three ways
+  // with Toom-3 multiplication before Karatsuba takes over. Products
+  // having at least number_of_limbs_ntt_threshold limbs use number-
+  // theoretic transforms instead. Divisions in which both the divisor
+  // and the quotient have at least number_of_limbs_burnikel_ziegler_threshold
+  // limbs use recursive division, which builds on these multiplications.
+  // The defaults can be set for all types with the macros above, such as
+  // in the header written by example009c_timed_mul_calibrate.cpp, which
+  // measures the crossover on the host. A (partial) specialization of
+  // multiplication_traits tunes individual types. It can derive from
+  // multiplication_traits_default and then declare only the members
+  // that differ from the defaults.
+  struct multiplication_traits_default
+  {
+    static constexpr size_t number_of_limbs_karatsuba_threshold { static_cast<size_t>(WIDE_INTEGER_KARATSUBA_THRESHOLD) };
+    static constexpr size_t number_of_limbs_schoolbook_fallback { static_cast<size_t>(WIDE_INTEGER_SCHOOLBOOK_FALLBACK) };
+    static constexpr size_t number_of_limbs_toom3_threshold     { static_cast<size_t>(WIDE_INTEGER_TOOM3_THRESHOLD) };
+    static constexpr size_t number_of_limbs_ntt_threshold       { static_cast<size_t>(WIDE_INTEGER_NTT_THRESHOLD) };
+    static constexpr size_t number_of_limbs_burnikel_ziegler_threshold { static_cast<size_t>(WIDE_INTEGER_BURNIKEL_ZIEGLER_THRESHOLD) };
+  };
+
+  template<const size_t Width2,
+           typename LimbType = uint_defaultlimb_t,
+           typename AllocatorType = void,
+           const bool IsSigned = false>
+  struct multiplication_traits : public multiplication_traits_default { };
+
   // Forward declarations of non-member binary add, sub, mul, div, mod of (uintwide_t op uintwide_t).
   template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator+(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
   template<const size_t Width2, typename LimbType, typename AllocatorType, const bool IsSigned> constexpr auto operator-(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u, const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& v) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
@@ -1371,6 +1658,12 @@
            const bool IsSigned>
   constexpr auto abs(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
 
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto square(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
   template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
@@ -1394,7 +1687,7 @@
            typename LimbType,
            typename AllocatorType,
            const bool IsSigned>
-  constexpr auto pow(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b, const OtherIntegralTypeP& p) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+  constexpr auto pow(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b, const OtherIntegralTypeP& p, const std::uint_fast8_t window_bits = static_cast<std::uint_fast8_t>(UINT8_C(0))) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>; // NOLINT(readability-avoid-const-params-in-decls)
 
   template<typename OtherIntegralTypeP,
            typename OtherIntegralTypeM,
@@ -1404,7 +1697,34 @@
            const bool IsSigned>
   constexpr auto powm(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b,
                       const OtherIntegralTypeP& p,
-                      const OtherIntegralTypeM& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+                      const OtherIntegralTypeM& m,
+                      const std::uint_fast8_t   window_bits = static_cast<std::uint_fast8_t>(UINT8_C(0))) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>; // NOLINT(readability-avoid-const-params-in-decls)
+
+  template<typename OtherIntegralTypeP,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto powm_ct(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b,
+                         const OtherIntegralTypeP& p,
+                         const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+  template<typename InputIterator,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto multi_powm(InputIterator first,
+                            InputIterator last,
+                            const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+  template<typename OtherIntegralTypeP,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto multi_powm(std::initializer_list<std::pair<uintwide_t<Width2, LimbType, AllocatorType, IsSigned>, OtherIntegralTypeP>> terms,
+                            const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
 
   template<const size_t Width2,
            typename LimbType,
@@ -1428,6 +1748,65 @@
   constexpr auto lcm(const UnsignedShortType& a, const UnsignedShortType& b) -> std::enable_if_t<(   std::is_integral<UnsignedShortType>::value
                                                                                                   && std::is_unsigned<UnsignedShortType>::value), UnsignedShortType>;
 
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  struct extended_gcd_result
+  {
+    // The result of extended_gcd(a, b): the non-negative GCD g and
+    // the signed Bezout coefficients s and t having s * a + t * b = g.
+
+    uintwide_t<Width2, LimbType, AllocatorType, IsSigned> g; // NOLINT(misc-non-private-member-variables-in-classes)
+    uintwide_t<Width2, LimbType, AllocatorType, true>     s; // NOLINT(misc-non-private-member-variables-in-classes)
+    uintwide_t<Width2, LimbType, AllocatorType, true>     t; // NOLINT(misc-non-private-member-variables-in-classes)
+  };
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto extended_gcd(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                              const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> extended_gcd_result<Width2, LimbType, AllocatorType, IsSigned>;
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto invmod(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                        const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto invmod_ct(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                           const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+  template<typename InputIterator,
+           typename OutputIterator,
+           typename ScratchIterator,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto batch_invmod(InputIterator                                                first,
+                              InputIterator                                                last,
+                              const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m,
+                              OutputIterator                                               out,
+                              ScratchIterator                                              scratch) -> bool;
+
+  template<typename InputIterator,
+           typename OutputIterator,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto batch_invmod(InputIterator                                                first,
+                              InputIterator                                                last,
+                              const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m,
+                              OutputIterator                                               out) -> bool;
+
   template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
@@ -1444,6 +1823,64 @@
   constexpr auto divmod(const uintwide_t<Width2, LimbType, AllocatorType, IsSignedLeft >& a,
                         const uintwide_t<Width2, LimbType, AllocatorType, IsSignedRight>& b) -> std::enable_if_t<(IsSignedLeft || IsSignedRight), std::pair<uintwide_t<Width2, LimbType, AllocatorType, IsSignedLeft>, uintwide_t<Width2, LimbType, AllocatorType, IsSignedRight>>>;
 
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto mul_wide(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                          const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<static_cast<size_t>(Width2 * static_cast<size_t>(UINT8_C(2))), LimbType, AllocatorType, IsSigned>;
+
+  template<const std::uintmax_t Divisor,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto div_by_constant(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::enable_if_t<(Divisor <= static_cast<std::uintmax_t>((std::numeric_limits<LimbType>::max)())), uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>;
+
+  template<const std::uintmax_t Divisor,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto div_by_constant(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::enable_if_t<(Divisor >  static_cast<std::uintmax_t>((std::numeric_limits<LimbType>::max)())), uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>;
+
+  template<const std::uintmax_t Divisor,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto mod_by_constant(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::enable_if_t<(Divisor <= static_cast<std::uintmax_t>((std::numeric_limits<LimbType>::max)())), uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>;
+
+  template<const std::uintmax_t Divisor,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto mod_by_constant(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::enable_if_t<(Divisor >  static_cast<std::uintmax_t>((std::numeric_limits<LimbType>::max)())), uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>;
+
+  template<typename ValueType,
+           const unsigned_fast_type ExponentBits,
+           const unsigned_fast_type WindowBits = static_cast<unsigned_fast_type>(UINT8_C(4))>
+  class fixed_base_table;
+
+  template<const size_t Width2,
+           typename LimbType = uint_defaultlimb_t,
+           typename AllocatorType = void,
+           const bool IsSigned = false>
+  class montgomery_context;
+
+  template<const size_t Width2,
+           typename LimbType = uint_defaultlimb_t,
+           typename AllocatorType = void,
+           const bool IsSigned = false>
+  class barrett_reducer;
+
+  template<const size_t Width2,
+           typename LimbType = uint_defaultlimb_t,
+           typename AllocatorType = void,
+           const bool IsSigned = false>
+  class special_modulus;
+
   template<const size_t Width2,
            typename LimbType = uint_defaultlimb_t,
            typename AllocatorType = void,
@@ -1456,6 +1893,10 @@
            const bool IsSigned = false>
   class uniform_int_distribution;
 
+  template<typename WideIntegerType,
+           const char* StrValue>
+  struct from_string_constant;
+
   template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
@@ -1700,36 +2141,195 @@
     constexpr auto operator[](const size_type i) const -> typename base_class_type::const_reference { return base_class_type::operator[](static_cast<typename base_class_type::size_type>(i)); }
   };
 
-  template<const size_t Width2> struct verify_power_of_two_times_granularity_one_sixty_fourth // NOLINT(altera-struct-pack-align)
+  // The scratch arena hands out temporary storage to the multiplication
+  // and division kernels of allocator-backed uintwide_t. There is one
+  // arena per thread and per value/allocator type. Its buffer grows to
+  // the largest size requested and is then kept, so that loops of
+  // multiplications and divisions allocate nothing in steady state.
+  // Storage is handed out in stack order (last acquired, first released).
+  template<typename ValueType,
+           typename AllocatorType>
+  class scratch_arena final
   {
-    // List of numbers used to identify the form 2^n times 1...63.
-    static constexpr auto conditional_value =
-       (   verify_power_of_two<static_cast<size_t>(Width2 /  1U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 /  3U)>::conditional_value
-        || verify_power_of_two<static_cast<size_t>(Width2 /  5U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 /  7U)>::conditional_value
-        || verify_power_of_two<static_cast<size_t>(Width2 /  9U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 11U)>::conditional_value
-        || verify_power_of_two<static_cast<size_t>(Width2 / 13U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 15U)>::conditional_value
-        || verify_power_of_two<static_cast<size_t>(Width2 / 17U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 19U)>::conditional_value
-        || verify_power_of_two<static_cast<size_t>(Width2 / 21U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 23U)>::conditional_value
-        || verify_power_of_two<static_cast<size_t>(Width2 / 25U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 27U)>::conditional_value
-        || verify_power_of_two<static_cast<size_t>(Width2 / 29U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 31U)>::conditional_value
-        || verify_power_of_two<static_cast<size_t>(Width2 / 33U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 35U)>::conditional_value
-        || verify_power_of_two<static_cast<size_t>(Width2 / 37U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 39U)>::conditional_value
-        || verify_power_of_two<static_cast<size_t>(Width2 / 41U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 43U)>::conditional_value
-        || verify_power_of_two<static_cast<size_t>(Width2 / 45U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 47U)>::conditional_value
-        || verify_power_of_two<static_cast<size_t>(Width2 / 49U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 51U)>::conditional_value
-        || verify_power_of_two<static_cast<size_t>(Width2 / 53U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 55U)>::conditional_value
-        || verify_power_of_two<static_cast<size_t>(Width2 / 57U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 59U)>::conditional_value
-        || verify_power_of_two<static_cast<size_t>(Width2 / 61U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 63U)>::conditional_value);
-  };
+  public:
+    using allocator_type = typename std::allocator_traits<AllocatorType>::template rebind_alloc<ValueType>;
+    using pointer        = ValueType*;
+    using size_type      = size_t;
 
-  template<typename UnsignedIntegralType>
-  constexpr auto lsb_helper(const UnsignedIntegralType& u) -> unsigned_fast_type;
+    scratch_arena() = default;
 
-  template<typename UnsignedIntegralType>
-  constexpr auto msb_helper(const UnsignedIntegralType& u) -> unsigned_fast_type;
+    scratch_arena(const scratch_arena&) = delete;
+    scratch_arena(scratch_arena&&) noexcept = delete;
 
-  template<>
-  constexpr auto msb_helper<std::uint64_t>(const std::uint64_t& u) -> unsigned_fast_type;
+    ~scratch_arena()
+    {
+      if(my_buffer != nullptr)
+      {
+        std::allocator_traits<allocator_type>::deallocate(my_alloc, my_buffer, my_capacity);
+      }
+    }
+
+    auto operator=(const scratch_arena&) -> scratch_arena& = delete;
+    auto operator=(scratch_arena&&) noexcept -> scratch_arena& = delete;
+
+    static auto instance() -> scratch_arena&
+    {
+      thread_local scratch_arena my_arena { };
+
+      return my_arena;
+    }
+
+    auto acquire(const size_type count) -> pointer
+    {
+      // Return nullptr if the request can not be served without
+      // moving storage that is still in use. The total size of
+      // all requests in use at the same time is tracked, so that
+      // the buffer can grow to it the next time that it is empty.
+
+      my_high_water = (detail::max_unsafe)(my_high_water, static_cast<size_type>(my_used + count));
+
+      if((my_used == static_cast<size_type>(UINT8_C(0))) && (my_high_water > my_capacity))
+      {
+        if(my_buffer != nullptr)
+        {
+          std::allocator_traits<allocator_type>::deallocate(my_alloc, my_buffer, my_capacity);
+        }
+
+        my_buffer   = std::allocator_traits<allocator_type>::allocate(my_alloc, my_high_water);
+        my_capacity = my_high_water;
+      }
+
+      pointer p_result { nullptr };
+
+      if(static_cast<size_type>(my_capacity - my_used) >= count)
+      {
+        p_result = my_buffer + my_used; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        my_used = static_cast<size_type>(my_used + count);
+      }
+
+      return p_result;
+    }
+
+    auto release(const size_type count) -> void
+    {
+      my_used = static_cast<size_type>(my_used - count);
+    }
+
+  private:
+    allocator_type my_alloc      { };
+    pointer        my_buffer     { nullptr };
+    size_type      my_capacity   { static_cast<size_type>(UINT8_C(0)) };
+    size_type      my_used       { static_cast<size_type>(UINT8_C(0)) };
+    size_type      my_high_water { static_cast<size_type>(UINT8_C(0)) };
+  };
+
+  // A zero-initialized array of MySize temporary values leased from
+  // the scratch arena of the current thread. If the arena is busy, or if
+  // WIDE_INTEGER_DISABLE_SCRATCH_ARENA is defined, the lease allocates
+  // its own storage instead.
+  template<typename MyType,
+           const size_t MySize,
+           typename MyAlloc>
+  class scratch_lease final
+  {
+  private:
+    using arena_type = scratch_arena<MyType, MyAlloc>;
+
+  public:
+    using allocator_type = typename arena_type::allocator_type;
+    using value_type     = MyType;
+    using pointer        = MyType*;
+    using const_pointer  = const MyType*;
+    using iterator       = pointer;
+    using const_iterator = const_pointer;
+    using size_type      = size_t;
+
+    static constexpr auto static_size() -> size_type { return MySize; }
+
+    scratch_lease()
+    {
+      #if !defined(WIDE_INTEGER_DISABLE_SCRATCH_ARENA)
+      my_data = arena_type::instance().acquire(MySize);
+      #endif
+
+      if(my_data == nullptr)
+      {
+        allocator_type my_alloc { };
+
+        my_data = std::allocator_traits<allocator_type>::allocate(my_alloc, MySize);
+
+        my_is_own = true;
+      }
+
+      detail::fill_unsafe(begin(), end(), value_type());
+    }
+
+    scratch_lease(const scratch_lease&) = delete;
+    scratch_lease(scratch_lease&&) noexcept = delete;
+
+    ~scratch_lease()
+    {
+      if(my_is_own)
+      {
+        allocator_type my_alloc { };
+
+        std::allocator_traits<allocator_type>::deallocate(my_alloc, my_data, MySize);
+      }
+      else
+      {
+        arena_type::instance().release(MySize);
+      }
+    }
+
+    auto operator=(const scratch_lease&) -> scratch_lease& = delete;
+    auto operator=(scratch_lease&&) noexcept -> scratch_lease& = delete;
+
+    WIDE_INTEGER_NODISCARD auto begin ()       -> iterator       { return my_data; }
+    WIDE_INTEGER_NODISCARD auto end   ()       -> iterator       { return my_data + MySize; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    WIDE_INTEGER_NODISCARD auto begin () const -> const_iterator { return my_data; }
+    WIDE_INTEGER_NODISCARD auto end   () const -> const_iterator { return my_data + MySize; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    WIDE_INTEGER_NODISCARD auto cbegin() const -> const_iterator { return my_data; }
+    WIDE_INTEGER_NODISCARD auto cend  () const -> const_iterator { return my_data + MySize; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+    WIDE_INTEGER_NODISCARD auto operator[](const size_type i)       -> value_type&       { return my_data[i]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    WIDE_INTEGER_NODISCARD auto operator[](const size_type i) const -> const value_type& { return my_data[i]; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+  private:
+    pointer my_data   { nullptr };
+    bool    my_is_own { false };
+  };
+
+  template<const size_t Width2> struct verify_power_of_two_times_granularity_one_sixty_fourth // NOLINT(altera-struct-pack-align)
+  {
+    // List of numbers used to identify the form 2^n times 1...63.
+    static constexpr auto conditional_value =
+       (   verify_power_of_two<static_cast<size_t>(Width2 /  1U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 /  3U)>::conditional_value
+        || verify_power_of_two<static_cast<size_t>(Width2 /  5U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 /  7U)>::conditional_value
+        || verify_power_of_two<static_cast<size_t>(Width2 /  9U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 11U)>::conditional_value
+        || verify_power_of_two<static_cast<size_t>(Width2 / 13U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 15U)>::conditional_value
+        || verify_power_of_two<static_cast<size_t>(Width2 / 17U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 19U)>::conditional_value
+        || verify_power_of_two<static_cast<size_t>(Width2 / 21U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 23U)>::conditional_value
+        || verify_power_of_two<static_cast<size_t>(Width2 / 25U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 27U)>::conditional_value
+        || verify_power_of_two<static_cast<size_t>(Width2 / 29U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 31U)>::conditional_value
+        || verify_power_of_two<static_cast<size_t>(Width2 / 33U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 35U)>::conditional_value
+        || verify_power_of_two<static_cast<size_t>(Width2 / 37U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 39U)>::conditional_value
+        || verify_power_of_two<static_cast<size_t>(Width2 / 41U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 43U)>::conditional_value
+        || verify_power_of_two<static_cast<size_t>(Width2 / 45U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 47U)>::conditional_value
+        || verify_power_of_two<static_cast<size_t>(Width2 / 49U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 51U)>::conditional_value
+        || verify_power_of_two<static_cast<size_t>(Width2 / 53U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 55U)>::conditional_value
+        || verify_power_of_two<static_cast<size_t>(Width2 / 57U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 59U)>::conditional_value
+        || verify_power_of_two<static_cast<size_t>(Width2 / 61U)>::conditional_value || verify_power_of_two<static_cast<size_t>(Width2 / 63U)>::conditional_value);
+  };
+
+  template<typename UnsignedIntegralType>
+  constexpr auto lsb_helper(const UnsignedIntegralType& u) -> unsigned_fast_type;
+
+  template<typename UnsignedIntegralType>
+  constexpr auto msb_helper(const UnsignedIntegralType& u) -> unsigned_fast_type;
+
+  template<>
+  constexpr auto msb_helper<std::uint64_t>(const std::uint64_t& u) -> unsigned_fast_type;
 
   template<>
   constexpr auto msb_helper<std::uint32_t>(const std::uint32_t& u) -> unsigned_fast_type;
@@ -2003,6 +2603,188 @@
   namespace math { namespace wide_integer { // NOLINT(modernize-concat-nested-namespaces)
   #endif
 
+  // The limb_divisor holds a divisor of one limb together with its
+  // precomputed reciprocal, such that each limb of the dividend
+  // is divided with two multiplications instead of a hardware
+  // division. This pays off when many limbs are divided by the same
+  // divisor, as in the conversion to decimal. The reciprocal is set
+  // up once, and the limb_divisor can be reused for many dividends.
+  // Based on N. Moller and T. Granlund, "Improved Division by
+  // Invariant Integers", IEEE Trans. Comput. 60(2), 165-175 (2011).
+  template<typename LimbType = uint_defaultlimb_t>
+  class limb_divisor
+  {
+  public:
+    using limb_type        = LimbType;
+    using double_limb_type = typename detail::uint_type_helper<static_cast<size_t>(std::numeric_limits<limb_type>::digits * 2)>::exact_unsigned_type;
+
+    // Set up the reciprocal of the nonzero divisor d. The divisor
+    // is normalized (shifted left until its top bit is set) to dn,
+    // and the reciprocal is v = floor((b^2 - 1) / dn) - b.
+    explicit constexpr limb_divisor(const limb_type d)
+      : my_d(d),
+        my_shift
+        (
+          static_cast<unsigned>
+          (
+              static_cast<unsigned>(std::numeric_limits<limb_type>::digits - 1)
+            - static_cast<unsigned>(detail::msb_helper(d))
+          )
+        ),
+        my_dn(static_cast<limb_type>(d << my_shift)),
+        my_v
+        (
+          detail::make_lo<limb_type>
+          (
+            static_cast<double_limb_type>
+            (
+                detail::make_large(static_cast<limb_type>(~static_cast<limb_type>(UINT8_C(0))), static_cast<limb_type>(~my_dn))
+              / my_dn
+            )
+          )
+        ) { }
+
+    constexpr limb_divisor() = delete;
+
+    constexpr limb_divisor(const limb_divisor&) = default;
+    constexpr limb_divisor(limb_divisor&&) noexcept = default;
+
+    ~limb_divisor() = default;
+
+    constexpr auto operator=(const limb_divisor&) -> limb_divisor& = default;
+    constexpr auto operator=(limb_divisor&&) noexcept -> limb_divisor& = default;
+
+    WIDE_INTEGER_NODISCARD constexpr auto divisor   () const noexcept -> limb_type { return my_d; }
+    WIDE_INTEGER_NODISCARD constexpr auto reciprocal() const noexcept -> limb_type { return my_v; }
+
+    // Divide the limbs in the range [first, last) (ordered from least
+    // to most significant) in place and return the remainder.
+    template<typename BidirectionalIterator>
+    constexpr auto divide(BidirectionalIterator first, BidirectionalIterator last) const -> limb_type
+    {
+      auto r = top_bits(first, last);
+
+      while(last != first) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        --last;
+
+        *last = divide_normalized(r, next_limb(first, last), r);
+      }
+
+      return static_cast<limb_type>(r >> my_shift);
+    }
+
+    // Return the remainder of the limbs in the range [first, last)
+    // (ordered from least to most significant) without modifying them.
+    template<typename BidirectionalIterator>
+    WIDE_INTEGER_NODISCARD constexpr auto remainder(BidirectionalIterator first, BidirectionalIterator last) const -> limb_type
+    {
+      auto r = top_bits(first, last);
+
+      while(last != first) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        --last;
+
+        static_cast<void>(divide_normalized(r, next_limb(first, last), r));
+      }
+
+      return static_cast<limb_type>(r >> my_shift);
+    }
+
+    // Divide the uintwide_t u (taken as unsigned) in place by the divisor
+    // and return the remainder.
+    template<const size_t Width2,
+             typename AllocatorType,
+             const bool IsSigned>
+    constexpr auto divide(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u) const -> limb_type
+    {
+      return divide(u.representation().begin(), u.representation().end());
+    }
+
+    // Return the remainder of the uintwide_t u (taken as unsigned).
+    template<const size_t Width2,
+             typename AllocatorType,
+             const bool IsSigned>
+    WIDE_INTEGER_NODISCARD constexpr auto remainder(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& u) const -> limb_type
+    {
+      return remainder(u.crepresentation().cbegin(), u.crepresentation().cend());
+    }
+
+  private:
+    limb_type my_d;
+    unsigned  my_shift;
+    limb_type my_dn;
+    limb_type my_v;
+
+    // The dividend is shifted on the fly by the same amount as the
+    // divisor. This leaves the quotient unchanged and shifts the
+    // remainder, which is shifted back at the end.
+
+    template<typename BidirectionalIterator>
+    constexpr auto top_bits(BidirectionalIterator first, BidirectionalIterator last) const -> limb_type
+    {
+      // Get the bits shifted out of the top limb.
+      return
+        static_cast<limb_type>
+        (
+          ((first == last) || (my_shift == static_cast<unsigned>(UINT8_C(0))))
+            ? static_cast<limb_type>(UINT8_C(0))
+            : static_cast<limb_type>(*(--last) >> static_cast<unsigned>(static_cast<unsigned>(std::numeric_limits<limb_type>::digits) - my_shift))
+        );
+    }
+
+    template<typename BidirectionalIterator>
+    constexpr auto next_limb(BidirectionalIterator first, BidirectionalIterator it) const -> limb_type
+    {
+      // Get the limb at it, shifted left and filled up with the top bits of the limb below it.
+      auto u0 = static_cast<limb_type>(*it << my_shift);
+
+      if((it != first) && (my_shift != static_cast<unsigned>(UINT8_C(0))))
+      {
+        u0 = static_cast<limb_type>(u0 | static_cast<limb_type>(*(--it) >> static_cast<unsigned>(static_cast<unsigned>(std::numeric_limits<limb_type>::digits) - my_shift)));
+      }
+
+      return u0;
+    }
+
+    constexpr auto divide_normalized(const limb_type u1, const limb_type u0, limb_type& r) const -> limb_type
+    {
+      // Divide the two-limb value (u1, u0) having u1 < dn by the
+      // normalized divisor dn (Algorithm 4 of Moller and Granlund).
+      // The quotient is estimated from the reciprocal and then
+      // corrected at most twice, with the second correction being rare.
+
+      const auto q =
+        static_cast<double_limb_type>
+        (
+            static_cast<double_limb_type>(static_cast<double_limb_type>(my_v) * u1)
+          + detail::make_large(u0, u1)
+        );
+
+      auto q1 = static_cast<limb_type>(detail::make_hi<limb_type>(q) + static_cast<limb_type>(UINT8_C(1)));
+
+      const auto q0 = detail::make_lo<limb_type>(q);
+
+      r = static_cast<limb_type>(u0 - static_cast<limb_type>(static_cast<double_limb_type>(q1) * my_dn));
+
+      if(r > q0)
+      {
+        --q1;
+
+        r = static_cast<limb_type>(r + my_dn);
+      }
+
+      if(r >= my_dn)
+      {
+        ++q1;
+
+        r = static_cast<limb_type>(r - my_dn);
+      }
+
+      return q1;
+    }
+  };
+
   template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
@@ -2050,8 +2832,15 @@
         Width2 / static_cast<size_t>(std::numeric_limits<limb_type>::digits)
       );
 
-    static constexpr size_t number_of_limbs_karatsuba_threshold { static_cast<size_t>(128U) };
-    static constexpr size_t number_of_limbs_schoolbook_fallback { static_cast<size_t>(24U) };
+    static constexpr size_t number_of_limbs_karatsuba_threshold { multiplication_traits<Width2, LimbType, AllocatorType, IsSigned>::number_of_limbs_karatsuba_threshold };
+    static constexpr size_t number_of_limbs_schoolbook_fallback { multiplication_traits<Width2, LimbType, AllocatorType, IsSigned>::number_of_limbs_schoolbook_fallback };
+    static constexpr size_t number_of_limbs_toom3_threshold     { multiplication_traits<Width2, LimbType, AllocatorType, IsSigned>::number_of_limbs_toom3_threshold };
+    static constexpr size_t number_of_limbs_ntt_threshold       { multiplication_traits<Width2, LimbType, AllocatorType, IsSigned>::number_of_limbs_ntt_threshold };
+    static constexpr size_t number_of_limbs_burnikel_ziegler_threshold { multiplication_traits<Width2, LimbType, AllocatorType, IsSigned>::number_of_limbs_burnikel_ziegler_threshold };
+    static constexpr size_t number_of_limbs_dec_recursive_threshold { static_cast<size_t>(128U) };
+
+    // The default window width (in bits) of pow and powm, chosen from Width2.
+    static constexpr std::uint_fast8_t exponent_window_bits { detail::exponent_window_bits_for(static_cast<unsigned_fast_type>(Width2)) };
 
     // Verify that the Width2 template parameter (mirrored with my_width2):
     //   * Is equal to 2^n times 1...63.
@@ -2074,6 +2863,35 @@
                                                                                        std::allocator<void>,
                                                                                        AllocatorType>>::template rebind_alloc<limb_type>>>;
 
+    // The type of temporary storage in the multiplication and division
+    // kernels. This is an array on the stack for a void allocator and
+    // a lease from the scratch arena of the current thread otherwise.
+    template<typename ValueType,
+             const size_t ArraySize>
+    using scratch_array_type =
+      std::conditional_t
+        <std::is_same<AllocatorType, void>::value,
+         detail::fixed_static_array<ValueType,
+                                    ArraySize>,
+         detail::scratch_lease     <ValueType,
+                                    ArraySize,
+                                    typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                      std::allocator<void>,
+                                                                                      AllocatorType>>::template rebind_alloc<ValueType>>>;
+
+    // The type of temporary storage that is too large for the stack,
+    // such as the digit buffers of the NTT multiplication. This is
+    // leased from the scratch arena of the current thread, even for
+    // a void allocator (using std::allocator).
+    template<typename ValueType,
+             const size_t ArraySize>
+    using large_scratch_array_type =
+      detail::scratch_lease<ValueType,
+                            ArraySize,
+                            typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                              std::allocator<void>,
+                                                                              AllocatorType>>::template rebind_alloc<ValueType>>;
+
     // The iterator types of the internal data representation.
     using iterator               = typename representation_type::iterator;
     using const_iterator         = typename representation_type::const_iterator;
@@ -2453,7 +3271,7 @@
     {
       if(this == &other)
       {
-        eval_mul_unary(uintwide_t(other)); // NOLINT(performance-unnecessary-copy-initialization)
+        eval_square_unary();
       }
       else
       {
@@ -2888,24 +3706,16 @@
         }
         else
         {
-          while(!t.is_zero() && (pos > signed_fast_type { UINT8_C(0) }))
-          {
-            const uintwide_t tmp(t);
+          uintwide_t<my_width2, limb_type, AllocatorType, false> tu(t);
 
-            t.eval_divide_by_single_limb(static_cast<limb_type>(UINT8_C(10)), 0U, nullptr);
-
-            --pos;
+          const auto dst =
+            extract_dec_digits<false>
+            (
+              tu,
+              &str_temp[static_cast<typename string_storage_dec_type::size_type>(pos)]
+            );
 
-            str_temp[static_cast<typename string_storage_dec_type::size_type>(pos)] =
-              static_cast<char>
-              (
-                  static_cast<limb_type>
-                  (
-                    tmp - (uintwide_t(t).mul_by_limb(static_cast<limb_type>(UINT8_C(10))))
-                  )
-                + static_cast<limb_type>(UINT8_C(0x30))
-              );
-          }
+          pos -= static_cast<signed_fast_type>(dst);
         }
 
         if(pos > signed_fast_type { UINT8_C(0) })
@@ -3077,72 +3887,117 @@
     }
     // LCOV_EXCL_STOP
 
-    constexpr auto eval_divide_by_single_limb(const limb_type          short_denominator,
-                                              const unsigned_fast_type u_offset,
-                                                    uintwide_t*        remainder) -> void
+    constexpr auto conditional_select(const uintwide_t& other, const bool condition) -> void
     {
-      // The denominator has one single limb.
-      // Use a one-dimensional division algorithm.
+      // Set *this to other if the condition is true, otherwise leave
+      // *this unchanged. Every limb is read and written in both cases,
+      // with a mask instead of a branch on the condition.
 
-      auto long_numerator = double_limb_type { };
-      auto hi_part        = static_cast<limb_type>(UINT8_C(0));
+      const auto mask = static_cast<limb_type>(static_cast<limb_type>(UINT8_C(0)) - static_cast<limb_type>(condition));
 
+      auto it_other = other.values.cbegin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      for(auto it = values.begin(); it != values.end(); ++it) // NOLINT(llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
       {
-        reverse_iterator
-          ri
-          {
-            detail::advance_and_point
-            (
-              values.begin(),
-              static_cast<size_t>(number_of_limbs - static_cast<size_t>(u_offset))
-            )
-          };
+        *it = static_cast<limb_type>(*it ^ static_cast<limb_type>(mask & static_cast<limb_type>(*it ^ *it_other++)));
+      }
+    }
 
-        for( ; ri != values.rend(); ++ri) // NOLINT(altera-id-dependent-backward-branch)
-        {
-          long_numerator =
-            static_cast<double_limb_type>
-            (
-               *ri
-             + static_cast<double_limb_type>
-               (
-                    static_cast<double_limb_type>
-                    (
-                        long_numerator
-                      - static_cast<double_limb_type>(static_cast<double_limb_type>(short_denominator) * hi_part)
-                    )
-                 << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)
-               )
-            );
+    constexpr auto conditional_subtract(const uintwide_t& other, const bool condition) -> limb_type
+    {
+      // Subtract other from *this if the condition is true, otherwise
+      // subtract zero. The subtrahend is masked instead of branching on
+      // the condition. The borrow out of the top limb (0 or 1) is returned.
 
-          *ri = detail::make_lo<limb_type>(static_cast<double_limb_type>(long_numerator / short_denominator));
+      const auto mask = static_cast<limb_type>(static_cast<limb_type>(UINT8_C(0)) - static_cast<limb_type>(condition));
 
-          hi_part = *ri;
-        }
-      }
+      auto borrow = static_cast<limb_type>(UINT8_C(0));
 
-      if(remainder != nullptr)
+      auto it_other = other.values.cbegin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      for(auto it = values.begin(); it != values.end(); ++it) // NOLINT(llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
       {
-        long_numerator =
+        const auto uv =
           static_cast<double_limb_type>
           (
-             static_cast<double_limb_type>(*values.cbegin())
-           + static_cast<double_limb_type>
-             (
-                  static_cast<double_limb_type>
-                  (
-                    long_numerator - static_cast<double_limb_type>(static_cast<double_limb_type>(short_denominator) * hi_part)
-                  )
-               << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)
-             )
+              static_cast<double_limb_type>(*it)
+            - static_cast<double_limb_type>(static_cast<limb_type>(mask & *it_other++))
+            - borrow
           );
 
-        *remainder =
-          static_cast<limb_type>
+        *it = static_cast<limb_type>(uv);
+
+        borrow = static_cast<limb_type>(detail::make_hi<limb_type>(uv) & static_cast<limb_type>(UINT8_C(1)));
+      }
+
+      return borrow;
+    }
+
+    constexpr auto conditional_add(const uintwide_t& other, const bool condition) -> limb_type
+    {
+      // Add other to *this if the condition is true, otherwise add
+      // zero. The addend is masked instead of branching on the
+      // condition. The carry out of the top limb (0 or 1) is returned.
+
+      const auto mask = static_cast<limb_type>(static_cast<limb_type>(UINT8_C(0)) - static_cast<limb_type>(condition));
+
+      auto carry = static_cast<limb_type>(UINT8_C(0));
+
+      auto it_other = other.values.cbegin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      for(auto it = values.begin(); it != values.end(); ++it) // NOLINT(llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
+      {
+        const auto uv =
+          static_cast<double_limb_type>
           (
-            long_numerator >> static_cast<unsigned>(std::numeric_limits<limb_type>::digits)
+              static_cast<double_limb_type>(*it)
+            + static_cast<double_limb_type>(static_cast<limb_type>(mask & *it_other++))
+            + carry
           );
+
+        *it = static_cast<limb_type>(uv);
+
+        carry = detail::make_hi<limb_type>(uv);
+      }
+
+      return carry;
+    }
+
+    constexpr auto eval_divide_by_single_limb(const limb_type          short_denominator,
+                                              const unsigned_fast_type u_offset,
+                                                    uintwide_t*        remainder) -> limb_type
+    {
+      // The denominator has one single limb.
+      // Divide by means of its precomputed reciprocal.
+      return eval_divide_by_single_limb(limb_divisor<limb_type>(short_denominator), u_offset, remainder);
+    }
+
+    constexpr auto eval_divide_by_single_limb(const limb_divisor<limb_type>& short_denominator,
+                                              const unsigned_fast_type       u_offset,
+                                                    uintwide_t*              remainder) -> limb_type
+    {
+      // The denominator has one single limb, having a precomputed reciprocal.
+      // Use a one-dimensional division algorithm, with two multiplications per limb.
+      // The remainder is returned as a limb, and is optionally
+      // also stored in the wide remainder (when non-null).
+
+      const auto remainder_limb =
+        short_denominator.divide
+        (
+          values.begin(),
+          detail::advance_and_point
+          (
+            values.begin(),
+            static_cast<size_t>(number_of_limbs - static_cast<size_t>(u_offset))
+          )
+        );
+
+      if(remainder != nullptr)
+      {
+        *remainder = remainder_limb;
       }
+
+      return remainder_limb;
     }
 
     WIDE_INTEGER_NODISCARD constexpr auto is_zero() const -> bool
@@ -3356,7 +4211,7 @@
     // Non-member binary add, sub, mul, div, mod of (uintwide_t op uintwide_t).
     friend constexpr auto operator+ (const uintwide_t& u, const uintwide_t& v) -> uintwide_t { return uintwide_t(u).operator+=(v); }
     friend constexpr auto operator- (const uintwide_t& u, const uintwide_t& v) -> uintwide_t { return uintwide_t(u).operator-=(v); }
-    friend constexpr auto operator* (const uintwide_t& u, const uintwide_t& v) -> uintwide_t { return uintwide_t(u).operator*=(v); }
+    friend constexpr auto operator* (const uintwide_t& u, const uintwide_t& v) -> uintwide_t { return ((&u == &v) ? square(u) : uintwide_t(u).operator*=(v)); }
     friend constexpr auto operator/ (const uintwide_t& u, const uintwide_t& v) -> uintwide_t { return uintwide_t(u).operator/=(v); }
     friend constexpr auto operator% (const uintwide_t& u, const uintwide_t& v) -> uintwide_t { return uintwide_t(u).operator%=(v); }
 
@@ -3387,11 +4242,10 @@
     {
       const auto u_is_neg = uintwide_t::is_neg(u);
 
-      uintwide_t remainder { };
+      // Only the remainder is needed, which leaves the dividend unchanged.
+      const limb_divisor<limb_type> divisor { static_cast<limb_type>(v) };
 
-      uintwide_t((!u_is_neg) ? u : -u).eval_divide_by_single_limb(v, static_cast<unsigned_fast_type>(UINT8_C(0)), &remainder);
-
-      auto u_rem = static_cast<limb_type>(remainder);
+      const auto u_rem = ((!u_is_neg) ? divisor.remainder(u) : divisor.remainder(-u));
 
       return ((!u_is_neg) ? u_rem : static_cast<limb_type>(static_cast<limb_type>(~u_rem) + static_cast<limb_type>(UINT8_C(1))));
     }
@@ -3458,6 +4312,13 @@
     friend constexpr auto divmod(const uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSignedLeft >& a, // NOLINT(readability-redundant-declaration)
                                  const uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSignedRight>& b) -> std::enable_if_t<(OtherIsSignedLeft || OtherIsSignedRight), std::pair<uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSignedLeft>, uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSignedRight>>>;
 
+    template<const size_t OtherWidth2,
+             typename OtherLimbType,
+             typename OtherAllocatorType,
+             const bool OtherIsSigned>
+    friend constexpr auto mul_wide(const uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSigned>& a, // NOLINT(readability-redundant-declaration)
+                                   const uintwide_t<OtherWidth2, OtherLimbType, OtherAllocatorType, OtherIsSigned>& b) -> uintwide_t<static_cast<size_t>(OtherWidth2 * static_cast<size_t>(UINT8_C(2))), OtherLimbType, OtherAllocatorType, OtherIsSigned>;
+
     #if (defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L))
     template<const size_t OtherWidth2,
              typename OtherLimbType,
@@ -3501,6 +4362,493 @@
       return dst;
     }
 
+    static constexpr auto dec_digits_per_limb() -> unsigned_fast_type
+    {
+      // The number of decimal digits that always fit in one limb.
+      // This is 2, 4, 9 or 19 for limbs having 8, 16, 32 or 64 bits.
+      return
+        static_cast<unsigned_fast_type>
+        (
+            static_cast<unsigned_fast_type>
+            (
+                static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits)
+              * static_cast<unsigned_fast_type>(UINT16_C(301))
+            )
+          / static_cast<unsigned_fast_type>(UINT16_C(1000))
+        );
+    }
+
+    static constexpr auto dec_limb_pow10() -> limb_type
+    {
+      // The largest power of ten having dec_digits_per_limb() digits
+      // that fits in one limb, such as 10^19 for 64-bit limbs.
+      auto p10 = static_cast<limb_type>(UINT8_C(1));
+
+      for(auto   i = static_cast<unsigned_fast_type>(UINT8_C(0));
+                 i < dec_digits_per_limb();
+               ++i)
+      {
+        p10 = static_cast<limb_type>(p10 * static_cast<limb_type>(UINT8_C(10)));
+      }
+
+      return p10;
+    }
+
+    template<const bool RePhraseIsSigned = IsSigned>
+    static constexpr auto used_limbs(const uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& a) -> unsigned_fast_type
+    {
+      auto n_used = static_cast<unsigned_fast_type>(number_of_limbs);
+
+      auto crit = a.values.crbegin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      while((crit != a.values.crend()) && (*crit == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        ++crit;
+        --n_used;
+      }
+
+      return n_used;
+    }
+
+    template<const bool RePhraseIsSigned = IsSigned>
+    static constexpr auto extract_dec_digits_by_limb(uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& tu,
+                                                     char* pstr,
+                                                     const unsigned_fast_type min_digits) -> std::enable_if_t<(!RePhraseIsSigned), unsigned_fast_type>
+    {
+      // Extract the decimal digits in blocks of dec_digits_per_limb(),
+      // using one single-limb division by dec_limb_pow10() per block.
+      // The reciprocal of dec_limb_pow10() is computed at compile time.
+      // The digits are written backwards, ending just before pstr.
+      // Leading zeros are written only as needed to reach min_digits.
+
+      auto dst = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+      auto n_used = used_limbs(tu);
+
+      constexpr limb_divisor<limb_type> divisor_pow10 { dec_limb_pow10() };
+
+      while(n_used != static_cast<unsigned_fast_type>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        auto block =
+          tu.eval_divide_by_single_limb
+          (
+            divisor_pow10,
+            static_cast<unsigned_fast_type>(number_of_limbs - static_cast<size_t>(n_used)),
+            nullptr
+          );
+
+        while(   (n_used != static_cast<unsigned_fast_type>(UINT8_C(0)))
+              && (tu.values[static_cast<typename representation_type::size_type>(n_used - static_cast<unsigned_fast_type>(UINT8_C(1)))] == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          --n_used;
+        }
+
+        const auto is_last_block = (n_used == static_cast<unsigned_fast_type>(UINT8_C(0)));
+
+        for(auto   i = static_cast<unsigned_fast_type>(UINT8_C(0));
+                   (i < dec_digits_per_limb()) && ((!is_last_block) || (block != static_cast<limb_type>(UINT8_C(0))));
+                 ++i)
+        {
+          *(--pstr) = static_cast<char>(static_cast<limb_type>(block % static_cast<limb_type>(UINT8_C(10))) + static_cast<limb_type>(UINT8_C(0x30))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          block = static_cast<limb_type>(block / static_cast<limb_type>(UINT8_C(10)));
+
+          ++dst;
+        }
+      }
+
+      while(dst < min_digits) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        *(--pstr) = '0'; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        ++dst;
+      }
+
+      return dst;
+    }
+
+    template<const bool RePhraseIsSigned = IsSigned>
+    static constexpr auto extract_dec_digits_recursive(uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& tu,
+                                                       char* pstr,
+                                                       const unsigned_fast_type min_digits,
+                                                       const uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>* p_pow10,
+                                                       const unsigned_fast_type pow10_count) -> std::enable_if_t<(!RePhraseIsSigned), unsigned_fast_type>
+    {
+      if(used_limbs(tu) < static_cast<unsigned_fast_type>(number_of_limbs_dec_recursive_threshold))
+      {
+        return extract_dec_digits_by_limb(tu, pstr, min_digits);
+      }
+
+      // Split the argument at the largest tabulated power
+      // of ten, 10^(dec_digits_per_limb() * 2^j), that is less
+      // than or equal to it. The lower part (the remainder) is
+      // zero-padded to exactly dec_digits_per_limb() * 2^j digits.
+
+      auto j = static_cast<unsigned_fast_type>(pow10_count - static_cast<unsigned_fast_type>(UINT8_C(1)));
+
+      while((j != static_cast<unsigned_fast_type>(UINT8_C(0))) && (p_pow10[j] > tu)) // NOLINT(altera-id-dependent-backward-branch,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        --j;
+      }
+
+      uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned> rem { };
+
+      tu.eval_divide_knuth(p_pow10[j], &rem); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      const auto dst_lo =
+        extract_dec_digits_recursive(rem,
+                                     pstr,
+                                     static_cast<unsigned_fast_type>(dec_digits_per_limb() << static_cast<unsigned>(j)),
+                                     p_pow10,
+                                     j);
+
+      const auto dst_hi =
+        extract_dec_digits_recursive(tu,
+                                     pstr - dst_lo, // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                                     static_cast<unsigned_fast_type>((min_digits > dst_lo) ? static_cast<unsigned_fast_type>(min_digits - dst_lo) : static_cast<unsigned_fast_type>(UINT8_C(0))),
+                                     p_pow10,
+                                     static_cast<unsigned_fast_type>(j + static_cast<unsigned_fast_type>(UINT8_C(1))));
+
+      return static_cast<unsigned_fast_type>(dst_lo + dst_hi);
+    }
+
+    static constexpr auto dec_pow10_table_size() -> std::size_t
+    {
+      // The powers 10^(dec_digits_per_limb() * 2^j) occupy at most
+      // 2^j limbs. Tabulate those whose squares fit in the width.
+      auto table_size = static_cast<std::size_t>(UINT8_C(1));
+
+      for(auto n = static_cast<size_t>(UINT8_C(2)); n <= number_of_limbs; n = static_cast<size_t>(n * static_cast<size_t>(UINT8_C(2))))
+      {
+        ++table_size;
+      }
+
+      return table_size;
+    }
+
+    // The table of these powers has entries of the full width. For a
+    // void allocator, it is leased from the scratch arena instead of
+    // being put on the stack. Otherwise, the limbs of its entries
+    // are already allocated with the allocator.
+    template<typename ValueType>
+    using dec_pow10_table_type =
+      std::conditional_t<std::is_same<AllocatorType, void>::value,
+                         large_scratch_array_type   <ValueType, static_cast<size_t>(dec_pow10_table_size())>,
+                         detail::array_detail::array<ValueType, dec_pow10_table_size()>>;
+
+    template<const bool RePhraseIsSigned = IsSigned>
+    static constexpr auto make_dec_pow10_table(uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>* p_pow10,
+                                               const unsigned_fast_type count_max,
+                                               const unsigned_fast_type limb_max) -> std::enable_if_t<(!RePhraseIsSigned), unsigned_fast_type>
+    {
+      // Fill the table with 10^(dec_digits_per_limb() * 2^j) for j = 0, 1, ...
+      // Stop at count_max entries, or when the next square could exceed
+      // limb_max limbs (or the width). Return the number of entries.
+
+      using local_unsigned_type = uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>;
+
+      *p_pow10 = local_unsigned_type(dec_limb_pow10());
+
+      auto pow10_count = static_cast<unsigned_fast_type>(UINT8_C(1));
+
+      while(pow10_count < count_max) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto& p_prev = p_pow10[static_cast<std::size_t>(pow10_count - static_cast<unsigned_fast_type>(UINT8_C(1)))]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        const auto n_prev = used_limbs(p_prev);
+
+        if(   (static_cast<unsigned_fast_type>(n_prev * static_cast<unsigned_fast_type>(UINT8_C(2))) > static_cast<unsigned_fast_type>(number_of_limbs))
+           || (static_cast<unsigned_fast_type>(n_prev * static_cast<unsigned_fast_type>(UINT8_C(2))) > limb_max))
+        {
+          break;
+        }
+
+        // Square the previous power using only its nonzero limbs.
+        eval_multiply_n_by_n_to_2n(p_pow10[static_cast<std::size_t>(pow10_count)].values.begin(), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                                   p_prev.values.cbegin(),
+                                   p_prev.values.cbegin(),
+                                   n_prev);
+
+        ++pow10_count;
+      }
+
+      return pow10_count;
+    }
+
+    template<const bool RePhraseIsSigned = IsSigned>
+    static constexpr auto extract_dec_digits(uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& tu,
+                                             char* pstr) -> std::enable_if_t<(!RePhraseIsSigned), unsigned_fast_type>
+    {
+      // Extract the decimal digits of a nonzero unsigned argument,
+      // written backwards and ending just before pstr.
+
+      static_assert(number_of_limbs_dec_recursive_threshold >= static_cast<size_t>(UINT8_C(2)),
+                    "Error: The recursive decimal conversion threshold must be two limbs or more");
+
+      return
+        (
+          (used_limbs(tu) < static_cast<unsigned_fast_type>(number_of_limbs_dec_recursive_threshold))
+            ? extract_dec_digits_by_limb(tu, pstr, static_cast<unsigned_fast_type>(UINT8_C(0)))
+            : extract_dec_digits_long(tu, pstr)
+        );
+    }
+
+    template<const size_t RePhraseWidth2 = Width2,
+             const bool RePhraseIsSigned = IsSigned>
+    static constexpr auto extract_dec_digits_long(uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& tu,
+                                                  char* pstr) -> std::enable_if_t<((!RePhraseIsSigned) && (uintwide_t<RePhraseWidth2, LimbType, AllocatorType, RePhraseIsSigned>::number_of_limbs >= number_of_limbs_dec_recursive_threshold)), unsigned_fast_type>
+    {
+      // For large arguments, use subquadratic divide-and-conquer
+      // conversion based on the tabulated powers of ten
+      // 10^(dec_digits_per_limb() * 2^j). Only the powers needed
+      // for the argument at hand are computed.
+
+      using local_unsigned_type = uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>;
+
+      dec_pow10_table_type<local_unsigned_type> pow10 { };
+
+      const auto pow10_count =
+        make_dec_pow10_table(pow10.begin(),
+                             static_cast<unsigned_fast_type>(dec_pow10_table_size()),
+                             static_cast<unsigned_fast_type>(used_limbs(tu) + static_cast<unsigned_fast_type>(UINT8_C(1))));
+
+      return extract_dec_digits_recursive(tu, pstr, static_cast<unsigned_fast_type>(UINT8_C(0)), pow10.begin(), pow10_count);
+    }
+
+    template<const size_t RePhraseWidth2 = Width2,
+             const bool RePhraseIsSigned = IsSigned>
+    static constexpr auto extract_dec_digits_long(uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& tu,
+                                                  char* pstr) -> std::enable_if_t<((!RePhraseIsSigned) && (uintwide_t<RePhraseWidth2, LimbType, AllocatorType, RePhraseIsSigned>::number_of_limbs < number_of_limbs_dec_recursive_threshold)), unsigned_fast_type>
+    {
+      // Types with fewer limbs than the recursion threshold never take
+      // the recursive path. This avoids instantiating it for them.
+
+      return extract_dec_digits_by_limb(tu, pstr, static_cast<unsigned_fast_type>(UINT8_C(0)));
+    }
+
+    template<const bool RePhraseIsSigned = IsSigned>
+    static constexpr auto read_dec_digits_by_limb(uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& tu,
+                                                  const char* first,
+                                                  const char* last) -> std::enable_if_t<(!RePhraseIsSigned), void>
+    {
+      // Read the decimal digits in [first, last), skipping apostrophes.
+      // Gather up to dec_digits_per_limb() digits into one limb before
+      // each multiply-add, which runs over the nonzero limbs only.
+      // The argument tu must be zero on input.
+
+      auto n_used = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+      while(first != last) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        auto block = static_cast<limb_type>(UINT8_C(0));
+        auto scale = static_cast<limb_type>(UINT8_C(1));
+
+        auto block_digits = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+        while((first != last) && (block_digits < dec_digits_per_limb())) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          const auto c = *first++; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          if(c != static_cast<char>(39))
+          {
+            block = static_cast<limb_type>(static_cast<limb_type>(block * static_cast<limb_type>(UINT8_C(10))) + static_cast<limb_type>(c - '0'));
+            scale = static_cast<limb_type>(scale * static_cast<limb_type>(UINT8_C(10)));
+
+            ++block_digits;
+          }
+        }
+
+        if(block_digits == static_cast<unsigned_fast_type>(UINT8_C(0)))
+        {
+          break;
+        }
+
+        const auto carry = eval_multiply_1d(tu.values.begin(), tu.values.cbegin(), scale, n_used);
+
+        if((carry != static_cast<limb_type>(UINT8_C(0))) && (n_used < static_cast<unsigned_fast_type>(number_of_limbs)))
+        {
+          tu.values[static_cast<typename representation_type::size_type>(n_used)] = carry;
+
+          ++n_used;
+        }
+
+        auto i = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+        while((block != static_cast<limb_type>(UINT8_C(0))) && (i < static_cast<unsigned_fast_type>(number_of_limbs))) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          const auto sum =
+            static_cast<double_limb_type>
+            (
+                static_cast<double_limb_type>(tu.values[static_cast<typename representation_type::size_type>(i)])
+              + block
+            );
+
+          tu.values[static_cast<typename representation_type::size_type>(i)] = static_cast<limb_type>(sum);
+
+          block = detail::make_hi<limb_type>(sum);
+
+          ++i;
+        }
+
+        n_used = (detail::max_unsafe)(n_used, i);
+      }
+    }
+
+    template<const bool RePhraseIsSigned = IsSigned>
+    static constexpr auto read_dec_digits_recursive(uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& tu, // NOLINT(misc-no-recursion)
+                                                    const char* first,
+                                                    const char* last,
+                                                    const unsigned_fast_type digit_count,
+                                                    const uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>* p_pow10,
+                                                    const unsigned_fast_type pow10_count) -> std::enable_if_t<(!RePhraseIsSigned), void>
+    {
+      if(digit_count < static_cast<unsigned_fast_type>(dec_digits_per_limb() * number_of_limbs_dec_recursive_threshold))
+      {
+        read_dec_digits_by_limb(tu, first, last);
+
+        return;
+      }
+
+      // Split off the lowest dec_digits_per_limb() * 2^j digits, using the
+      // largest tabulated j that leaves a nonempty upper part. Read both
+      // parts recursively and combine them with tu = hi * 10^(...) + lo.
+
+      auto j = static_cast<unsigned_fast_type>(pow10_count - static_cast<unsigned_fast_type>(UINT8_C(1)));
+
+      while((j != static_cast<unsigned_fast_type>(UINT8_C(0))) && (static_cast<unsigned_fast_type>(dec_digits_per_limb() << static_cast<unsigned>(j)) >= digit_count)) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        --j;
+      }
+
+      const auto digit_count_lo = static_cast<unsigned_fast_type>(dec_digits_per_limb() << static_cast<unsigned>(j));
+      const auto digit_count_hi = static_cast<unsigned_fast_type>(digit_count - digit_count_lo);
+
+      const char* split = last;
+
+      for(auto n = static_cast<unsigned_fast_type>(UINT8_C(0)); n < digit_count_lo; ) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        if(*(--split) != static_cast<char>(39)) { ++n; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      using local_unsigned_type = uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>;
+
+      local_unsigned_type lo { };
+
+      read_dec_digits_recursive(lo, split, last,  digit_count_lo, p_pow10, j);
+      read_dec_digits_recursive(tu, first, split, digit_count_hi, p_pow10, static_cast<unsigned_fast_type>(j + static_cast<unsigned_fast_type>(UINT8_C(1))));
+
+      const auto& p = p_pow10[static_cast<std::size_t>(j)]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+      // Both hi and 10^(dec_digits_per_limb() * 2^j) fit in 2^j limbs
+      // when hi has no more digits than lo. If their full product also
+      // fits in the width, then use the n*n->2n multiplication kernels.
+
+      const auto n_half = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(UINT8_C(1)) << static_cast<unsigned>(j));
+
+      if(   (digit_count_hi <= digit_count_lo)
+         && (static_cast<unsigned_fast_type>(n_half * static_cast<unsigned_fast_type>(UINT8_C(2))) <= static_cast<unsigned_fast_type>(number_of_limbs)))
+      {
+        local_unsigned_type prod { };
+
+        if(n_half < static_cast<unsigned_fast_type>(number_of_limbs_karatsuba_threshold))
+        {
+          eval_multiply_n_by_n_to_2n(prod.values.begin(), tu.values.cbegin(), p.values.cbegin(), n_half);
+        }
+        else
+        {
+          scratch_array_type<limb_type, static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(2)))> t { };
+
+          eval_multiply_kara_n_by_n_to_2n(prod.values.begin(), tu.values.cbegin(), p.values.cbegin(), n_half, t.begin());
+        }
+
+        tu = prod;
+      }
+      else
+      {
+        tu *= p;
+      }
+
+      tu += lo;
+    }
+
+    template<const bool RePhraseIsSigned = IsSigned>
+    static constexpr auto read_dec_digits(uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& tu,
+                                          const char* first,
+                                          const char* last) -> std::enable_if_t<(!RePhraseIsSigned), void>
+    {
+      // Read the decimal digits in [first, last), skipping apostrophes.
+      // The result is taken modulo 2^Width2, as it would be for the
+      // digit-by-digit multiply-add of the digits.
+
+      auto digit_count = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+      for(const char* p = first; p != last; ++p) // NOLINT(altera-id-dependent-backward-branch,cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        if(*p != static_cast<char>(39)) { ++digit_count; }
+      }
+
+      // Since 10^Width2 is a multiple of 2^Width2, only the lowest
+      // Width2 decimal digits contribute to the result. Skip the others.
+
+      while(digit_count > static_cast<unsigned_fast_type>(my_width2)) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        if(*first++ != static_cast<char>(39)) { --digit_count; } // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      }
+
+      if(digit_count < static_cast<unsigned_fast_type>(dec_digits_per_limb() * number_of_limbs_dec_recursive_threshold))
+      {
+        read_dec_digits_by_limb(tu, first, last);
+      }
+      else
+      {
+        read_dec_digits_long(tu, first, last, digit_count);
+      }
+    }
+
+    template<const size_t RePhraseWidth2 = Width2,
+             const bool RePhraseIsSigned = IsSigned>
+    static constexpr auto read_dec_digits_long(uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& tu,
+                                               const char* first,
+                                               const char* last,
+                                               const unsigned_fast_type digit_count) -> std::enable_if_t<((!RePhraseIsSigned) && (uintwide_t<RePhraseWidth2, LimbType, AllocatorType, RePhraseIsSigned>::number_of_limbs >= number_of_limbs_dec_recursive_threshold)), void>
+    {
+      // For long inputs, use subquadratic divide-and-conquer reading
+      // based on the tabulated powers of ten 10^(dec_digits_per_limb() * 2^j).
+
+      using local_unsigned_type = uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>;
+
+      dec_pow10_table_type<local_unsigned_type> pow10 { };
+
+      auto count_max = static_cast<unsigned_fast_type>(UINT8_C(1));
+
+      while(   (count_max < static_cast<unsigned_fast_type>(dec_pow10_table_size()))
+            && (static_cast<unsigned_fast_type>(dec_digits_per_limb() << static_cast<unsigned>(count_max)) < digit_count)) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        ++count_max;
+      }
+
+      const auto pow10_count =
+        make_dec_pow10_table(pow10.begin(), count_max, static_cast<unsigned_fast_type>(number_of_limbs));
+
+      read_dec_digits_recursive(tu, first, last, digit_count, pow10.begin(), pow10_count);
+    }
+
+    template<const size_t RePhraseWidth2 = Width2,
+             const bool RePhraseIsSigned = IsSigned>
+    static constexpr auto read_dec_digits_long(uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& tu,
+                                               const char* first,
+                                               const char* last,
+                                               const unsigned_fast_type digit_count) -> std::enable_if_t<((!RePhraseIsSigned) && (uintwide_t<RePhraseWidth2, LimbType, AllocatorType, RePhraseIsSigned>::number_of_limbs < number_of_limbs_dec_recursive_threshold)), void>
+    {
+      // Types with fewer limbs than the recursion threshold hold at most
+      // a few thousand decimal digits. Read these limb by limb, which
+      // avoids instantiating the recursive reading for narrow types.
+
+      static_cast<void>(digit_count);
+
+      read_dec_digits_by_limb(tu, first, last);
+    }
+
     template<typename InputIteratorLeftType,
              typename InputIteratorRightType>
     static constexpr auto compare_ranges(      InputIteratorLeftType  a,
@@ -3659,8 +5007,19 @@
     }
     #endif
 
+    static constexpr auto mul_unary_uses_ntt(const size_t other_number_of_limbs) -> bool
+    {
+      // Use NTT multiplication at or above its threshold, as long as
+      // the convolution coefficients can be recovered with the CRT.
+      return
+        (
+             (other_number_of_limbs >= number_of_limbs_ntt_threshold)
+          && (ntt_digit_count(static_cast<unsigned_fast_type>(other_number_of_limbs)) <= detail::ntt_max_digits)
+        );
+    }
+
     template<const size_t OtherWidth2>
-    constexpr auto eval_mul_unary(const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& other) -> std::enable_if_t<((OtherWidth2 / std::numeric_limits<LimbType>::digits) < number_of_limbs_karatsuba_threshold), void>
+    constexpr auto eval_mul_unary(const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& other) -> std::enable_if_t<(((OtherWidth2 / std::numeric_limits<LimbType>::digits) < number_of_limbs_karatsuba_threshold) && (!mul_unary_uses_ntt(OtherWidth2 / std::numeric_limits<LimbType>::digits))), void>
     {
       // Unary multiplication function using schoolbook multiplication,
       // but we only need to retain the low half of the n*n algorithm.
@@ -3669,14 +5028,7 @@
 
       const auto local_other_number_of_limbs = local_other_wide_integer_type::number_of_limbs;
 
-      using local_other_representation_type = typename local_other_wide_integer_type::representation_type;
-
-      local_other_representation_type result
-      {
-        static_cast<typename representation_type::size_type>(local_other_number_of_limbs),
-        static_cast<typename representation_type::value_type>(UINT8_C(0)),
-        typename representation_type::allocator_type()
-      };
+      scratch_array_type<limb_type, local_other_number_of_limbs> result { };
 
       eval_multiply_n_by_n_to_lo_part(result.begin(),
                                       values.cbegin(),
@@ -3689,55 +5041,160 @@
     }
 
     template<const size_t OtherWidth2>
-    constexpr auto eval_mul_unary(const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& other) -> std::enable_if_t<((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_karatsuba_threshold), void>
+    constexpr auto eval_mul_unary(const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& other) -> std::enable_if_t<(((OtherWidth2 / std::numeric_limits<LimbType>::digits) >= number_of_limbs_karatsuba_threshold) && (!mul_unary_uses_ntt(OtherWidth2 / std::numeric_limits<LimbType>::digits))), void>
     {
-      // Unary multiplication function using Karatsuba multiplication.
+      // Unary multiplication function using Karatsuba multiplication,
+      // or Toom-3 multiplication for even larger limb counts.
+      // Only the low half of the n*n->2n product is retained.
 
       constexpr auto local_number_of_limbs = uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
 
-      // TBD: Can use specialized allocator or memory pool for these arrays.
-      // Good examples for this (both threaded as well as non-threaded)
-      // can be found in the wide_decimal project.
-      using result_array_type =
-        std::conditional_t<std::is_same<AllocatorType, void>::value,
-                           detail::fixed_static_array <limb_type,
-                                                       static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(2)))>,
-                           detail::fixed_dynamic_array<limb_type,
-                                                       static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(2))),
-                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
-                                                                                                         std::allocator<void>,
-                                                                                                         AllocatorType>>::template rebind_alloc<limb_type>>>;
-
-      using storage_array_type =
-        std::conditional_t<std::is_same<AllocatorType, void>::value,
-                           detail::fixed_static_array <limb_type,
-                                                       static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(4)))>,
-                           detail::fixed_dynamic_array<limb_type,
-                                                       static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(4))),
-                                                       typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
-                                                                                                         std::allocator<void>,
-                                                                                                         AllocatorType>>::template rebind_alloc<limb_type>>>;
-
-      result_array_type  result { };
-      storage_array_type t { };
-
-      eval_multiply_kara_n_by_n_to_2n(result.begin(),
-                                      values.cbegin(),
-                                      other.values.cbegin(),
-                                      local_number_of_limbs,
-                                      t.begin());
+      scratch_array_type<limb_type, static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(2)))>                          result { };
+      scratch_array_type<limb_type, static_cast<size_t>(toom3_storage_limbs(static_cast<unsigned_fast_type>(number_of_limbs)))> t      { };
+
+      eval_multiply_toom3_n_by_n_to_2n(result.begin(),
+                                       values.cbegin(),
+                                       other.values.cbegin(),
+                                       local_number_of_limbs,
+                                       t.begin());
 
       detail::copy_unsafe(result.cbegin(),
                           result.cbegin() + local_number_of_limbs,
                           values.begin());
     }
 
-    template<const bool RePhraseIsSigned>
-    constexpr auto eval_div_unary(const uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& other) -> std::enable_if_t<(!RePhraseIsSigned), void>
+    template<const size_t OtherWidth2>
+    constexpr auto eval_mul_unary(const uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>& other) -> std::enable_if_t<mul_unary_uses_ntt(OtherWidth2 / std::numeric_limits<LimbType>::digits), void>
     {
-      // Unary division function.
+      // Unary multiplication function using number-theoretic transforms
+      // for very wide types. Only the low half of the product is retained.
 
-      eval_divide_knuth(other);
+      constexpr auto local_number_of_limbs = uintwide_t<OtherWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs;
+
+      large_scratch_array_type<std::uint32_t, static_cast<size_t>(ntt_storage_digits(static_cast<unsigned_fast_type>(number_of_limbs)))> t { };
+
+      eval_multiply_ntt(values.begin(),
+                        local_number_of_limbs,
+                        values.cbegin(),
+                        other.values.cbegin(),
+                        t.begin(),
+                        false);
+    }
+
+    template<const size_t RePhraseWidth2 = Width2>
+    constexpr auto eval_square_unary() -> std::enable_if_t<((uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs < number_of_limbs_karatsuba_threshold) && (!mul_unary_uses_ntt(uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs))), void>
+    {
+      // Unary squaring function using schoolbook squaring,
+      // retaining only the low half of the square.
+
+      scratch_array_type<limb_type, number_of_limbs> result { };
+
+      eval_square_n_to_lo_part(result.begin(),
+                               values.cbegin(),
+                               static_cast<unsigned_fast_type>(number_of_limbs));
+
+      detail::copy_unsafe(result.cbegin(),
+                          detail::advance_and_point(result.cbegin(), number_of_limbs),
+                          values.begin());
+    }
+
+    template<const size_t RePhraseWidth2 = Width2>
+    constexpr auto eval_square_unary() -> std::enable_if_t<((uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs >= number_of_limbs_karatsuba_threshold) && (!mul_unary_uses_ntt(uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs))), void>
+    {
+      // Unary squaring function using Karatsuba squaring,
+      // or Toom-3 squaring for even larger limb counts.
+      // Only the low half of the n*n->2n square is retained.
+
+      scratch_array_type<limb_type, static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(2)))>                          result { };
+      scratch_array_type<limb_type, static_cast<size_t>(toom3_storage_limbs(static_cast<unsigned_fast_type>(number_of_limbs)))> t      { };
+
+      eval_square_toom3_n_to_2n(result.begin(),
+                                values.cbegin(),
+                                static_cast<unsigned_fast_type>(number_of_limbs),
+                                t.begin());
+
+      detail::copy_unsafe(result.cbegin(),
+                          detail::advance_and_point(result.cbegin(), number_of_limbs),
+                          values.begin());
+    }
+
+    template<const size_t RePhraseWidth2 = Width2>
+    constexpr auto eval_square_unary() -> std::enable_if_t<mul_unary_uses_ntt(uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs), void>
+    {
+      // Unary squaring function using number-theoretic transforms,
+      // where only one forward transform is needed per prime.
+
+      large_scratch_array_type<std::uint32_t, static_cast<size_t>(ntt_storage_digits(static_cast<unsigned_fast_type>(number_of_limbs)))> t { };
+
+      eval_multiply_ntt(values.begin(),
+                        static_cast<unsigned_fast_type>(number_of_limbs),
+                        values.cbegin(),
+                        values.cbegin(),
+                        t.begin(),
+                        true);
+    }
+
+    template<typename ResultIterator,
+             const size_t RePhraseWidth2 = Width2>
+    static constexpr auto eval_mul_wide(ResultIterator r, const uintwide_t& a, const uintwide_t& b) -> std::enable_if_t<((uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs < number_of_limbs_karatsuba_threshold) && (!mul_unary_uses_ntt(uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs))), void>
+    {
+      // Calculate the full n*n->2n product of a and b in r using schoolbook
+      // multiplication, or schoolbook squaring if a and b are the same object.
+
+      if(&a == &b)
+      {
+        eval_square_n_to_2n(r, a.values.cbegin(), static_cast<unsigned_fast_type>(number_of_limbs));
+      }
+      else
+      {
+        eval_multiply_n_by_n_to_2n(r, a.values.cbegin(), b.values.cbegin(), static_cast<unsigned_fast_type>(number_of_limbs));
+      }
+    }
+
+    template<typename ResultIterator,
+             const size_t RePhraseWidth2 = Width2>
+    static constexpr auto eval_mul_wide(ResultIterator r, const uintwide_t& a, const uintwide_t& b) -> std::enable_if_t<((uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs >= number_of_limbs_karatsuba_threshold) && (!mul_unary_uses_ntt(uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs))), void>
+    {
+      // Calculate the full n*n->2n product of a and b in r using
+      // Karatsuba or Toom-3 multiplication (or squaring).
+
+      scratch_array_type<limb_type, static_cast<size_t>(toom3_storage_limbs(static_cast<unsigned_fast_type>(number_of_limbs)))> t { };
+
+      if(&a == &b)
+      {
+        eval_square_toom3_n_to_2n(r, a.values.cbegin(), static_cast<unsigned_fast_type>(number_of_limbs), t.begin());
+      }
+      else
+      {
+        eval_multiply_toom3_n_by_n_to_2n(r, a.values.cbegin(), b.values.cbegin(), static_cast<unsigned_fast_type>(number_of_limbs), t.begin());
+      }
+    }
+
+    template<typename ResultIterator,
+             const size_t RePhraseWidth2 = Width2>
+    static constexpr auto eval_mul_wide(ResultIterator r, const uintwide_t& a, const uintwide_t& b) -> std::enable_if_t<mul_unary_uses_ntt(uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs), void>
+    {
+      // Calculate the full n*n->2n product of a and b in r
+      // using number-theoretic transforms.
+
+      constexpr auto r_count = static_cast<unsigned_fast_type>(number_of_limbs * static_cast<size_t>(UINT8_C(2)));
+
+      large_scratch_array_type<std::uint32_t, static_cast<size_t>(ntt_storage_digits(r_count))> t { };
+
+      eval_multiply_ntt(r,
+                        r_count,
+                        a.values.cbegin(),
+                        b.values.cbegin(),
+                        t.begin(),
+                        (&a == &b));
+    }
+
+    template<const bool RePhraseIsSigned>
+    constexpr auto eval_div_unary(const uintwide_t<Width2, LimbType, AllocatorType, RePhraseIsSigned>& other) -> std::enable_if_t<(!RePhraseIsSigned), void>
+    {
+      // Unary division function.
+
+      eval_divide_knuth(other);
     }
 
     template<const bool RePhraseIsSigned>
@@ -4514,6 +5971,93 @@
       }
     }
 
+    template<typename ResultIterator,
+             typename InputIterator>
+    static constexpr auto eval_square_n_to_r_count(      ResultIterator     r,
+                                                         InputIterator      a,
+                                                   const unsigned_fast_type count,
+                                                   const unsigned_fast_type r_count) -> void
+    {
+      // Square the count limbs of a and retain the low r_count limbs
+      // of the square, where r_count is either count or 2 * count.
+      // Each of the cross products a[i] * a[j] (i < j) is formed only once.
+      // The sum of the cross products is then doubled and the squares
+      // on the diagonal are added. This saves about half of the
+      // partial products of the multiplication a * a.
+
+      detail::fill_unsafe(r, detail::advance_and_point(r, r_count), static_cast<limb_type>(UINT8_C(0)));
+
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0));
+               (i < count) && (static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(i * 2U) + 1U) < r_count);
+             ++i)
+      {
+        const auto ai = static_cast<limb_type>(*detail::advance_and_point(a, i));
+
+        if(ai != static_cast<limb_type>(UINT8_C(0)))
+        {
+          const auto offset = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(i * 2U) + 1U);
+          const auto j_end  = (detail::min_unsafe)(count, static_cast<unsigned_fast_type>(r_count - i));
+
+          static_cast<void>(eval_multiply_add_1d(detail::advance_and_point(r, offset),
+                                                 static_cast<unsigned_fast_type>(r_count - offset),
+                                                 detail::advance_and_point(a, static_cast<unsigned_fast_type>(i + 1U)),
+                                                 static_cast<unsigned_fast_type>(j_end - static_cast<unsigned_fast_type>(i + 1U)),
+                                                 ai));
+        }
+      }
+
+      auto bit_in = static_cast<limb_type>(UINT8_C(0));
+      auto carry  = static_cast<limb_type>(UINT8_C(0));
+      auto sq     = static_cast<double_limb_type>(UINT8_C(0));
+
+      for(auto k = static_cast<unsigned_fast_type>(UINT8_C(0)); k < r_count; ++k)
+      {
+        const auto k_is_even = (static_cast<unsigned_fast_type>(k & 1U) == static_cast<unsigned_fast_type>(UINT8_C(0)));
+
+        if(k_is_even)
+        {
+          const auto ai = static_cast<limb_type>(*a++);
+
+          sq = static_cast<double_limb_type>(static_cast<double_limb_type>(ai) * ai);
+        }
+
+        const auto rk = static_cast<limb_type>(*r);
+
+        const auto doubled = static_cast<limb_type>(static_cast<limb_type>(rk << static_cast<unsigned>(UINT8_C(1))) | bit_in);
+
+        bit_in = static_cast<limb_type>(rk >> static_cast<unsigned>(std::numeric_limits<limb_type>::digits - 1));
+
+        const auto uv =
+          static_cast<double_limb_type>
+          (
+              static_cast<double_limb_type>(doubled)
+            + static_cast<double_limb_type>(k_is_even ? static_cast<limb_type>(sq) : detail::make_hi<limb_type>(sq))
+            + carry
+          );
+
+        *r++  = static_cast<limb_type>(uv);
+        carry = detail::make_hi<limb_type>(uv);
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIterator>
+    static constexpr auto eval_square_n_to_lo_part(      ResultIterator     r,
+                                                         InputIterator      a,
+                                                   const unsigned_fast_type count) -> void
+    {
+      eval_square_n_to_r_count(r, a, count, count);
+    }
+
+    template<typename ResultIterator,
+             typename InputIterator>
+    static constexpr auto eval_square_n_to_2n(      ResultIterator     r,
+                                                    InputIterator      a,
+                                              const unsigned_fast_type count) -> void
+    {
+      eval_square_n_to_r_count(r, a, count, static_cast<unsigned_fast_type>(count * 2U));
+    }
+
     template<typename ResultIterator,
              typename InputIteratorLeft>
     static constexpr auto eval_multiply_1d(      ResultIterator                                               r,
@@ -4598,7 +6142,7 @@
     static constexpr
     auto eval_multiply_kara_propagate_carry(      InputIteratorLeft                                            t,
                                             const unsigned_fast_type                                           n,
-                                            const typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type carry) -> void
+                                            const typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type carry) -> typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type
     {
       using local_limb_type = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type;
 
@@ -4623,13 +6167,15 @@
 
         ++i;
       }
+
+      return carry_out;
     }
 
     template<typename InputIteratorLeft>
     static constexpr
     auto eval_multiply_kara_propagate_borrow(      InputIteratorLeft  t,
                                              const unsigned_fast_type n,
-                                             const bool               has_borrow) -> void
+                                             const bool               has_borrow) -> bool
     {
       using local_limb_type = typename detail::iterator_detail::iterator_traits<InputIteratorLeft>::value_type;
 
@@ -4658,6 +6204,8 @@
 
         ++i;
       }
+
+      return has_borrow_out;
     }
 
     template<typename ResultIterator,
@@ -4672,7 +6220,9 @@
                                                InputIteratorTemp  t) -> void
     {
       // Small-size fallback: use schoolbook full 2n multiplication.
-      if(n <= static_cast<unsigned_fast_type>(number_of_limbs_schoolbook_fallback))
+      // This is also used for odd n, which can not be split in halves.
+      if(   (n <= static_cast<unsigned_fast_type>(number_of_limbs_schoolbook_fallback))
+         || ((n % static_cast<unsigned_fast_type>(UINT8_C(2))) != static_cast<unsigned_fast_type>(UINT8_C(0))))
       {
         static_cast<void>(t);
 
@@ -4831,1618 +6381,4997 @@
       }
     }
 
-    constexpr auto eval_divide_knuth(const uintwide_t& other, uintwide_t* remainder = nullptr) -> void
+    template<typename ResultIterator,
+             typename InputIterator,
+             typename InputIteratorTemp>
+    static constexpr
+    auto eval_square_kara_n_to_2n(      ResultIterator     r, // NOLINT(misc-no-recursion)
+                                  const InputIterator      a,
+                                  const unsigned_fast_type n,
+                                        InputIteratorTemp  t) -> void
     {
-      // Use Knuth's long division algorithm.
-      // The loop-ordering of indices in Knuth's original
-      // algorithm has been reversed due to the data format
-      // used here. Several optimizations and combinations
-      // of logic have been carried out in the source code.
-
-      // See also:
-      // D.E. Knuth, "The Art of Computer Programming, Volume 2:
-      // Seminumerical Algorithms", Addison-Wesley (1998),
-      // Section 4.3.1 Algorithm D and Exercise 16.
-
-      using local_uint_index_type = unsigned_fast_type;
+      if(   (n <= static_cast<unsigned_fast_type>(number_of_limbs_schoolbook_fallback))
+         || ((n % static_cast<unsigned_fast_type>(UINT8_C(2))) != static_cast<unsigned_fast_type>(UINT8_C(0))))
+      {
+        static_cast<void>(t);
 
-      local_uint_index_type u_offset { };
-      local_uint_index_type v_offset { };
+        eval_square_n_to_2n(r, a, n);
+      }
+      else
+      {
+        // This is the Karatsuba multiplication of a with itself:
+        // a^2 = [b^N + b^(N/2)] a1^2 - [b^(N/2)](a1 - a0)^2 + [b^(N/2) + 1] a0^2
+        // All three recursive products are squares. The sign
+        // of the middle term is always negative, and only one
+        // difference |a1 - a0| needs to be formed.
+        // The result and temporary partitions are the same as
+        // those of eval_multiply_kara_n_by_n_to_2n.
 
-      auto crit_u =       values.crbegin();
-      auto crit_v = other.values.crbegin();
+        const auto nh = static_cast<unsigned_fast_type>(n / 2U);
 
-      while(crit_u != values.crend() && (*crit_u == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
-      {
-        ++crit_u;
-        ++u_offset;
-      }
+        const InputIterator a0 = a;
+        const InputIterator a1 = detail::advance_and_point(a, nh);
 
-      while(crit_v != other.values.crend() && (*crit_v == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
-      {
-        ++crit_v;
-        ++v_offset;
-      }
+        ResultIterator r0 = r;
+        ResultIterator r1 = detail::advance_and_point(r, nh);
+        ResultIterator r2 = detail::advance_and_point(r, n);
+        ResultIterator r3 = detail::advance_and_point(r, static_cast<unsigned_fast_type>(n + nh));
 
-      if(v_offset == static_cast<local_uint_index_type>(number_of_limbs))
-      {
-        // The denominator is zero. Set the maximum value and return.
-        // This also catches (0 / 0) and sets the maximum value for it.
-        static_cast<void>(operator=(limits_helper_max<IsSigned>())); // LCOV_EXCL_LINE
+        InputIteratorTemp t0 = t;
+        InputIteratorTemp t2 = detail::advance_and_point(t, n);
+        InputIteratorTemp t4 = detail::advance_and_point(t, static_cast<unsigned_fast_type>(n * 2U));
 
-        if(remainder != nullptr) // LCOV_EXCL_LINE
-        {
-          detail::fill_unsafe(remainder->values.begin(), remainder->values.end(), static_cast<limb_type>(UINT8_C(0))); // LCOV_EXCL_LINE
-        }
-      }
-      else if(u_offset == static_cast<local_uint_index_type>(number_of_limbs))
-      {
-        // The numerator is zero. Do nothing and return.
+        // Compute a1^2 -> r2 and a0^2 -> r0, and keep a copy of a0^2 in t2.
+        eval_square_kara_n_to_2n(r2, a1, nh, t0);
+        eval_square_kara_n_to_2n(r0, a0, nh, t0);
 
-        if(remainder != nullptr)
-        {
-          *remainder = uintwide_t(static_cast<std::uint8_t>(UINT8_C(0)));
-        }
-      }
-      else if(static_cast<local_uint_index_type>(v_offset + static_cast<local_uint_index_type>(1U)) == static_cast<local_uint_index_type>(number_of_limbs))
-      {
-        // The denominator has one single limb.
-        // Use a one-dimensional division algorithm.
-        const limb_type short_denominator = *other.values.cbegin();
+        detail::copy_unsafe(r0, detail::advance_and_point(r0, n), t2);
 
-        eval_divide_by_single_limb(short_denominator, u_offset, remainder);
-      }
-      else
-      {
-        const auto result_of_compare_left_with_right = compare(other);
+        // r1 += a1^2, then r1 += a0^2.
+        eval_multiply_kara_propagate_carry(r3, nh, static_cast<limb_type>(eval_add_n(r1, r1, r2, n)));
+        eval_multiply_kara_propagate_carry(r3, nh, static_cast<limb_type>(eval_add_n(r1, r1, t2, n)));
 
-        const auto left_is_less_than_right = (result_of_compare_left_with_right == INT8_C(-1));
-        const auto left_is_equal_to_right  = (result_of_compare_left_with_right == INT8_C( 0));
+        // r1 -= (a1 - a0)^2, unless a1 and a0 are equal.
+        const auto cmp_result_a1a0 = compare_ranges(a1, a0, nh);
 
-        if(left_is_less_than_right)
+        if(cmp_result_a1a0 != static_cast<std::int_fast8_t>(INT8_C(0)))
         {
-          // If the denominator is larger than the numerator,
-          // then the result of the division is zero.
-          if(remainder != nullptr)
+          if(cmp_result_a1a0 == static_cast<std::int_fast8_t>(INT8_C(1)))
           {
-            *remainder = *this;
+            static_cast<void>(eval_subtract_n(t0, a1, a0, nh));
           }
-
-          operator=(static_cast<std::uint8_t>(UINT8_C(0)));
-        }
-        else if(left_is_equal_to_right)
-        {
-          // If the denominator is equal to the numerator,
-          // then the result of the division is one.
-          operator=(static_cast<std::uint8_t>(UINT8_C(1)));
-
-          if(remainder != nullptr)
+          else
           {
-            *remainder = uintwide_t(static_cast<std::uint8_t>(UINT8_C(0)));
+            static_cast<void>(eval_subtract_n(t0, a0, a1, nh));
           }
-        }
-        else
-        {
-          eval_divide_knuth_core(u_offset, v_offset, other, remainder);
+
+          eval_square_kara_n_to_2n(t2, t0, nh, t4);
+
+          eval_multiply_kara_propagate_borrow(r3, nh, static_cast<bool>(eval_subtract_n(r1, r1, t2, n)));
         }
       }
     }
 
-    constexpr auto eval_divide_knuth_core(const unsigned_fast_type u_offset, // NOLINT(readability-function-cognitive-complexity)
-                                          const unsigned_fast_type v_offset,
-                                          const uintwide_t& other,
-                                                uintwide_t* remainder) -> void
+    static constexpr auto toom3_min_limbs() -> unsigned_fast_type
     {
-      using local_uint_index_type = unsigned_fast_type;
-
-      // We will now use the Knuth long division algorithm.
+      // Toom-3 splits into three pieces, the top one being non-empty.
+      return
+        static_cast<unsigned_fast_type>
+        (
+          (detail::max_unsafe)(static_cast<unsigned_fast_type>(number_of_limbs_toom3_threshold),
+                               static_cast<unsigned_fast_type>(UINT8_C(16)))
+        );
+    }
 
-      // Compute the normalization factor d.
-      const auto d =
-        static_cast<limb_type>
+    static constexpr auto toom3_piece_limbs(const unsigned_fast_type n) -> unsigned_fast_type
+    {
+      // The limb count k of the two lower pieces, being about n/3.
+      // It is rounded up to an even number, so that the recursive
+      // products (having k and k + 2 limbs) are even-sized, which
+      // keeps them on the Karatsuba path below the Toom-3 threshold.
+      return
+        static_cast<unsigned_fast_type>
         (
-            static_cast<double_limb_type>(static_cast<double_limb_type>(UINT8_C(1)) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits))
-          / static_cast<double_limb_type>(static_cast<double_limb_type>(*detail::advance_and_point(other.values.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs - 1U) - v_offset))) + static_cast<limb_type>(1U))
+            static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n + 2U) / 3U)
+          + static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n + 2U) / 3U) & 1U)
         );
+    }
 
-      // Step D1(b), normalize u -> u * d = uu.
-      // Step D1(c): normalize v -> v * d = vv.
+    static constexpr auto toom3_storage_limbs(const unsigned_fast_type n) -> unsigned_fast_type // NOLINT(misc-no-recursion)
+    {
+      // The temporary storage needed by eval_multiply_toom3_n_by_n_to_2n.
+      // Below the Toom-3 threshold, this is the storage of Karatsuba.
+      return
+        static_cast<unsigned_fast_type>
+        (
+          (n < toom3_min_limbs())
+            ? static_cast<unsigned_fast_type>(n * static_cast<unsigned_fast_type>(UINT8_C(4)))
+            : static_cast<unsigned_fast_type>
+              (
+                  static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(toom3_piece_limbs(n) + 2U) * static_cast<unsigned_fast_type>(UINT8_C(14)))
+                + toom3_storage_limbs(static_cast<unsigned_fast_type>(toom3_piece_limbs(n) + 2U))
+              )
+        );
+    }
 
-      using uu_array_type =
-        std::conditional_t<std::is_same<AllocatorType, void>::value,
-                            detail::fixed_static_array <limb_type, number_of_limbs + size_t { UINT8_C(1) }>,
-                            detail::fixed_dynamic_array<limb_type,
-                                                        number_of_limbs + size_t { UINT8_C(1) },
-                                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
-                                                                                                          std::allocator<void>,
-                                                                                                          AllocatorType>>::template rebind_alloc<limb_type>>>;
+    template<typename ResultIterator,
+             typename InputIterator>
+    static constexpr auto eval_multiply_add_1d(      ResultIterator     r,
+                                             const unsigned_fast_type r_count,
+                                                   InputIterator      u,
+                                             const unsigned_fast_type u_count,
+                                             const limb_type          s) -> limb_type
+    {
+      // Calculate r += u * s, for u_count <= r_count. Return the carry.
 
-      uu_array_type uu { };
+      auto carry = static_cast<limb_type>(UINT8_C(0));
 
-      representation_type
-        vv
-        {
-          static_cast<typename representation_type::size_type>(number_of_limbs),
-          static_cast<typename representation_type::value_type>(UINT8_C(0)),
-          typename representation_type::allocator_type() // LCOV_EXCL_LINE
-        };
+      auto i = static_cast<unsigned_fast_type>(UINT8_C(0));
 
-      if(d > static_cast<limb_type>(UINT8_C(1)))
+      for( ; i < u_count; ++i)
       {
-        {
-          const auto num_limbs_minus_u_ofs =
-            static_cast<size_t>
-            (
-              static_cast<local_uint_index_type>(number_of_limbs) - u_offset
-            );
+        const auto uv =
+          static_cast<double_limb_type>
+          (
+              static_cast<double_limb_type>(static_cast<double_limb_type>(*u++) * s)
+            + static_cast<double_limb_type>(static_cast<double_limb_type>(*r) + carry)
+          );
 
-          const auto u_carry =
-            eval_multiply_1d
-            (
-              uu.begin(),
-              values.cbegin(),
-              d,
-              static_cast<unsigned_fast_type>(num_limbs_minus_u_ofs)
-            );
+        *r++  = static_cast<limb_type>(uv);
+        carry = detail::make_hi<limb_type>(uv);
+      }
 
-          *(uu.begin() + num_limbs_minus_u_ofs) = u_carry;
-        }
+      for( ; ((i < r_count) && (carry != static_cast<limb_type>(UINT8_C(0)))); ++i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto uv = static_cast<double_limb_type>(static_cast<double_limb_type>(*r) + carry);
 
-        static_cast<void>
-        (
-          eval_multiply_1d
-          (
-            vv.begin(),
-            other.values.cbegin(),
-            d,
-            static_cast<unsigned_fast_type>(number_of_limbs - v_offset)
-          )
-        );
+        *r++  = static_cast<limb_type>(uv);
+        carry = detail::make_hi<limb_type>(uv);
       }
-      else
-      {
-        detail::copy_unsafe(values.cbegin(), values.cend(), uu.begin());
 
-        *(uu.begin() + static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs) - u_offset)) = static_cast<limb_type>(UINT8_C(0));
+      return carry;
+    }
 
-        vv = other.values;
-      }
+    template<typename ResultIterator,
+             typename InputIterator>
+    static constexpr auto eval_multiply_sub_1d(      ResultIterator     r,
+                                             const unsigned_fast_type r_count,
+                                                   InputIterator      u,
+                                             const unsigned_fast_type u_count,
+                                             const limb_type          s) -> limb_type
+    {
+      // Calculate r -= u * s, for u_count <= r_count. Return the borrow.
 
-      // Step D2: Initialize j.
-      // Step D7: Loop on j from m to 0.
+      auto borrow = static_cast<limb_type>(UINT8_C(0));
 
-      const auto n   = static_cast<local_uint_index_type>                                   (number_of_limbs - v_offset);
-      const auto m   = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(number_of_limbs - u_offset) - n);
-      const auto vj0 = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(n - static_cast<local_uint_index_type>(UINT8_C(1))));
+      auto i = static_cast<unsigned_fast_type>(UINT8_C(0));
 
-      auto vv_at_vj0_it = detail::advance_and_point(vv.cbegin(), static_cast<size_t>(vj0)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+      for( ; i < u_count; ++i)
+      {
+        const auto uv =
+          static_cast<double_limb_type>
+          (
+            static_cast<double_limb_type>(static_cast<double_limb_type>(*u++) * s) + borrow
+          );
 
-      const auto vv_at_vj0           = *vv_at_vj0_it--;
-      const auto vv_at_vj0_minus_one = *vv_at_vj0_it;
+        const auto lo = static_cast<limb_type>(uv);
 
-      auto values_at_m_minus_j_it = detail::advance_and_point(values.begin(), static_cast<size_t>(m)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+        borrow = static_cast<limb_type>(detail::make_hi<limb_type>(uv) + ((*r < lo) ? 1U : 0U));
 
-      for(auto j = static_cast<local_uint_index_type>(UINT8_C(0)); j <= m; ++j) // NOLINT(altera-id-dependent-backward-branch)
+        *r = static_cast<limb_type>(*r - lo);
+
+        ++r;
+      }
+
+      for( ; ((i < r_count) && (borrow != static_cast<limb_type>(UINT8_C(0)))); ++i) // NOLINT(altera-id-dependent-backward-branch)
       {
-        // Step D3 [Calculate q_hat].
-        //   if u[j] == v[j0]
-        //     set q_hat = b - 1
-        //   else
-        //     set q_hat = (u[j] * b + u[j + 1]) / v[1]
+        const auto r_old = *r;
 
-        const auto uj     = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(number_of_limbs + 1U) - 1U) - u_offset) - j);
-        const auto u_j_j1 = static_cast<double_limb_type>(static_cast<double_limb_type>(static_cast<double_limb_type>(*(uu.cbegin() + static_cast<size_t>(uj))) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)) + *(uu.cbegin() + static_cast<size_t>(uj - 1U)));
+        *r++ = static_cast<limb_type>(r_old - borrow);
 
-        auto q_hat =
+        borrow = ((r_old < borrow) ? static_cast<limb_type>(UINT8_C(1)) : static_cast<limb_type>(UINT8_C(0)));
+      }
+
+      return borrow;
+    }
+
+    template<typename ResultIterator>
+    static constexpr auto eval_toom_shift_right_1(ResultIterator r, const unsigned_fast_type count) -> void
+    {
+      // Halve the nonnegative value r having count limbs.
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < count; ++i)
+      {
+        const auto hi =
           static_cast<limb_type>
           (
-            (*(uu.cbegin() + static_cast<size_t>(uj)) == vv_at_vj0)
-              ? (std::numeric_limits<limb_type>::max)()
-              : static_cast<limb_type>(u_j_j1 / vv_at_vj0)
+            (static_cast<unsigned_fast_type>(i + 1U) < count)
+              ? static_cast<limb_type>(*detail::advance_and_point(r, static_cast<size_t>(UINT8_C(1))) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits - 1))
+              : static_cast<limb_type>(UINT8_C(0))
           );
 
-        // Decrease q_hat if necessary.
-        // This means that q_hat must be decreased if the
-        // expression [(u[uj] * b + u[uj - 1] - q_hat * v[vj0 - 1]) * b]
-        // exceeds the range of uintwide_t.
+        *r = static_cast<limb_type>(static_cast<limb_type>(*r >> 1U) | hi);
 
-        {
-          const auto u_j_minus_2 =
-            *detail::advance_and_point(uu.cbegin(), static_cast<size_t>(uj - 2U));
+        ++r;
+      }
+    }
 
-          auto t =
-            static_cast<double_limb_type>
-            (
-              u_j_j1 - static_cast<double_limb_type>(q_hat * static_cast<double_limb_type>(vv_at_vj0))
-            );
+    template<typename ResultIterator>
+    static constexpr auto eval_toom_divide_exact_3(ResultIterator r, const unsigned_fast_type count) -> void
+    {
+      // Divide r having count limbs by 3, where the remainder is known to be zero.
+      detail::iterator_detail::reverse_iterator<ResultIterator> ri(detail::advance_and_point(r, count));
 
-          while(true)
-          {
-            const bool t_overflow =
-              (detail::make_hi<limb_type>(t) != static_cast<limb_type>(UINT8_C(0)));
+      auto remainder = static_cast<limb_type>(UINT8_C(0));
 
-            const auto lhs =
-              static_cast<double_limb_type>
-              (
-                static_cast<double_limb_type>(vv_at_vj0_minus_one) * q_hat
-              );
+      for( ; ri != detail::iterator_detail::reverse_iterator<ResultIterator>(r); ++ri) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto numerator =
+          static_cast<double_limb_type>
+          (
+              static_cast<double_limb_type>(static_cast<double_limb_type>(remainder) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits))
+            | *ri
+          );
 
-            const auto rhs =
-              static_cast<double_limb_type>
-              (
-                static_cast<double_limb_type>(t << static_cast<unsigned>(std::numeric_limits<limb_type>::digits))
-                + u_j_minus_2
-              );
+        const auto q = static_cast<double_limb_type>(numerator / 3U);
 
-            if(t_overflow || (lhs <= rhs))
-            {
-              break;
-            }
+        *ri       = static_cast<limb_type>(q);
+        remainder = static_cast<limb_type>(numerator - static_cast<double_limb_type>(q * 3U));
+      }
+    }
 
-            t = static_cast<double_limb_type>(t + vv_at_vj0);
-            --q_hat;
-          }
-        }
+    template<typename ResultIterator,
+             typename InputIterator>
+    static constexpr auto eval_toom3_evaluate(ResultIterator     p1,
+                                              ResultIterator     pm1,
+                                              ResultIterator     p2,
+                                              InputIterator      u,
+                                              unsigned_fast_type k,
+                                              unsigned_fast_type k_top,
+                                              unsigned_fast_type m) -> bool
+    {
+      // Evaluate the polynomial u0 + u1 x + u2 x^2 (where u2 has k_top
+      // and the others have k limbs) at x = 1, -1 and 2. Each value has
+      // m > k limbs. The magnitude of u(-1) is stored in pm1 and the
+      // return value is true if u(-1) is negative.
 
-        {
-          // Step D4: Multiply and subtract.
-          // Replace u[j, ... j + n] by u[j, ... j + n] - q_hat * v[1, ... n].
+      const InputIterator u0 = u;
+      const InputIterator u1 = detail::advance_and_point(u, k);
+      const InputIterator u2 = detail::advance_and_point(u, static_cast<unsigned_fast_type>(k * 2U));
 
-          // Set nv = q_hat * (v[1, ... n]).
-          uu_array_type nv { };
+      detail::fill_unsafe(p1,  detail::advance_and_point(p1,  m), static_cast<limb_type>(UINT8_C(0)));
+      detail::fill_unsafe(pm1, detail::advance_and_point(pm1, m), static_cast<limb_type>(UINT8_C(0)));
+      detail::fill_unsafe(p2,  detail::advance_and_point(p2,  m), static_cast<limb_type>(UINT8_C(0)));
 
-          *(nv.begin() + static_cast<size_t>(n)) = eval_multiply_1d(nv.begin(), vv.cbegin(), q_hat, n);
+      // p1 = u0 + u2 and pm1 = u1, then pm1 = |u0 - u1 + u2|.
+      static_cast<void>(eval_multiply_add_1d(p1, m, u0, k,     static_cast<limb_type>(UINT8_C(1))));
+      static_cast<void>(eval_multiply_add_1d(p1, m, u2, k_top, static_cast<limb_type>(UINT8_C(1))));
 
-          const auto has_borrow =
-            eval_subtract_n
-            (
-              detail::advance_and_point(uu.begin(),  static_cast<size_t>(static_cast<local_uint_index_type>(uj - n))),
-              detail::advance_and_point(uu.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(uj - n))),
-              nv.cbegin(),
-              static_cast<unsigned_fast_type>
-              (
-                static_cast<local_uint_index_type>(n + static_cast<local_uint_index_type>(UINT8_C(1)))
-              )
-            );
+      detail::copy_unsafe(u1, detail::advance_and_point(u1, k), pm1);
 
-          // Step D5: Test the remainder.
-          // Set the result value: Set result.m_data[m - j] = q_hat.
-          // Use the condition (u[j] < 0), in other words if the borrow
-          // is non-zero, then step D6 needs to be carried out.
+      const auto u_minus_one_is_neg = (compare_ranges(p1, pm1, m) < static_cast<std::int_fast8_t>(INT8_C(0)));
 
-          if(has_borrow)
-          {
-            --q_hat;
+      if(u_minus_one_is_neg)
+      {
+        static_cast<void>(eval_subtract_n(pm1, pm1, p1, m));
+      }
+      else
+      {
+        static_cast<void>(eval_subtract_n(pm1, p1, pm1, m));
+      }
 
-            // Step D6: Add back.
-            // Add v[1, ... n] back to u[j, ... j + n],
-            // and decrease the result by 1.
+      // p1 = u0 + u1 + u2.
+      static_cast<void>(eval_multiply_add_1d(p1, m, u1, k, static_cast<limb_type>(UINT8_C(1))));
 
-            static_cast<void>
-            (
-              eval_add_n(uu.begin() + static_cast<size_t>(static_cast<local_uint_index_type>(uj - n)),
-                          detail::advance_and_point(uu.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(uj - n))),
-                          vv.cbegin(),
-                          static_cast<unsigned_fast_type>(n))
-            );
-          }
-        }
+      // p2 = u0 + 2 u1 + 4 u2.
+      static_cast<void>(eval_multiply_add_1d(p2, m, u0, k,     static_cast<limb_type>(UINT8_C(1))));
+      static_cast<void>(eval_multiply_add_1d(p2, m, u1, k,     static_cast<limb_type>(UINT8_C(2))));
+      static_cast<void>(eval_multiply_add_1d(p2, m, u2, k_top, static_cast<limb_type>(UINT8_C(4))));
 
-        // Get the result data.
-        *values_at_m_minus_j_it = static_cast<limb_type>(q_hat);
+      return u_minus_one_is_neg;
+    }
 
-        if(j < m)
-        {
-          --values_at_m_minus_j_it;
-        }
-      }
+    template<typename ResultIterator,
+             typename TempIterator>
+    static constexpr auto eval_toom3_interpolate(ResultIterator     r,
+                                                 TempIterator       r1,
+                                                 TempIterator       rm1,
+                                                 TempIterator       r2,
+                                                 TempIterator       w2,
+                                                 unsigned_fast_type n,
+                                                 unsigned_fast_type k,
+                                                 bool               r_minus_one_is_neg) -> void
+    {
+      // Interpolate the Toom-3 product from r(0) = w0 in r[0 .. 2k),
+      // r(inf) = w4 in r[4k .. 2n) and the values r(1), |r(-1)|
+      // and r(2) (each having 2m limbs). The coefficients w1, w2
+      // and w3 are then added into the result. The values r(1), r(-1),
+      // r(2) and the storage for w2 are overwritten along the way.
 
-      // Clear the data elements that have not
-      // been computed in the division algorithm.
-      {
-        const auto m_plus_one =
-          static_cast<local_uint_index_type>
-          (
-            static_cast<local_uint_index_type>(m) + static_cast<local_uint_index_type>(UINT8_C(1))
-          );
+      const auto k_top = static_cast<unsigned_fast_type>(n - static_cast<unsigned_fast_type>(k * 2U));
+      const auto m2    = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(k + 2U) * 2U);
 
-        detail::fill_unsafe(detail::advance_and_point(values.begin(), m_plus_one), values.end(), static_cast<limb_type>(UINT8_C(0)));
-      }
+      ResultIterator r_w4 = detail::advance_and_point(r, static_cast<unsigned_fast_type>(k * 4U));
 
-      if(remainder != nullptr)
+      // w2 = (r(1) + r(-1)) / 2 and r1 = w1 + w3 = (r(1) - r(-1)) / 2.
+      if(r_minus_one_is_neg)
       {
-        auto rl_it_fwd = // NOLINT(llvm-qualified-auto,readability-qualified-auto)
-          detail::advance_and_point(remainder->values.begin(), static_cast<signed_fast_type>(n));
+        static_cast<void>(eval_subtract_n(w2, r1, rm1, m2));
+        static_cast<void>(eval_add_n     (r1, r1, rm1, m2));
+      }
+      else
+      {
+        static_cast<void>(eval_add_n     (w2, r1, rm1, m2));
+        static_cast<void>(eval_subtract_n(r1, r1, rm1, m2));
+      }
 
-        if(d == static_cast<limb_type>(UINT8_C(1)))
-        {
-          detail::copy_unsafe(uu.cbegin(),
-                              detail::advance_and_point(uu.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs - v_offset))),
-                              remainder->values.begin());
-        }
-        else
-        {
-          auto previous_u = static_cast<limb_type>(UINT8_C(0));
+      eval_toom_shift_right_1(w2, m2);
+      eval_toom_shift_right_1(r1, m2);
 
-          auto rl_it_rev = static_cast<reverse_iterator>(rl_it_fwd);
+      const auto k2     = static_cast<unsigned_fast_type>(k * 2U);
+      const auto k_top2 = static_cast<unsigned_fast_type>(k_top * 2U);
 
-          auto ul =
-            static_cast<signed_fast_type>
-            (
-              static_cast<size_t>
-              (
-                  number_of_limbs
-                - static_cast<size_t>(v_offset + static_cast<size_t>(UINT8_C(1)))
-              )
-            );
+      static_cast<void>(eval_multiply_sub_1d(w2, m2, r,    k2,     static_cast<limb_type>(UINT8_C(1))));
+      static_cast<void>(eval_multiply_sub_1d(w2, m2, r_w4, k_top2, static_cast<limb_type>(UINT8_C(1))));
 
-          for( ; rl_it_rev != remainder->values.rend(); ++rl_it_rev, --ul) // NOLINT(altera-id-dependent-backward-branch)
-          {
-            const auto t =
-              static_cast<double_limb_type>
-              (
-                  *(uu.cbegin() + static_cast<size_t>(ul))
-                + static_cast<double_limb_type>
-                  (
-                    static_cast<double_limb_type>(previous_u) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)
-                  )
-              );
+      // w3 = ((r(2) - w0 - 4 w2 - 16 w4) / 2 - (w1 + w3)) / 3, stored in r2.
+      static_cast<void>(eval_multiply_sub_1d(r2, m2, r,    k2,     static_cast<limb_type>(UINT8_C( 1))));
+      static_cast<void>(eval_multiply_sub_1d(r2, m2, w2,   m2,     static_cast<limb_type>(UINT8_C( 4))));
+      static_cast<void>(eval_multiply_sub_1d(r2, m2, r_w4, k_top2, static_cast<limb_type>(UINT8_C(16))));
 
-            *rl_it_rev = static_cast<limb_type>(static_cast<double_limb_type>(t / d));
-            previous_u = static_cast<limb_type>(static_cast<double_limb_type>(t - static_cast<double_limb_type>(static_cast<double_limb_type>(d) * *rl_it_rev)));
-          }
-        }
+      eval_toom_shift_right_1(r2, m2);
 
-        detail::fill_unsafe(rl_it_fwd, remainder->values.end(), static_cast<limb_type>(UINT8_C(0)));
+      static_cast<void>(eval_subtract_n(r2, r2, r1, m2));
+
+      eval_toom_divide_exact_3(r2, m2);
+
+      // w1 = (w1 + w3) - w3, stored in r1.
+      static_cast<void>(eval_subtract_n(r1, r1, r2, m2));
+
+      // Add w1, w2 and w3 into the result at offsets k, 2k and 3k.
+      // These coefficients do not overflow the 2n limbs of the result,
+      // so their leading limbs beyond the result are zero.
+      const auto n2 = static_cast<unsigned_fast_type>(n * 2U);
+
+      for(auto j = static_cast<unsigned_fast_type>(UINT8_C(1)); j < static_cast<unsigned_fast_type>(UINT8_C(4)); ++j)
+      {
+        const auto offset = static_cast<unsigned_fast_type>(k * j);
+        const auto room   = static_cast<unsigned_fast_type>(n2 - offset);
+
+        const TempIterator w = ((j == 1U) ? r1 : ((j == 2U) ? w2 : r2));
+
+        static_cast<void>(eval_multiply_add_1d(detail::advance_and_point(r, offset), room, w, (detail::min_unsafe)(m2, room), static_cast<limb_type>(UINT8_C(1))));
       }
     }
 
-    template<typename IntegralType>
-    static constexpr auto exceeds_width(IntegralType n) -> bool
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorTemp>
+    static constexpr
+    auto eval_multiply_toom3_n_by_n_to_2n(      ResultIterator     r, // NOLINT(misc-no-recursion)
+                                          const InputIteratorLeft  a,
+                                          const InputIteratorRight b,
+                                          const unsigned_fast_type n,
+                                                InputIteratorTemp  t) -> void
     {
-      return (static_cast<size_t>(n) >= uintwide_t::my_width2);
-    }
+      if(n < toom3_min_limbs())
+      {
+        // Below the Toom-3 threshold, use Karatsuba multiplication
+        // (which itself falls back to schoolbook multiplication).
+        eval_multiply_kara_n_by_n_to_2n(r, a, b, n, t);
+      }
+      else
+      {
+        // Based on "Algorithm 1.4 ToomCook3", Sect. 1.3.3, page 7
+        // of R.P. Brent and P. Zimmermann, "Modern Computer Arithmetic",
+        // Cambridge University Press (2011).
 
-    WIDE_INTEGER_NODISCARD constexpr auto right_shift_fill_value() const -> limb_type
-    {
-      return
-        static_cast<limb_type>
-        (
-          (!is_neg(*this)) ? static_cast<limb_type>(UINT8_C(0))
-                           : (std::numeric_limits<limb_type>::max)()
-        );
+        // Split a = a0 + a1 x + a2 x^2 with x = base^k, and likewise b.
+        // Evaluate at 0, 1, -1, 2 and infinity, multiply the five pairs
+        // of values recursively and interpolate the coefficients w0...w4
+        // of the product with:
+        //   w0 = r(0), w4 = r(inf),
+        //   w2 = (r(1) + r(-1)) / 2 - w0 - w4,
+        //   w1 + w3 = (r(1) - r(-1)) / 2,
+        //   w3 = ((r(2) - w0 - 4 w2 - 16 w4) / 2 - (w1 + w3)) / 3,
+        //   w1 = (w1 + w3) - w3.
+        // All of these values are nonnegative, except for r(-1) whose
+        // sign is tracked separately. So unsigned arithmetic suffices.
+
+        const auto k     = toom3_piece_limbs(n);
+        const auto k_top = static_cast<unsigned_fast_type>(n - static_cast<unsigned_fast_type>(k * 2U));
+        const auto m     = static_cast<unsigned_fast_type>(k + 2U);
+
+        // Temporary layout inside t:
+        // t[ 0m ..  3m) : a(1), |a(-1)|, a(2)
+        // t[ 3m ..  6m) : b(1), |b(-1)|, b(2)
+        // t[ 6m .. 14m) : r(1), |r(-1)|, r(2) and one more value, each of 2m limbs
+        // t[14m .. ...) : workspace for deeper recursion
+        InputIteratorTemp a1  = t;
+        InputIteratorTemp am1 = detail::advance_and_point(t, static_cast<unsigned_fast_type>(m *  1U));
+        InputIteratorTemp a2  = detail::advance_and_point(t, static_cast<unsigned_fast_type>(m *  2U));
+        InputIteratorTemp b1  = detail::advance_and_point(t, static_cast<unsigned_fast_type>(m *  3U));
+        InputIteratorTemp bm1 = detail::advance_and_point(t, static_cast<unsigned_fast_type>(m *  4U));
+        InputIteratorTemp b2  = detail::advance_and_point(t, static_cast<unsigned_fast_type>(m *  5U));
+        InputIteratorTemp r1  = detail::advance_and_point(t, static_cast<unsigned_fast_type>(m *  6U));
+        InputIteratorTemp rm1 = detail::advance_and_point(t, static_cast<unsigned_fast_type>(m *  8U));
+        InputIteratorTemp r2  = detail::advance_and_point(t, static_cast<unsigned_fast_type>(m * 10U));
+        InputIteratorTemp w2  = detail::advance_and_point(t, static_cast<unsigned_fast_type>(m * 12U));
+        InputIteratorTemp tn  = detail::advance_and_point(t, static_cast<unsigned_fast_type>(m * 14U));
+
+        const auto a_minus_one_is_neg = eval_toom3_evaluate(a1, am1, a2, a, k, k_top, m);
+        const auto b_minus_one_is_neg = eval_toom3_evaluate(b1, bm1, b2, b, k, k_top, m);
+
+        // The product w0 = a0 * b0 goes into r[0 .. 2k) and the product
+        // w4 = a2 * b2 goes into r[4k .. 2n). The rest of r is cleared.
+        ResultIterator r_w4 = detail::advance_and_point(r, static_cast<unsigned_fast_type>(k * 4U));
+
+        eval_multiply_toom3_n_by_n_to_2n(r,    a, b, k, tn);
+        eval_multiply_toom3_n_by_n_to_2n(r_w4,
+                                         detail::advance_and_point(a, static_cast<unsigned_fast_type>(k * 2U)),
+                                         detail::advance_and_point(b, static_cast<unsigned_fast_type>(k * 2U)),
+                                         k_top,
+                                         tn);
+
+        detail::fill_unsafe(detail::advance_and_point(r, static_cast<unsigned_fast_type>(k * 2U)), r_w4, static_cast<limb_type>(UINT8_C(0)));
+
+        eval_multiply_toom3_n_by_n_to_2n(r1,  a1,  b1,  m, tn);
+        eval_multiply_toom3_n_by_n_to_2n(rm1, am1, bm1, m, tn);
+        eval_multiply_toom3_n_by_n_to_2n(r2,  a2,  b2,  m, tn);
+
+        eval_toom3_interpolate(r, r1, rm1, r2, w2, n, k, (a_minus_one_is_neg != b_minus_one_is_neg));
+      }
     }
 
-    template<typename IntegralType>
-    constexpr auto shl(IntegralType n) -> void
+    template<typename ResultIterator,
+             typename InputIterator,
+             typename InputIteratorTemp>
+    static constexpr
+    auto eval_square_toom3_n_to_2n(      ResultIterator     r, // NOLINT(misc-no-recursion)
+                                   const InputIterator      a,
+                                   const unsigned_fast_type n,
+                                         InputIteratorTemp  t) -> void
     {
-      const auto offset =
-        (detail::min_unsafe)(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) / static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits)),
-                             static_cast<unsigned_fast_type>(number_of_limbs));
+      if(n < toom3_min_limbs())
+      {
+        eval_square_kara_n_to_2n(r, a, n, t);
+      }
+      else
+      {
+        // This is the Toom-3 multiplication of a with itself.
+        // Only a is evaluated, the five recursive products are squares
+        // and r(-1) = a(-1)^2 is nonnegative. The temporary layout
+        // is the one of eval_multiply_toom3_n_by_n_to_2n, where
+        // the storage for the values of b is not used.
 
-      const auto left_shift_amount = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) % static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits));
+        const auto k     = toom3_piece_limbs(n);
+        const auto k_top = static_cast<unsigned_fast_type>(n - static_cast<unsigned_fast_type>(k * 2U));
+        const auto m     = static_cast<unsigned_fast_type>(k + 2U);
 
-      if(offset > static_cast<unsigned_fast_type>(UINT8_C(0)))
-      {
-        detail::copy_backward_unsafe(values.cbegin(),
-                                     detail::advance_and_point(values.cbegin(), static_cast<size_t>(number_of_limbs - offset)),
-                                     detail::advance_and_point(values.begin(), static_cast<size_t>(number_of_limbs)));
+        InputIteratorTemp a1  = t;
+        InputIteratorTemp am1 = detail::advance_and_point(t, static_cast<unsigned_fast_type>(m *  1U));
+        InputIteratorTemp a2  = detail::advance_and_point(t, static_cast<unsigned_fast_type>(m *  2U));
+        InputIteratorTemp r1  = detail::advance_and_point(t, static_cast<unsigned_fast_type>(m *  6U));
+        InputIteratorTemp rm1 = detail::advance_and_point(t, static_cast<unsigned_fast_type>(m *  8U));
+        InputIteratorTemp r2  = detail::advance_and_point(t, static_cast<unsigned_fast_type>(m * 10U));
+        InputIteratorTemp w2  = detail::advance_and_point(t, static_cast<unsigned_fast_type>(m * 12U));
+        InputIteratorTemp tn  = detail::advance_and_point(t, static_cast<unsigned_fast_type>(m * 14U));
 
-        detail::fill_unsafe(values.begin(), detail::advance_and_point(values.begin(), static_cast<size_t>(offset)), static_cast<limb_type>(UINT8_C(0)));
+        static_cast<void>(eval_toom3_evaluate(a1, am1, a2, a, k, k_top, m));
+
+        ResultIterator r_w4 = detail::advance_and_point(r, static_cast<unsigned_fast_type>(k * 4U));
+
+        eval_square_toom3_n_to_2n(r,    a, k, tn);
+        eval_square_toom3_n_to_2n(r_w4, detail::advance_and_point(a, static_cast<unsigned_fast_type>(k * 2U)), k_top, tn);
+
+        detail::fill_unsafe(detail::advance_and_point(r, static_cast<unsigned_fast_type>(k * 2U)), r_w4, static_cast<limb_type>(UINT8_C(0)));
+
+        eval_square_toom3_n_to_2n(r1,  a1,  m, tn);
+        eval_square_toom3_n_to_2n(rm1, am1, m, tn);
+        eval_square_toom3_n_to_2n(r2,  a2,  m, tn);
+
+        eval_toom3_interpolate(r, r1, rm1, r2, w2, n, k, false);
       }
+    }
 
-      using local_integral_type = unsigned_fast_type;
+    template<typename InputIterator>
+    static constexpr auto eval_ntt_get_digit(      InputIterator      u,
+                                             const unsigned_fast_type count,
+                                             const unsigned_fast_type j) -> std::uint32_t
+    {
+      // Get the 32-bit digit j of the count limbs in u.
+      constexpr auto limb_digits = static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits);
+      constexpr auto digit_bits  = static_cast<unsigned_fast_type>(std::numeric_limits<std::uint32_t>::digits);
 
-      if(left_shift_amount != static_cast<local_integral_type>(UINT8_C(0)))
+      auto idx   = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(j * digit_bits) / limb_digits);
+      auto shift = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(j * digit_bits) % limb_digits);
+      auto got   = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+      auto result = static_cast<std::uint64_t>(UINT8_C(0));
+
+      while((got < digit_bits) && (idx < count)) // NOLINT(altera-id-dependent-backward-branch)
       {
-        auto part_from_previous_value = static_cast<limb_type>(UINT8_C(0));
+        const auto take = (detail::min_unsafe)(static_cast<unsigned_fast_type>(limb_digits - shift), static_cast<unsigned_fast_type>(digit_bits - got));
 
-        auto ai = detail::advance_and_point(values.begin(), offset); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+        const auto piece =
+          static_cast<std::uint64_t>
+          (
+              static_cast<std::uint64_t>(static_cast<std::uint64_t>(*detail::advance_and_point(u, idx)) >> static_cast<unsigned>(shift))
+            & static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(take)) - 1U)
+          );
 
-        while(ai != values.end()) // NOLINT(altera-id-dependent-backward-branch)
-        {
-          const auto t = *ai;
+        result |= static_cast<std::uint64_t>(piece << static_cast<unsigned>(got));
 
-          *ai++ =
-            static_cast<limb_type>
-            (
-                static_cast<limb_type>(t << static_cast<local_integral_type>(left_shift_amount))
-              | part_from_previous_value
-            );
-
-          const auto right_shift_previous_value =
-            static_cast<local_integral_type>
-            (
-              static_cast<unsigned_fast_type>
-              (
-                  static_cast<std::int_fast32_t>(std::numeric_limits<limb_type>::digits)
-                - static_cast<std::int_fast32_t>(left_shift_amount)
-              )
-            );
+        got   = static_cast<unsigned_fast_type>(got + take);
+        shift = static_cast<unsigned_fast_type>(UINT8_C(0));
 
-          part_from_previous_value = static_cast<limb_type>(t >> right_shift_previous_value);
-        }
+        ++idx;
       }
+
+      return static_cast<std::uint32_t>(result);
     }
 
-    template<typename IntegralType>
-    constexpr auto shr(IntegralType n) -> void
+    template<typename ResultIterator>
+    static constexpr auto eval_ntt_put_digit(      ResultIterator     r,
+                                             const unsigned_fast_type count,
+                                             const unsigned_fast_type j,
+                                             const std::uint32_t      digit) -> void
     {
-      const auto offset =
-        (detail::min_unsafe)(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) / static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits)),
-                             static_cast<unsigned_fast_type>(number_of_limbs));
-
-      const auto right_shift_amount = static_cast<std::uint_fast16_t>(static_cast<unsigned_fast_type>(n) % static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits));
-
-      if(static_cast<size_t>(offset) > static_cast<size_t>(UINT8_C(0)))
-      {
-        detail::copy_unsafe(detail::advance_and_point(values.cbegin(), static_cast<size_t>(offset)),
-                            detail::advance_and_point(values.cbegin(), static_cast<size_t>(number_of_limbs)),
-                            values.begin());
-
-        detail::fill_unsafe(detail::advance_and_point(values.begin(), static_cast<size_t>(static_cast<size_t>(number_of_limbs) - static_cast<size_t>(offset))),
-                            values.end(),
-                            right_shift_fill_value());
-      }
+      // Put the 32-bit digit j into the count limbs in r,
+      // whose bits at the position of the digit are zero.
+      constexpr auto limb_digits = static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits);
+      constexpr auto digit_bits  = static_cast<unsigned_fast_type>(std::numeric_limits<std::uint32_t>::digits);
 
-      using local_integral_type = unsigned_fast_type;
+      auto idx   = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(j * digit_bits) / limb_digits);
+      auto shift = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(j * digit_bits) % limb_digits);
+      auto done  = static_cast<unsigned_fast_type>(UINT8_C(0));
 
-      if(right_shift_amount != static_cast<local_integral_type>(UINT8_C(0)))
+      while((done < digit_bits) && (idx < count)) // NOLINT(altera-id-dependent-backward-branch)
       {
-        auto part_from_previous_value =
-          static_cast<limb_type>
-          (
-            (!is_neg(*this))
-              ? static_cast<limb_type>(UINT8_C(0))
-              : static_cast<limb_type>((std::numeric_limits<limb_type>::max)() << static_cast<std::uint_fast16_t>(static_cast<std::uint_fast16_t>(std::numeric_limits<limb_type>::digits) - right_shift_amount))
-          );
+        const auto take = (detail::min_unsafe)(static_cast<unsigned_fast_type>(limb_digits - shift), static_cast<unsigned_fast_type>(digit_bits - done));
 
-        auto r_ai =
-          static_cast<reverse_iterator>
+        const auto piece =
+          static_cast<std::uint64_t>
           (
-            detail::advance_and_point
-            (
-              values.begin(),
-              static_cast<signed_fast_type>
-              (
-                static_cast<unsigned_fast_type>(number_of_limbs) - offset
-              )
-            )
+              static_cast<std::uint64_t>(static_cast<std::uint64_t>(digit) >> static_cast<unsigned>(done))
+            & static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint64_t>(UINT8_C(1)) << static_cast<unsigned>(take)) - 1U)
           );
 
-        while(r_ai != values.rend()) // NOLINT(altera-id-dependent-backward-branch)
-        {
-          const auto t = *r_ai;
+        auto& limb = *detail::advance_and_point(r, idx);
 
-          *r_ai++ = static_cast<limb_type>(static_cast<limb_type>(t >> static_cast<local_integral_type>(right_shift_amount)) | part_from_previous_value);
+        limb = static_cast<limb_type>(limb | static_cast<limb_type>(piece << static_cast<unsigned>(shift)));
 
-          const auto left_shift_previous_value =
-            static_cast<local_integral_type>
-            (
-              static_cast<unsigned_fast_type>
-              (
-                  static_cast<std::int_fast32_t>(std::numeric_limits<limb_type>::digits)
-                - static_cast<std::int_fast32_t>(right_shift_amount)
-              )
-            );
+        done  = static_cast<unsigned_fast_type>(done + take);
+        shift = static_cast<unsigned_fast_type>(UINT8_C(0));
 
-          part_from_previous_value = static_cast<limb_type>(t << left_shift_previous_value);
-        }
+        ++idx;
       }
     }
 
-    // Read string function.
-    constexpr auto rd_string(const char* str_input, const unsigned_fast_type count, const int base_hint) -> bool // NOLINT(readability-function-cognitive-complexity,bugprone-easily-swappable-parameters)
+    template<typename FieldType,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename DigitIterator>
+    static constexpr auto eval_ntt_convolve(const InputIteratorLeft  a,
+                                            const InputIteratorRight b,
+                                            const unsigned_fast_type count,
+                                            const unsigned_fast_type digit_count,
+                                            const unsigned_fast_type transform_size,
+                                                  DigitIterator      fa,
+                                                  DigitIterator      fb,
+                                            const std::uint32_t*     tw,
+                                            const bool               is_square) -> void
     {
-      detail::fill_unsafe(values.begin(), values.end(), static_cast<limb_type>(UINT8_C(0)));
-
-      const auto str_length =
-        static_cast<unsigned_fast_type>
-        (
-          (count == (std::numeric_limits<unsigned_fast_type>::max)()) ? detail::strlen_unsafe(str_input) : count
-        );
+      // Calculate the cyclic convolution of the digits of a and b
+      // modulo the prime of FieldType. The convolution is stored in fa.
+      // The twiddles tw are those of make_twiddles for transform_size.
 
-      auto pos = static_cast<unsigned_fast_type>(UINT8_C(0));
+      detail::fill_unsafe(fa, detail::advance_and_point(fa, transform_size), static_cast<std::uint32_t>(UINT8_C(0)));
 
-      // Detect: Is there a plus sign?
-      // And if there is a plus sign, skip over the plus sign.
-      if((str_length > static_cast<unsigned_fast_type>(UINT8_C(0))) && (str_input[static_cast<std::size_t>(UINT8_C(0))] == '+')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < digit_count; ++j)
       {
-        ++pos;
+        *detail::advance_and_point(fa, j) = static_cast<std::uint32_t>(eval_ntt_get_digit(a, count, j) % FieldType::prime());
       }
 
-      auto str_has_neg_sign = false;
+      FieldType::transform(fa, transform_size, tw, false);
 
-      // Detect: Is there a minus sign?
-      // And if there is a minus sign, skip over the minus sign.
-      if((str_length > static_cast<unsigned_fast_type>(UINT8_C(0))) && (str_input[static_cast<std::size_t>(UINT8_C(0))] == '-')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      if(is_square)
       {
-        str_has_neg_sign = true;
+        for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < transform_size; ++j)
+        {
+          auto& fa_j = *detail::advance_and_point(fa, j);
 
-        ++pos;
+          fa_j = FieldType::mul(fa_j, fa_j);
+        }
       }
-
-      // Set the base if the client has supplied a non-zero base-hint.
-      auto base = static_cast<std::uint_fast8_t>(base_hint);
-
-      if(base == static_cast<std::uint_fast8_t>(UINT8_C(0)))
+      else
       {
-        base = static_cast<std::uint_fast8_t>(UINT8_C(10));
+        detail::fill_unsafe(fb, detail::advance_and_point(fb, transform_size), static_cast<std::uint32_t>(UINT8_C(0)));
 
-        // Perform a dynamic detection of the base.
-        if(str_length > static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0))))
+        for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < digit_count; ++j)
         {
-          const auto might_be_oct_or_hex = ((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] == '0') && (str_length > static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0))))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          *detail::advance_and_point(fb, j) = static_cast<std::uint32_t>(eval_ntt_get_digit(b, count, j) % FieldType::prime());
+        }
 
-          if(might_be_oct_or_hex)
-          {
-            if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] >= '0') && (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] <= '8')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-            {
-              // The input format is octal.
-              base = static_cast<std::uint_fast8_t>(UINT8_C(8));
+        FieldType::transform(fb, transform_size, tw, false);
 
-              pos = static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)));
-            }
-            else if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] == 'x') || (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] == 'X')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-            {
-              // The input format is hexadecimal.
-              base = static_cast<std::uint_fast8_t>(UINT8_C(16));
+        for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < transform_size; ++j)
+        {
+          auto& fa_j = *detail::advance_and_point(fa, j);
 
-              pos = static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(2)));
-            }
-          }
-          else if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] >= '0') && (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] <= '9')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
-          {
-            // The input format is decimal.
-            ;
-          }
+          fa_j = FieldType::mul(fa_j, *detail::advance_and_point(fb, j));
         }
       }
 
-      auto char_is_valid = true;
+      FieldType::transform(fa, transform_size, tw, true);
+    }
 
-      while((pos < str_length) && char_is_valid) // NOLINT(altera-id-dependent-backward-branch)
-      {
-        const auto c = str_input[pos++]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    static constexpr auto ntt_digit_count(const unsigned_fast_type count) -> unsigned_fast_type
+    {
+      return
+        static_cast<unsigned_fast_type>
+        (
+            static_cast<unsigned_fast_type>
+            (
+                static_cast<unsigned_fast_type>(count * static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits))
+              + static_cast<unsigned_fast_type>(std::numeric_limits<std::uint32_t>::digits - 1)
+            )
+          / static_cast<unsigned_fast_type>(std::numeric_limits<std::uint32_t>::digits)
+        );
+    }
 
-        const auto char_is_apostrophe = (c == static_cast<char>(39));
+    static constexpr auto ntt_transform_length() -> unsigned_fast_type
+    {
+      // The transform size of the NTT multiplication of two values
+      // having number_of_limbs limbs.
+      return detail::ntt_transform_size(ntt_digit_count(static_cast<unsigned_fast_type>(number_of_limbs)));
+    }
 
-        if(!char_is_apostrophe)
-        {
-          if(base == static_cast<std::uint_fast8_t>(UINT8_C(8)))
-          {
-            char_is_valid = ((c >= '0') && (c <= '7'));
+    static constexpr auto ntt_storage_digits(const unsigned_fast_type r_count) -> unsigned_fast_type
+    {
+      // The temporary storage needed by eval_multiply_ntt.
+      return
+        static_cast<unsigned_fast_type>
+        (
+            static_cast<unsigned_fast_type>(ntt_transform_length() * 2U)
+          + static_cast<unsigned_fast_type>(ntt_digit_count(r_count) * 2U)
+        );
+    }
 
-            if(char_is_valid)
-            {
-              const auto uc_oct = static_cast<std::uint8_t>(c - '0');
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename DigitIterator>
+    static constexpr auto eval_multiply_ntt(      ResultIterator     r,
+                                            const unsigned_fast_type r_count,
+                                            const InputIteratorLeft  a,
+                                            const InputIteratorRight b,
+                                                  DigitIterator      t,
+                                            const bool               is_square) -> void
+    {
+      // Calculate the low r_count limbs (being n or 2n) of the product
+      // of the n = number_of_limbs limbs of a and b with number-theoretic
+      // transforms. The limbs are split into digits
+      // of 32 bits. The convolution of these is computed modulo three
+      // primes and the coefficients are recombined with the Chinese
+      // remainder theorem (in the form of Garner's algorithm) while
+      // propagating the carry. Since a and b are no longer needed
+      // for the final step, r may be the same as a or b.
+
+      // Temporary layout inside t:
+      // t[ 0 ..  T)           : transform of a (and the convolution)
+      // t[ T .. 2T)           : transform of b
+      // t[2T .. 2T + R)       : convolution modulo the first prime
+      // t[2T + R .. 2T + 2R)  : convolution modulo the second prime
+      // Here, R is the digit count of the r_count limbs of the result.
+      // It is less than or equal to T, since T is at least 2L - 1
+      // for the digit count L of a and b. The twiddle factors
+      // of each prime are taken from its ntt_twiddle_table.
+
+      constexpr auto count          = static_cast<unsigned_fast_type>(number_of_limbs);
+      constexpr auto digit_count    = ntt_digit_count(count);
+      constexpr auto transform_size = ntt_transform_length();
+
+      const auto r_digit_count = ntt_digit_count(r_count);
+
+      DigitIterator fa = t;
+      DigitIterator fb = detail::advance_and_point(t, transform_size);
+      DigitIterator c0 = detail::advance_and_point(t, static_cast<unsigned_fast_type>(transform_size * 2U));
+      DigitIterator c1 = detail::advance_and_point(c0, r_digit_count);
+
+      eval_ntt_convolve<detail::ntt_field_0>(a, b, count, digit_count, transform_size, fa, fb, detail::ntt_twiddle_table<detail::ntt_field_0, transform_size>::values(), is_square);
+      detail::copy_unsafe(fa, detail::advance_and_point(fa, r_digit_count), c0);
+
+      eval_ntt_convolve<detail::ntt_field_1>(a, b, count, digit_count, transform_size, fa, fb, detail::ntt_twiddle_table<detail::ntt_field_1, transform_size>::values(), is_square);
+      detail::copy_unsafe(fa, detail::advance_and_point(fa, r_digit_count), c1);
+
+      eval_ntt_convolve<detail::ntt_field_2>(a, b, count, digit_count, transform_size, fa, fb, detail::ntt_twiddle_table<detail::ntt_field_2, transform_size>::values(), is_square);
+
+      constexpr auto p0 = detail::ntt_field_0::prime();
+      constexpr auto p1 = detail::ntt_field_1::prime();
+      constexpr auto p2 = detail::ntt_field_2::prime();
+
+      constexpr auto inv_p0_mod_p1    = detail::ntt_field_1::inv(static_cast<std::uint32_t>(p0 % p1));
+      constexpr auto inv_p0p1_mod_p2  = detail::ntt_field_2::inv(detail::ntt_field_2::mul(static_cast<std::uint32_t>(p0 % p2), static_cast<std::uint32_t>(p1 % p2)));
+
+      detail::fill_unsafe(r, detail::advance_and_point(r, r_count), static_cast<limb_type>(UINT8_C(0)));
+
+      auto carry = static_cast<std::uint64_t>(UINT8_C(0));
+
+      for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < r_digit_count; ++j)
+      {
+        // Recombine the coefficient x = a0 + a1 p0 + a2 p0 p1
+        // from its residues modulo p0, p1 and p2.
+        const auto a0 = *detail::advance_and_point(c0, j);
+
+        const auto a1 =
+          detail::ntt_field_1::mul
+          (
+            detail::ntt_field_1::sub(*detail::advance_and_point(c1, j), static_cast<std::uint32_t>(a0 % p1)),
+            inv_p0_mod_p1
+          );
 
-              static_cast<void>(operator<<=(static_cast<unsigned>(UINT8_C(3))));
+        const auto x01_mod_p2 =
+          static_cast<std::uint32_t>
+          (
+            static_cast<std::uint64_t>(a0 + static_cast<std::uint64_t>(static_cast<std::uint64_t>(a1) * p0)) % p2
+          );
 
-              *values.begin() = static_cast<limb_type>(*values.begin() | uc_oct);
-            }
-          }
-          else if(base == static_cast<std::uint_fast8_t>(UINT8_C(10)))
-          {
-            char_is_valid = ((c >= '0') && (c <= '9'));
+        const auto a2 =
+          detail::ntt_field_2::mul
+          (
+            detail::ntt_field_2::sub(*detail::advance_and_point(fa, j), x01_mod_p2),
+            inv_p0p1_mod_p2
+          );
 
-            if(char_is_valid)
-            {
-              const auto uc_dec = static_cast<std::uint8_t>(c - '0');
+        // Here, x = a0 + p0 * (a1 + a2 p1), where the sum in parentheses
+        // fits in 64 bits. Add x to the carry in two 32-bit halves.
+        const auto a12 = static_cast<std::uint64_t>(a1 + static_cast<std::uint64_t>(static_cast<std::uint64_t>(a2) * p1));
 
-              static_cast<void>(mul_by_limb(static_cast<limb_type>(UINT8_C(10))));
+        const auto u =
+          static_cast<std::uint64_t>
+          (
+              static_cast<std::uint64_t>(a0 + carry)
+            + static_cast<std::uint64_t>(static_cast<std::uint64_t>(static_cast<std::uint32_t>(a12)) * p0)
+          );
 
-              static_cast<void>(operator+=(uc_dec));
-            }
-          }
-          else if(base == static_cast<std::uint_fast8_t>(UINT8_C(16)))
-          {
-            const auto char_is_a_to_f_lo((c >= 'a') && (c <= 'f'));
-            const auto char_is_a_to_f_hi((c >= 'A') && (c <= 'F'));
-            const auto char_is_0_to_9   ((c >= '0') && (c <= '9'));
+        eval_ntt_put_digit(r, r_count, j, static_cast<std::uint32_t>(u));
 
-            char_is_valid = (char_is_a_to_f_lo || char_is_a_to_f_hi || char_is_0_to_9);
+        carry =
+          static_cast<std::uint64_t>
+          (
+              static_cast<std::uint64_t>(u >> static_cast<unsigned>(UINT8_C(32)))
+            + static_cast<std::uint64_t>(static_cast<std::uint64_t>(a12 >> static_cast<unsigned>(UINT8_C(32))) * p0)
+          );
+      }
+    }
 
-            if(char_is_valid)
-            {
-              auto uc_hex = static_cast<std::uint8_t>(UINT8_C(0));
+    constexpr auto eval_divide_knuth(const uintwide_t& other, uintwide_t* remainder = nullptr) -> void
+    {
+      // Use Knuth's long division algorithm.
+      // The loop-ordering of indices in Knuth's original
+      // algorithm has been reversed due to the data format
+      // used here. Several optimizations and combinations
+      // of logic have been carried out in the source code.
 
-              if     (char_is_a_to_f_lo) { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(  87))); }
-              else if(char_is_a_to_f_hi) { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(  55))); }
-              else if(char_is_0_to_9)    { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(0x30))); }
+      // See also:
+      // D.E. Knuth, "The Art of Computer Programming, Volume 2:
+      // Seminumerical Algorithms", Addison-Wesley (1998),
+      // Section 4.3.1 Algorithm D and Exercise 16.
 
-              static_cast<void>(operator<<=(static_cast<unsigned>(UINT8_C(4))));
+      using local_uint_index_type = unsigned_fast_type;
 
-              *values.begin() = static_cast<limb_type>(*values.begin() | uc_hex);
-            }
-          }
-        }
-      }
+      local_uint_index_type u_offset { };
+      local_uint_index_type v_offset { };
 
-      if(str_has_neg_sign)
+      auto crit_u =       values.crbegin();
+      auto crit_v = other.values.crbegin();
+
+      while(crit_u != values.crend() && (*crit_u == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
       {
-        // Exclude this line from code coverage, even though explicit
-        // test cases (search for "result_overshift_is_ok") are known
-        // to cover this line.
-        negate(); // LCOV_EXCL_LINE
+        ++crit_u;
+        ++u_offset;
       }
 
-      return char_is_valid;
-    }
-
-    constexpr auto bitwise_not() -> void // LCOV_EXCL_LINE
-    {
-      for(auto it = values.begin(); it != values.end(); ++it) // NOLINT(llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
+      while(crit_v != other.values.crend() && (*crit_v == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
       {
-        *it = static_cast<limb_type>(~(*it));
+        ++crit_v;
+        ++v_offset;
       }
-    } // LCOV_EXCL_LINE
-
-    constexpr auto preincrement() -> void
-    {
-      // Implement self-increment.
-
-      auto it = values.begin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto) // LCOV_EXCL_LINE
 
-      do
+      if(v_offset == static_cast<local_uint_index_type>(number_of_limbs))
       {
-        ++(*it);
+        // The denominator is zero. Set the maximum value and return.
+        // This also catches (0 / 0) and sets the maximum value for it.
+        static_cast<void>(operator=(limits_helper_max<IsSigned>())); // LCOV_EXCL_LINE
+
+        if(remainder != nullptr) // LCOV_EXCL_LINE
+        {
+          detail::fill_unsafe(remainder->values.begin(), remainder->values.end(), static_cast<limb_type>(UINT8_C(0))); // LCOV_EXCL_LINE
+        }
       }
-      while((*it++ == static_cast<limb_type>(UINT8_C(0))) && (it != values.end())); // NOLINT(altera-id-dependent-backward-branch,bugprone-inc-dec-in-conditions)
-    }
+      else if(u_offset == static_cast<local_uint_index_type>(number_of_limbs))
+      {
+        // The numerator is zero. Do nothing and return.
+
+        if(remainder != nullptr)
+        {
+          *remainder = uintwide_t(static_cast<std::uint8_t>(UINT8_C(0)));
+        }
+      }
+      else if(static_cast<local_uint_index_type>(v_offset + static_cast<local_uint_index_type>(1U)) == static_cast<local_uint_index_type>(number_of_limbs))
+      {
+        // The denominator has one single limb.
+        // Use a one-dimensional division algorithm.
+        const limb_type short_denominator = *other.values.cbegin();
+
+        eval_divide_by_single_limb(short_denominator, u_offset, remainder);
+      }
+      else
+      {
+        const auto result_of_compare_left_with_right = compare(other);
+
+        const auto left_is_less_than_right = (result_of_compare_left_with_right == INT8_C(-1));
+        const auto left_is_equal_to_right  = (result_of_compare_left_with_right == INT8_C( 0));
+
+        if(left_is_less_than_right)
+        {
+          // If the denominator is larger than the numerator,
+          // then the result of the division is zero.
+          if(remainder != nullptr)
+          {
+            *remainder = *this;
+          }
+
+          operator=(static_cast<std::uint8_t>(UINT8_C(0)));
+        }
+        else if(left_is_equal_to_right)
+        {
+          // If the denominator is equal to the numerator,
+          // then the result of the division is one.
+          operator=(static_cast<std::uint8_t>(UINT8_C(1)));
+
+          if(remainder != nullptr)
+          {
+            *remainder = uintwide_t(static_cast<std::uint8_t>(UINT8_C(0)));
+          }
+        }
+        else if(   (static_cast<local_uint_index_type>(number_of_limbs - v_offset) >= static_cast<local_uint_index_type>(number_of_limbs_burnikel_ziegler_threshold))
+                && (static_cast<local_uint_index_type>(v_offset - u_offset)            >= static_cast<local_uint_index_type>(number_of_limbs_burnikel_ziegler_threshold)))
+        {
+          // Both the divisor and the quotient are long. Use recursive
+          // division, which builds on the fast multiplication.
+          eval_divide_burnikel_ziegler(u_offset, v_offset, other, remainder);
+        }
+        else
+        {
+          eval_divide_knuth_core(u_offset, v_offset, other, remainder);
+        }
+      }
+    }
+
+    constexpr auto eval_divide_knuth_core(const unsigned_fast_type u_offset, // NOLINT(readability-function-cognitive-complexity)
+                                          const unsigned_fast_type v_offset,
+                                          const uintwide_t& other,
+                                                uintwide_t* remainder) -> void
+    {
+      using local_uint_index_type = unsigned_fast_type;
+
+      // We will now use the Knuth long division algorithm.
+
+      // Compute the normalization factor d.
+      const auto d =
+        static_cast<limb_type>
+        (
+            static_cast<double_limb_type>(static_cast<double_limb_type>(UINT8_C(1)) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits))
+          / static_cast<double_limb_type>(static_cast<double_limb_type>(*detail::advance_and_point(other.values.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs - 1U) - v_offset))) + static_cast<limb_type>(1U))
+        );
+
+      // Step D1(b), normalize u -> u * d = uu.
+      // Step D1(c): normalize v -> v * d = vv.
+
+      scratch_array_type<limb_type, number_of_limbs + size_t { UINT8_C(1) }> uu { };
+      scratch_array_type<limb_type, number_of_limbs>                         vv { };
+
+      if(d > static_cast<limb_type>(UINT8_C(1)))
+      {
+        {
+          const auto num_limbs_minus_u_ofs =
+            static_cast<size_t>
+            (
+              static_cast<local_uint_index_type>(number_of_limbs) - u_offset
+            );
+
+          const auto u_carry =
+            eval_multiply_1d
+            (
+              uu.begin(),
+              values.cbegin(),
+              d,
+              static_cast<unsigned_fast_type>(num_limbs_minus_u_ofs)
+            );
+
+          *(uu.begin() + num_limbs_minus_u_ofs) = u_carry;
+        }
+
+        static_cast<void>
+        (
+          eval_multiply_1d
+          (
+            vv.begin(),
+            other.values.cbegin(),
+            d,
+            static_cast<unsigned_fast_type>(number_of_limbs - v_offset)
+          )
+        );
+      }
+      else
+      {
+        detail::copy_unsafe(values.cbegin(), values.cend(), uu.begin());
+
+        *(uu.begin() + static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs) - u_offset)) = static_cast<limb_type>(UINT8_C(0));
+
+        detail::copy_unsafe(other.values.cbegin(), other.values.cend(), vv.begin());
+      }
+
+      // Step D2: Initialize j.
+      // Step D7: Loop on j from m to 0.
+
+      const auto n   = static_cast<local_uint_index_type>                                   (number_of_limbs - v_offset);
+      const auto m   = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(number_of_limbs - u_offset) - n);
+      const auto vj0 = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(n - static_cast<local_uint_index_type>(UINT8_C(1))));
+
+      auto vv_at_vj0_it = detail::advance_and_point(vv.cbegin(), static_cast<size_t>(vj0)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      const auto vv_at_vj0           = *vv_at_vj0_it--;
+      const auto vv_at_vj0_minus_one = *vv_at_vj0_it;
+
+      auto values_at_m_minus_j_it = detail::advance_and_point(values.begin(), static_cast<size_t>(m)); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      for(auto j = static_cast<local_uint_index_type>(UINT8_C(0)); j <= m; ++j) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        // Step D3 [Calculate q_hat].
+        //   if u[j] == v[j0]
+        //     set q_hat = b - 1
+        //   else
+        //     set q_hat = (u[j] * b + u[j + 1]) / v[1]
+
+        const auto uj     = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(number_of_limbs + 1U) - 1U) - u_offset) - j);
+        const auto u_j_j1 = static_cast<double_limb_type>(static_cast<double_limb_type>(static_cast<double_limb_type>(*(uu.cbegin() + static_cast<size_t>(uj))) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)) + *(uu.cbegin() + static_cast<size_t>(uj - 1U)));
+
+        auto q_hat =
+          static_cast<limb_type>
+          (
+            (*(uu.cbegin() + static_cast<size_t>(uj)) == vv_at_vj0)
+              ? (std::numeric_limits<limb_type>::max)()
+              : static_cast<limb_type>(u_j_j1 / vv_at_vj0)
+          );
+
+        // Decrease q_hat if necessary.
+        // This means that q_hat must be decreased if the
+        // expression [(u[uj] * b + u[uj - 1] - q_hat * v[vj0 - 1]) * b]
+        // exceeds the range of uintwide_t.
+
+        {
+          const auto u_j_minus_2 =
+            *detail::advance_and_point(uu.cbegin(), static_cast<size_t>(uj - 2U));
+
+          auto t =
+            static_cast<double_limb_type>
+            (
+              u_j_j1 - static_cast<double_limb_type>(q_hat * static_cast<double_limb_type>(vv_at_vj0))
+            );
+
+          while(true)
+          {
+            const bool t_overflow =
+              (detail::make_hi<limb_type>(t) != static_cast<limb_type>(UINT8_C(0)));
+
+            const auto lhs =
+              static_cast<double_limb_type>
+              (
+                static_cast<double_limb_type>(vv_at_vj0_minus_one) * q_hat
+              );
+
+            const auto rhs =
+              static_cast<double_limb_type>
+              (
+                static_cast<double_limb_type>(t << static_cast<unsigned>(std::numeric_limits<limb_type>::digits))
+                + u_j_minus_2
+              );
+
+            if(t_overflow || (lhs <= rhs))
+            {
+              break;
+            }
+
+            t = static_cast<double_limb_type>(t + vv_at_vj0);
+            --q_hat;
+          }
+        }
+
+        {
+          // Step D4: Multiply and subtract.
+          // Replace u[j, ... j + n] by u[j, ... j + n] - q_hat * v[1, ... n].
+          // The product q_hat * v[1, ... n] is subtracted on the fly,
+          // without a temporary array.
+
+          const auto has_borrow =
+            (
+              eval_multiply_sub_1d
+              (
+                detail::advance_and_point(uu.begin(), static_cast<size_t>(static_cast<local_uint_index_type>(uj - n))),
+                static_cast<unsigned_fast_type>
+                (
+                  static_cast<local_uint_index_type>(n + static_cast<local_uint_index_type>(UINT8_C(1)))
+                ),
+                vv.cbegin(),
+                static_cast<unsigned_fast_type>(n),
+                q_hat
+              )
+              != static_cast<limb_type>(UINT8_C(0))
+            );
+
+          // Step D5: Test the remainder.
+          // Set the result value: Set result.m_data[m - j] = q_hat.
+          // Use the condition (u[j] < 0), in other words if the borrow
+          // is non-zero, then step D6 needs to be carried out.
+
+          if(has_borrow)
+          {
+            --q_hat;
+
+            // Step D6: Add back.
+            // Add v[1, ... n] back to u[j, ... j + n],
+            // and decrease the result by 1.
+
+            static_cast<void>
+            (
+              eval_add_n(uu.begin() + static_cast<size_t>(static_cast<local_uint_index_type>(uj - n)),
+                          detail::advance_and_point(uu.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(uj - n))),
+                          vv.cbegin(),
+                          static_cast<unsigned_fast_type>(n))
+            );
+          }
+        }
+
+        // Get the result data.
+        *values_at_m_minus_j_it = static_cast<limb_type>(q_hat);
+
+        if(j < m)
+        {
+          --values_at_m_minus_j_it;
+        }
+      }
+
+      // Clear the data elements that have not
+      // been computed in the division algorithm.
+      {
+        const auto m_plus_one =
+          static_cast<local_uint_index_type>
+          (
+            static_cast<local_uint_index_type>(m) + static_cast<local_uint_index_type>(UINT8_C(1))
+          );
+
+        detail::fill_unsafe(detail::advance_and_point(values.begin(), m_plus_one), values.end(), static_cast<limb_type>(UINT8_C(0)));
+      }
+
+      if(remainder != nullptr)
+      {
+        auto rl_it_fwd = // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+          detail::advance_and_point(remainder->values.begin(), static_cast<signed_fast_type>(n));
+
+        if(d == static_cast<limb_type>(UINT8_C(1)))
+        {
+          detail::copy_unsafe(uu.cbegin(),
+                              detail::advance_and_point(uu.cbegin(), static_cast<size_t>(static_cast<local_uint_index_type>(number_of_limbs - v_offset))),
+                              remainder->values.begin());
+        }
+        else
+        {
+          auto previous_u = static_cast<limb_type>(UINT8_C(0));
+
+          auto rl_it_rev = static_cast<reverse_iterator>(rl_it_fwd);
+
+          auto ul =
+            static_cast<signed_fast_type>
+            (
+              static_cast<size_t>
+              (
+                  number_of_limbs
+                - static_cast<size_t>(v_offset + static_cast<size_t>(UINT8_C(1)))
+              )
+            );
+
+          for( ; rl_it_rev != remainder->values.rend(); ++rl_it_rev, --ul) // NOLINT(altera-id-dependent-backward-branch)
+          {
+            const auto t =
+              static_cast<double_limb_type>
+              (
+                  *(uu.cbegin() + static_cast<size_t>(ul))
+                + static_cast<double_limb_type>
+                  (
+                    static_cast<double_limb_type>(previous_u) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)
+                  )
+              );
+
+            *rl_it_rev = static_cast<limb_type>(static_cast<double_limb_type>(t / d));
+            previous_u = static_cast<limb_type>(static_cast<double_limb_type>(t - static_cast<double_limb_type>(static_cast<double_limb_type>(d) * *rl_it_rev)));
+          }
+        }
+
+        detail::fill_unsafe(rl_it_fwd, remainder->values.end(), static_cast<limb_type>(UINT8_C(0)));
+      }
+    }
+
+    static constexpr auto burnikel_ziegler_base_limbs() -> unsigned_fast_type
+    {
+      // The recursion of the Burnikel-Ziegler division stops at blocks
+      // of at most one sixteenth of the threshold (and at least four) limbs.
+      // The recursion only pays off for large divisors, whereas its blocks
+      // are best divided with schoolbook division once they are small.
+      return
+        static_cast<unsigned_fast_type>
+        (
+          (detail::max_unsafe)(static_cast<unsigned_fast_type>(number_of_limbs_burnikel_ziegler_threshold / 16U),
+                               static_cast<unsigned_fast_type>(UINT8_C(4)))
+        );
+    }
+
+    static constexpr auto burnikel_ziegler_storage_limbs() -> unsigned_fast_type
+    {
+      // The temporary storage of the multiplication in the recursion.
+      // The block size n is less than twice the number of limbs,
+      // and the products have n / 2 limbs at most.
+      return
+        static_cast<unsigned_fast_type>
+        (
+            static_cast<unsigned_fast_type>(number_of_limbs * static_cast<size_t>(UINT8_C(2)))
+          + toom3_storage_limbs(static_cast<unsigned_fast_type>(number_of_limbs))
+        );
+    }
+
+    template<const size_t RePhraseWidth2 = Width2>
+    constexpr auto eval_divide_burnikel_ziegler(const unsigned_fast_type u_offset,
+                                                const unsigned_fast_type v_offset,
+                                                const uintwide_t& other,
+                                                      uintwide_t* remainder) -> std::enable_if_t<(uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs < number_of_limbs_burnikel_ziegler_threshold), void>
+    {
+      // This width is below the threshold of the Burnikel-Ziegler division.
+      eval_divide_knuth_core(u_offset, v_offset, other, remainder);
+    }
+
+    template<const size_t RePhraseWidth2 = Width2>
+    constexpr auto eval_divide_burnikel_ziegler(const unsigned_fast_type u_offset,
+                                                const unsigned_fast_type v_offset,
+                                                const uintwide_t& other,
+                                                      uintwide_t* remainder) -> std::enable_if_t<(uintwide_t<RePhraseWidth2, LimbType, AllocatorType, IsSigned>::number_of_limbs >= number_of_limbs_burnikel_ziegler_threshold), void>
+    {
+      // Based on C. Burnikel and J. Ziegler, "Fast Recursive Division",
+      // Max-Planck-Institut fuer Informatik, Research Report MPI-I-98-1-022 (1998).
+
+      // The divisor (having nv limbs) is shifted left into a block of n
+      // limbs such that its top bit is set. Here, n = j * 2^levels with
+      // j limbs being at the base of the recursion. The numerator is
+      // shifted by the same amount and cut into blocks of n limbs. The
+      // blocks are then divided from the top, two at a time, with the
+      // remainder of each step forming the upper block of the next step.
+
+      using local_uint_index_type = unsigned_fast_type;
+
+      const auto nu = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(number_of_limbs) - u_offset);
+      const auto nv = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(number_of_limbs) - v_offset);
+
+      auto j = nv;
+      auto n = static_cast<local_uint_index_type>(UINT8_C(1));
+
+      while(j > burnikel_ziegler_base_limbs()) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        j  = static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(j + 1U) / 2U);
+        n *= 2U;
+      }
+
+      n *= j;
+
+      const auto shift_limbs = static_cast<local_uint_index_type>(n - nv);
+
+      const auto shift_bits =
+        static_cast<unsigned>
+        (
+          std::numeric_limits<limb_type>::digits - 1 - static_cast<int>(detail::msb_helper(*detail::advance_and_point(other.values.cbegin(), static_cast<size_t>(nv - 1U))))
+        );
+
+      const auto t_count =
+        (detail::max_unsafe)
+        (
+          static_cast<local_uint_index_type>(UINT8_C(2)),
+          static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(nu + shift_limbs) + n) / n)
+        );
+
+      scratch_array_type<limb_type, static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(2)))> vv { };
+      scratch_array_type<limb_type, static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(4)))> uu { };
+      scratch_array_type<limb_type, static_cast<size_t>(number_of_limbs * static_cast<size_t>(UINT8_C(4)))> qq { };
+      scratch_array_type<limb_type, static_cast<size_t>(burnikel_ziegler_storage_limbs())>                t  { };
+
+      eval_divide_bz_shift_left(detail::advance_and_point(vv.begin(), static_cast<size_t>(shift_limbs)), other.values.cbegin(), nv, shift_bits);
+      eval_divide_bz_shift_left(detail::advance_and_point(uu.begin(), static_cast<size_t>(shift_limbs)),       values.cbegin(), nu, shift_bits);
+
+      for(auto i = static_cast<local_uint_index_type>(t_count - 2U); i != static_cast<local_uint_index_type>(-1); --i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        eval_divide_bz_2n_by_n(detail::advance_and_point(qq.begin(), static_cast<size_t>(i * n)),
+                               detail::advance_and_point(uu.begin(), static_cast<size_t>(i * n)),
+                               vv.cbegin(),
+                               n,
+                               t.begin());
+      }
+
+      // The quotient fits in the width, any further blocks being zero.
+      const auto q_count =
+        (detail::min_unsafe)
+        (
+          static_cast<local_uint_index_type>(static_cast<local_uint_index_type>(t_count - 1U) * n),
+          static_cast<local_uint_index_type>(number_of_limbs)
+        );
+
+      detail::copy_unsafe(qq.cbegin(), detail::advance_and_point(qq.cbegin(), static_cast<size_t>(q_count)), values.begin());
+
+      detail::fill_unsafe(detail::advance_and_point(values.begin(), static_cast<size_t>(q_count)), values.end(), static_cast<limb_type>(UINT8_C(0)));
+
+      if(remainder != nullptr)
+      {
+        // Shift the remainder back down.
+        eval_divide_bz_shift_right(remainder->values.begin(), detail::advance_and_point(uu.cbegin(), static_cast<size_t>(shift_limbs)), nv, shift_bits);
+
+        detail::fill_unsafe(detail::advance_and_point(remainder->values.begin(), static_cast<size_t>(nv)), remainder->values.end(), static_cast<limb_type>(UINT8_C(0)));
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIterator>
+    static constexpr auto eval_divide_bz_shift_left(      ResultIterator     r,
+                                                          InputIterator      u,
+                                                    const unsigned_fast_type count,
+                                                    const unsigned           shift_bits) -> void
+    {
+      // Write the count limbs of u, shifted left by shift_bits, to the
+      // count + 1 limbs of r (with shift_bits < limb_bits).
+      auto carry = static_cast<limb_type>(UINT8_C(0));
+
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < count; ++i)
+      {
+        const auto ui = *u++;
+
+        *r++ = static_cast<limb_type>(static_cast<limb_type>(ui << shift_bits) | carry);
+
+        carry = ((shift_bits == 0U) ? static_cast<limb_type>(UINT8_C(0)) : static_cast<limb_type>(ui >> static_cast<unsigned>(static_cast<unsigned>(std::numeric_limits<limb_type>::digits) - shift_bits)));
+      }
+
+      *r = carry;
+    }
+
+    template<typename ResultIterator,
+             typename InputIterator>
+    static constexpr auto eval_divide_bz_shift_right(      ResultIterator     r,
+                                                           InputIterator      u,
+                                                     const unsigned_fast_type count,
+                                                     const unsigned           shift_bits) -> void
+    {
+      // Write the count limbs of u, shifted right by shift_bits,
+      // to the count limbs of r (with shift_bits < limb_bits).
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < count; ++i)
+      {
+        const auto ui = *u++;
+
+        const auto hi = ((shift_bits == 0U) || (static_cast<unsigned_fast_type>(i + 1U) == count)) ? static_cast<limb_type>(UINT8_C(0)) : static_cast<limb_type>(*u << static_cast<unsigned>(static_cast<unsigned>(std::numeric_limits<limb_type>::digits) - shift_bits));
+
+        *r++ = static_cast<limb_type>(static_cast<limb_type>(ui >> shift_bits) | hi);
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight>
+    static constexpr auto eval_divide_bz_schoolbook(      ResultIterator     q,
+                                                          InputIteratorLeft  a,
+                                                          InputIteratorRight b,
+                                                    const unsigned_fast_type n) -> void
+    {
+      // Divide the 2n limbs of a by the n >= 2 limbs of b, where the top
+      // bit of b is set and a < b * base^n, with Knuth's Algorithm D.
+      // The n limbs of the quotient are written to q. The remainder
+      // replaces the lower n limbs of a, and the upper n limbs are cleared.
+
+      const auto b1 = *detail::advance_and_point(b, static_cast<size_t>(n - 1U));
+      const auto b2 = *detail::advance_and_point(b, static_cast<size_t>(n - 2U));
+
+      for(auto j = static_cast<unsigned_fast_type>(n - 1U); j != static_cast<unsigned_fast_type>(-1); --j) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        auto aj = detail::advance_and_point(a, static_cast<size_t>(j));
+
+        const auto a0 = *detail::advance_and_point(aj, static_cast<size_t>(n));
+        const auto a1 = *detail::advance_and_point(aj, static_cast<size_t>(n - 1U));
+        const auto a2 = *detail::advance_and_point(aj, static_cast<size_t>(n - 2U));
+
+        const auto a01 = static_cast<double_limb_type>(static_cast<double_limb_type>(static_cast<double_limb_type>(a0) << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)) + a1);
+
+        auto q_hat = ((a0 == b1) ? (std::numeric_limits<limb_type>::max)() : static_cast<limb_type>(a01 / b1));
+
+        auto r_hat = static_cast<double_limb_type>(a01 - static_cast<double_limb_type>(static_cast<double_limb_type>(q_hat) * b1));
+
+        while(   (detail::make_hi<limb_type>(r_hat) == static_cast<limb_type>(UINT8_C(0)))
+              && (static_cast<double_limb_type>(static_cast<double_limb_type>(b2) * q_hat) > static_cast<double_limb_type>(static_cast<double_limb_type>(r_hat << static_cast<unsigned>(std::numeric_limits<limb_type>::digits)) + a2))) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          --q_hat;
+
+          r_hat = static_cast<double_limb_type>(r_hat + b1);
+        }
+
+        if(eval_multiply_sub_1d(aj, static_cast<unsigned_fast_type>(n + 1U), b, n, q_hat) != static_cast<limb_type>(UINT8_C(0)))
+        {
+          --q_hat;
+
+          const auto carry = eval_add_n(aj, aj, b, n);
+
+          auto& a_top = *detail::advance_and_point(aj, static_cast<size_t>(n));
+
+          a_top = static_cast<limb_type>(a_top + carry);
+        }
+
+        *detail::advance_and_point(q, static_cast<size_t>(j)) = q_hat;
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorTemp>
+    static constexpr auto eval_divide_bz_2n_by_n(      ResultIterator     q, // NOLINT(misc-no-recursion)
+                                                       InputIteratorLeft  a,
+                                                       InputIteratorRight b,
+                                                 const unsigned_fast_type n,
+                                                       InputIteratorTemp  t) -> void
+    {
+      // Divide the 2n limbs of a by the n limbs of b, where the top bit
+      // of b is set and a < b * base^n (Algorithm 1, "RecursiveDivision").
+      // The n limbs of the quotient are written to q. The remainder
+      // replaces the lower n limbs of a, and the upper n limbs are cleared.
+
+      if(   (n <= burnikel_ziegler_base_limbs())
+         || ((n % static_cast<unsigned_fast_type>(UINT8_C(2))) != static_cast<unsigned_fast_type>(UINT8_C(0))))
+      {
+        eval_divide_bz_schoolbook(q, a, b, n);
+      }
+      else
+      {
+        const auto k = static_cast<unsigned_fast_type>(n / 2U);
+
+        // Divide the upper three and then the lower three halves of a.
+        eval_divide_bz_3n_by_2n(detail::advance_and_point(q, static_cast<size_t>(k)), detail::advance_and_point(a, static_cast<size_t>(k)), b, k, t);
+        eval_divide_bz_3n_by_2n(q,                                                    a,                                                    b, k, t);
+      }
+    }
+
+    template<typename ResultIterator,
+             typename InputIteratorLeft,
+             typename InputIteratorRight,
+             typename InputIteratorTemp>
+    static constexpr auto eval_divide_bz_3n_by_2n(      ResultIterator     q, // NOLINT(misc-no-recursion)
+                                                        InputIteratorLeft  a,
+                                                        InputIteratorRight b,
+                                                  const unsigned_fast_type k,
+                                                        InputIteratorTemp  t) -> void
+    {
+      // Divide the 3k limbs of a = [a1, a2, a3] by the 2k limbs of
+      // b = [b1, b2] (the leftmost pieces being the upper ones), where
+      // the top bit of b is set and a < b * base^k (Algorithm 2).
+      // The k limbs of the quotient are written to q. The remainder
+      // replaces the lower 2k limbs of a, and the upper k limbs are cleared.
+
+      const auto k2 = static_cast<unsigned_fast_type>(k * 2U);
+
+      auto a2 = detail::advance_and_point(a, static_cast<size_t>(k));
+      auto a1 = detail::advance_and_point(a, static_cast<size_t>(k2));
+
+      const auto b1 = detail::advance_and_point(b, static_cast<size_t>(k));
+
+      if(compare_ranges(a1, b1, k) < static_cast<std::int_fast8_t>(INT8_C(0)))
+      {
+        // Estimate the quotient with [a1, a2] / b1.
+        eval_divide_bz_2n_by_n(q, a2, b1, k, t);
+      }
+      else
+      {
+        // Here a1 equals b1. The quotient estimate is base^k - 1, and
+        // the remainder [a1, a2] - q * b1 becomes [a1 - b1, a2 + b1].
+        detail::fill_unsafe(q, detail::advance_and_point(q, static_cast<size_t>(k)), (std::numeric_limits<limb_type>::max)());
+
+        static_cast<void>(eval_subtract_n(a1, a1, b1, k));
+
+        const auto carry = eval_add_n(a2, a2, b1, k);
+
+        eval_multiply_kara_propagate_carry(a1, k, carry);
+      }
+
+      // Subtract q * b2 from [r1, a3], correcting the quotient estimate,
+      // which is at most two too large, as long as the result is negative.
+      eval_multiply_toom3_n_by_n_to_2n(t, q, b, k, detail::advance_and_point(t, static_cast<size_t>(k2)));
+
+      auto is_negative = eval_multiply_kara_propagate_borrow(a1, k, eval_subtract_n(a, a, t, k2));
+
+      while(is_negative) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        static_cast<void>(eval_multiply_kara_propagate_borrow(q, k, true));
+
+        const auto carry = eval_add_n(a, a, b, k2);
+
+        is_negative = (eval_multiply_kara_propagate_carry(a1, k, carry) == static_cast<limb_type>(UINT8_C(0)));
+      }
+    }
+
+    template<typename IntegralType>
+    static constexpr auto exceeds_width(IntegralType n) -> bool
+    {
+      return (static_cast<size_t>(n) >= uintwide_t::my_width2);
+    }
+
+    WIDE_INTEGER_NODISCARD constexpr auto right_shift_fill_value() const -> limb_type
+    {
+      return
+        static_cast<limb_type>
+        (
+          (!is_neg(*this)) ? static_cast<limb_type>(UINT8_C(0))
+                           : (std::numeric_limits<limb_type>::max)()
+        );
+    }
+
+    template<typename IntegralType>
+    constexpr auto shl(IntegralType n) -> void
+    {
+      const auto offset =
+        (detail::min_unsafe)(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) / static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits)),
+                             static_cast<unsigned_fast_type>(number_of_limbs));
+
+      const auto left_shift_amount = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) % static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits));
+
+      if(offset > static_cast<unsigned_fast_type>(UINT8_C(0)))
+      {
+        detail::copy_backward_unsafe(values.cbegin(),
+                                     detail::advance_and_point(values.cbegin(), static_cast<size_t>(number_of_limbs - offset)),
+                                     detail::advance_and_point(values.begin(), static_cast<size_t>(number_of_limbs)));
+
+        detail::fill_unsafe(values.begin(), detail::advance_and_point(values.begin(), static_cast<size_t>(offset)), static_cast<limb_type>(UINT8_C(0)));
+      }
+
+      using local_integral_type = unsigned_fast_type;
+
+      if(left_shift_amount != static_cast<local_integral_type>(UINT8_C(0)))
+      {
+        auto part_from_previous_value = static_cast<limb_type>(UINT8_C(0));
+
+        auto ai = detail::advance_and_point(values.begin(), offset); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+        while(ai != values.end()) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          const auto t = *ai;
+
+          *ai++ =
+            static_cast<limb_type>
+            (
+                static_cast<limb_type>(t << static_cast<local_integral_type>(left_shift_amount))
+              | part_from_previous_value
+            );
+
+          const auto right_shift_previous_value =
+            static_cast<local_integral_type>
+            (
+              static_cast<unsigned_fast_type>
+              (
+                  static_cast<std::int_fast32_t>(std::numeric_limits<limb_type>::digits)
+                - static_cast<std::int_fast32_t>(left_shift_amount)
+              )
+            );
+
+          part_from_previous_value = static_cast<limb_type>(t >> right_shift_previous_value);
+        }
+      }
+    }
+
+    template<typename IntegralType>
+    constexpr auto shr(IntegralType n) -> void
+    {
+      const auto offset =
+        (detail::min_unsafe)(static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(n) / static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits)),
+                             static_cast<unsigned_fast_type>(number_of_limbs));
+
+      const auto right_shift_amount = static_cast<std::uint_fast16_t>(static_cast<unsigned_fast_type>(n) % static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits));
+
+      if(static_cast<size_t>(offset) > static_cast<size_t>(UINT8_C(0)))
+      {
+        detail::copy_unsafe(detail::advance_and_point(values.cbegin(), static_cast<size_t>(offset)),
+                            detail::advance_and_point(values.cbegin(), static_cast<size_t>(number_of_limbs)),
+                            values.begin());
+
+        detail::fill_unsafe(detail::advance_and_point(values.begin(), static_cast<size_t>(static_cast<size_t>(number_of_limbs) - static_cast<size_t>(offset))),
+                            values.end(),
+                            right_shift_fill_value());
+      }
+
+      using local_integral_type = unsigned_fast_type;
+
+      if(right_shift_amount != static_cast<local_integral_type>(UINT8_C(0)))
+      {
+        auto part_from_previous_value =
+          static_cast<limb_type>
+          (
+            (!is_neg(*this))
+              ? static_cast<limb_type>(UINT8_C(0))
+              : static_cast<limb_type>((std::numeric_limits<limb_type>::max)() << static_cast<std::uint_fast16_t>(static_cast<std::uint_fast16_t>(std::numeric_limits<limb_type>::digits) - right_shift_amount))
+          );
+
+        auto r_ai =
+          static_cast<reverse_iterator>
+          (
+            detail::advance_and_point
+            (
+              values.begin(),
+              static_cast<signed_fast_type>
+              (
+                static_cast<unsigned_fast_type>(number_of_limbs) - offset
+              )
+            )
+          );
+
+        while(r_ai != values.rend()) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          const auto t = *r_ai;
+
+          *r_ai++ = static_cast<limb_type>(static_cast<limb_type>(t >> static_cast<local_integral_type>(right_shift_amount)) | part_from_previous_value);
+
+          const auto left_shift_previous_value =
+            static_cast<local_integral_type>
+            (
+              static_cast<unsigned_fast_type>
+              (
+                  static_cast<std::int_fast32_t>(std::numeric_limits<limb_type>::digits)
+                - static_cast<std::int_fast32_t>(right_shift_amount)
+              )
+            );
+
+          part_from_previous_value = static_cast<limb_type>(t << left_shift_previous_value);
+        }
+      }
+    }
+
+    // Read string function.
+    constexpr auto rd_string(const char* str_input, const unsigned_fast_type count, const int base_hint) -> bool // NOLINT(readability-function-cognitive-complexity,bugprone-easily-swappable-parameters)
+    {
+      detail::fill_unsafe(values.begin(), values.end(), static_cast<limb_type>(UINT8_C(0)));
+
+      const auto str_length =
+        static_cast<unsigned_fast_type>
+        (
+          (count == (std::numeric_limits<unsigned_fast_type>::max)()) ? detail::strlen_unsafe(str_input) : count
+        );
+
+      auto pos = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+      // Detect: Is there a plus sign?
+      // And if there is a plus sign, skip over the plus sign.
+      if((str_length > static_cast<unsigned_fast_type>(UINT8_C(0))) && (str_input[static_cast<std::size_t>(UINT8_C(0))] == '+')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        ++pos;
+      }
+
+      auto str_has_neg_sign = false;
+
+      // Detect: Is there a minus sign?
+      // And if there is a minus sign, skip over the minus sign.
+      if((str_length > static_cast<unsigned_fast_type>(UINT8_C(0))) && (str_input[static_cast<std::size_t>(UINT8_C(0))] == '-')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        str_has_neg_sign = true;
+
+        ++pos;
+      }
+
+      // Set the base if the client has supplied a non-zero base-hint.
+      auto base = static_cast<std::uint_fast8_t>(base_hint);
+
+      if(base == static_cast<std::uint_fast8_t>(UINT8_C(0)))
+      {
+        base = static_cast<std::uint_fast8_t>(UINT8_C(10));
+
+        // Perform a dynamic detection of the base.
+        if(str_length > static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0))))
+        {
+          const auto might_be_oct_or_hex = ((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] == '0') && (str_length > static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0))))); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          if(might_be_oct_or_hex)
+          {
+            if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] >= '0') && (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] <= '8')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            {
+              // The input format is octal.
+              base = static_cast<std::uint_fast8_t>(UINT8_C(8));
+
+              pos = static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)));
+            }
+            else if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] == 'x') || (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(1)))] == 'X')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            {
+              // The input format is hexadecimal.
+              base = static_cast<std::uint_fast8_t>(UINT8_C(16));
+
+              pos = static_cast<unsigned_fast_type>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(2)));
+            }
+          }
+          else if((str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] >= '0') && (str_input[static_cast<std::size_t>(static_cast<std::size_t>(pos) + static_cast<std::size_t>(UINT8_C(0)))] <= '9')) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          {
+            // The input format is decimal.
+            ;
+          }
+        }
+      }
+
+      auto char_is_valid = true;
+
+      if(base == static_cast<std::uint_fast8_t>(UINT8_C(10)))
+      {
+        // Find the end of the valid decimal digits (and apostrophes),
+        // then read these in blocks of digits rather than one by one.
+
+        auto pos_end = pos;
+
+        while(pos_end < str_length) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          const auto c = str_input[pos_end]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+          if(((c < '0') || (c > '9')) && (c != static_cast<char>(39)))
+          {
+            break;
+          }
+
+          ++pos_end;
+        }
+
+        char_is_valid = (pos_end == str_length);
+
+        uintwide_t<my_width2, limb_type, AllocatorType, false> tu { };
+
+        read_dec_digits<false>(tu, str_input + pos, str_input + pos_end); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        values = tu.values;
+
+        pos = str_length;
+      }
+
+      while((pos < str_length) && char_is_valid) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto c = str_input[pos++]; // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        const auto char_is_apostrophe = (c == static_cast<char>(39));
+
+        if(!char_is_apostrophe)
+        {
+          if(base == static_cast<std::uint_fast8_t>(UINT8_C(8)))
+          {
+            char_is_valid = ((c >= '0') && (c <= '7'));
+
+            if(char_is_valid)
+            {
+              const auto uc_oct = static_cast<std::uint8_t>(c - '0');
+
+              static_cast<void>(operator<<=(static_cast<unsigned>(UINT8_C(3))));
+
+              *values.begin() = static_cast<limb_type>(*values.begin() | uc_oct);
+            }
+          }
+          else if(base == static_cast<std::uint_fast8_t>(UINT8_C(16)))
+          {
+            const auto char_is_a_to_f_lo((c >= 'a') && (c <= 'f'));
+            const auto char_is_a_to_f_hi((c >= 'A') && (c <= 'F'));
+            const auto char_is_0_to_9   ((c >= '0') && (c <= '9'));
+
+            char_is_valid = (char_is_a_to_f_lo || char_is_a_to_f_hi || char_is_0_to_9);
+
+            if(char_is_valid)
+            {
+              auto uc_hex = static_cast<std::uint8_t>(UINT8_C(0));
+
+              if     (char_is_a_to_f_lo) { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(  87))); }
+              else if(char_is_a_to_f_hi) { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(  55))); }
+              else if(char_is_0_to_9)    { uc_hex = static_cast<std::uint8_t>(c - static_cast<char>(UINT8_C(0x30))); }
+
+              static_cast<void>(operator<<=(static_cast<unsigned>(UINT8_C(4))));
+
+              *values.begin() = static_cast<limb_type>(*values.begin() | uc_hex);
+            }
+          }
+        }
+      }
+
+      if(str_has_neg_sign)
+      {
+        // Exclude this line from code coverage, even though explicit
+        // test cases (search for "result_overshift_is_ok") are known
+        // to cover this line.
+        negate(); // LCOV_EXCL_LINE
+      }
+
+      return char_is_valid;
+    }
+
+    constexpr auto bitwise_not() -> void // LCOV_EXCL_LINE
+    {
+      for(auto it = values.begin(); it != values.end(); ++it) // NOLINT(llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
+      {
+        *it = static_cast<limb_type>(~(*it));
+      }
+    } // LCOV_EXCL_LINE
+
+    constexpr auto preincrement() -> void
+    {
+      // Implement self-increment.
+
+      auto it = values.begin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto) // LCOV_EXCL_LINE
+
+      do
+      {
+        ++(*it);
+      }
+      while((*it++ == static_cast<limb_type>(UINT8_C(0))) && (it != values.end())); // NOLINT(altera-id-dependent-backward-branch,bugprone-inc-dec-in-conditions)
+    }
 
     constexpr auto predecrement() -> void
     {
-      // Implement self-decrement.
+      // Implement self-decrement.
+
+      auto it = values.begin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+
+      do
+      {
+        --(*it);
+      }
+      while((*it++ == (std::numeric_limits<limb_type>::max)()) && (it != values.end())); // NOLINT(altera-id-dependent-backward-branch,bugprone-inc-dec-in-conditions)
+    }
+  };
+
+  // Define some convenient unsigned wide integer types.
+  using uint64_t    = uintwide_t<static_cast<size_t>(UINT32_C(   64)), std::uint32_t>;
+  using  int64_t    = uintwide_t<static_cast<size_t>(UINT32_C(   64)), std::uint32_t, void, true>;
+
+  using uint128_t   = uintwide_t<static_cast<size_t>(UINT32_C(  128)), uint_defaultlimb_t>;
+  using uint256_t   = uintwide_t<static_cast<size_t>(UINT32_C(  256)), uint_defaultlimb_t>;
+  using uint512_t   = uintwide_t<static_cast<size_t>(UINT32_C(  512)), uint_defaultlimb_t>;
+  using uint1024_t  = uintwide_t<static_cast<size_t>(UINT32_C( 1024)), uint_defaultlimb_t>;
+  using uint2048_t  = uintwide_t<static_cast<size_t>(UINT32_C( 2048)), uint_defaultlimb_t>;
+  using uint4096_t  = uintwide_t<static_cast<size_t>(UINT32_C( 4096)), uint_defaultlimb_t>;
+  using uint8192_t  = uintwide_t<static_cast<size_t>(UINT32_C( 8192)), uint_defaultlimb_t>;
+  using uint16384_t = uintwide_t<static_cast<size_t>(UINT32_C(16384)), uint_defaultlimb_t>;
+  using uint32768_t = uintwide_t<static_cast<size_t>(UINT32_C(32768)), uint_defaultlimb_t>;
+  using uint65536_t = uintwide_t<static_cast<size_t>(UINT32_C(65536)), uint_defaultlimb_t>;
+
+  using  int128_t   = uintwide_t<static_cast<size_t>(UINT32_C(  128)), uint_defaultlimb_t, void, true>;
+  using  int256_t   = uintwide_t<static_cast<size_t>(UINT32_C(  256)), uint_defaultlimb_t, void, true>;
+  using  int512_t   = uintwide_t<static_cast<size_t>(UINT32_C(  512)), uint_defaultlimb_t, void, true>;
+  using  int1024_t  = uintwide_t<static_cast<size_t>(UINT32_C( 1024)), uint_defaultlimb_t, void, true>;
+  using  int2048_t  = uintwide_t<static_cast<size_t>(UINT32_C( 2048)), uint_defaultlimb_t, void, true>;
+  using  int4096_t  = uintwide_t<static_cast<size_t>(UINT32_C( 4096)), uint_defaultlimb_t, void, true>;
+  using  int8192_t  = uintwide_t<static_cast<size_t>(UINT32_C( 8192)), uint_defaultlimb_t, void, true>;
+  using  int16384_t = uintwide_t<static_cast<size_t>(UINT32_C(16384)), uint_defaultlimb_t, void, true>;
+  using  int32768_t = uintwide_t<static_cast<size_t>(UINT32_C(32768)), uint_defaultlimb_t, void, true>;
+  using  int65536_t = uintwide_t<static_cast<size_t>(UINT32_C(65536)), uint_defaultlimb_t, void, true>;
+
+  #if !defined(WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS)
+  static_assert(std::is_trivially_copyable<uint64_t   >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint128_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint256_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint512_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint1024_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint2048_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint4096_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint8192_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint16384_t>::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint32768_t>::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<uint65536_t>::value, "uintwide_t must be trivially copyable.");
+
+  static_assert(std::is_standard_layout<uint64_t   >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint128_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint256_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint512_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint1024_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint2048_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint4096_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint8192_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint16384_t>::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint32768_t>::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<uint65536_t>::value, "uintwide_t must have standard layout.");
+  #endif
+
+  #if !defined(WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS)
+  static_assert(std::is_trivially_copyable<int64_t   >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int128_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int256_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int512_t  >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int1024_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int2048_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int4096_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int8192_t >::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int16384_t>::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int32768_t>::value, "uintwide_t must be trivially copyable.");
+  static_assert(std::is_trivially_copyable<int65536_t>::value, "uintwide_t must be trivially copyable.");
+
+  static_assert(std::is_standard_layout<int64_t   >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int128_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int256_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int512_t  >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int1024_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int2048_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int4096_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int8192_t >::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int16384_t>::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int32768_t>::value, "uintwide_t must have standard layout.");
+  static_assert(std::is_standard_layout<int65536_t>::value, "uintwide_t must have standard layout.");
+  #endif
+
+  // Insert a base class for numeric_limits<> support.
+  // This class inherits from std::numeric_limits<unsigned int>
+  // in order to provide limits for a non-specific unsigned type.
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits_uintwide_t_base
+    : public std::numeric_limits<std::conditional_t<(!IsSigned), unsigned int, signed int>>
+  {
+  private:
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+  public:
+    static constexpr int digits          = (!IsSigned)
+                                             ? static_cast<int>(local_wide_integer_type::my_width2)
+                                             : static_cast<int>(local_wide_integer_type::my_width2 - static_cast<size_t>(UINT8_C(1)));
+
+    static constexpr int digits10        = static_cast<int>((static_cast<std::uintmax_t>(digits)       * UINTMAX_C(75257499)) / UINTMAX_C(250000000));
+    static constexpr int max_digits10    = digits10;
+    static constexpr int max_exponent    = digits;
+    static constexpr int max_exponent10  = static_cast<int>((static_cast<std::uintmax_t>(max_exponent) * UINTMAX_C(75257499)) / UINTMAX_C(250000000));
+
+    static constexpr auto (max) () -> local_wide_integer_type { return local_wide_integer_type::template limits_helper_max<IsSigned>(); }
+    static constexpr auto (min) () -> local_wide_integer_type { return local_wide_integer_type::template limits_helper_min<IsSigned>(); }
+    static constexpr auto lowest() -> local_wide_integer_type { return (min)(); }
+  };
+
+  template<class T>
+  struct is_integral : public std::is_integral<T> { };
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  struct is_integral<math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+    : public std::integral_constant<bool, true> { };
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_integer
+  #else
+  } // namespace wide_integer
+  } // namespace math
+  #endif
+
+  WIDE_INTEGER_NAMESPACE_END
+
+  namespace std
+  {
+    // Specialization of std::numeric_limits<uintwide_t>.
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    template<const WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t Width2,
+             typename LimbType,
+             typename AllocatorType,
+             const bool IsSigned>
+    WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits<WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+      : public WIDE_INTEGER_NAMESPACE::math::wide_integer::numeric_limits_uintwide_t_base<Width2, LimbType, AllocatorType, IsSigned> { };
+    #else
+    template<const ::math::wide_integer::size_t Width2,
+             typename LimbType,
+             typename AllocatorType,
+             const bool IsSigned>
+    WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits<::math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> // NOLINT(cert-dcl58-cpp)
+      : public ::math::wide_integer::numeric_limits_uintwide_t_base<Width2, LimbType, AllocatorType, IsSigned> { };
+    #endif
+  } // namespace std
+
+  WIDE_INTEGER_NAMESPACE_BEGIN
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_integer {
+  #else
+  namespace math { namespace wide_integer { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  #if !defined(WIDE_INTEGER_DISABLE_IOSTREAM)
+
+  // I/O streaming functions.
+  template<typename char_type,
+           typename traits_type,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  auto operator<<(std::basic_ostream<char_type, traits_type>& out,
+                  const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::basic_ostream<char_type, traits_type>&
+  {
+    std::basic_ostringstream<char_type, traits_type> ostr;
+
+    const std::ios::fmtflags my_flags = out.flags();
+
+    const auto show_pos     = ((my_flags & std::ios::showpos)   == std::ios::showpos);
+    const auto show_base    = ((my_flags & std::ios::showbase)  == std::ios::showbase);
+    const auto is_uppercase = ((my_flags & std::ios::uppercase) == std::ios::uppercase);
+
+    std::uint_fast8_t base_rep { };
+
+    if     ((my_flags & std::ios::oct) == std::ios::oct) { base_rep = static_cast<std::uint_fast8_t>(UINT8_C( 8)); }
+    else if((my_flags & std::ios::hex) == std::ios::hex) { base_rep = static_cast<std::uint_fast8_t>(UINT8_C(16)); }
+    else                                                 { base_rep = static_cast<std::uint_fast8_t>(UINT8_C(10)); }
+
+    const auto field_width   = static_cast<unsigned_fast_type>(out.width());
+    const auto fill_char_out = static_cast<char>(out.fill());
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(8)))
+    {
+      using string_storage_oct_type =
+        std::conditional_t
+          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
+            detail::fixed_static_array <char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_oct()>,
+            detail::fixed_dynamic_array<char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_oct(),
+                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                         std::allocator<void>,
+                                                                                         AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
+
+      // TBD: There is redundant storage of this kind both here
+      // in this subroutine as well as in the wr_string method.
+      string_storage_oct_type str_result { }; // LCOV_EXCL_LINE
+
+      str_result.fill('\0');
+
+      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+
+      static_cast<void>(ostr << str_result.data());
+    }
+    else if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(10)))
+    {
+      using string_storage_dec_type =
+        std::conditional_t
+          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
+            detail::fixed_static_array <char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_dec()>,
+            detail::fixed_dynamic_array<char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_dec(),
+                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                          std::allocator<void>,
+                                                                                          AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
+
+      // TBD: There is redundant storage of this kind both here
+      // in this subroutine as well as in the wr_string method.
+      string_storage_dec_type str_result { };
+
+      str_result.fill('\0');
+
+      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+
+      static_cast<void>(ostr << str_result.data());
+    }
+    else if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(16)))
+    {
+      using string_storage_hex_type =
+        std::conditional_t
+          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
+            detail::fixed_static_array <char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_hex()>,
+            detail::fixed_dynamic_array<char,
+                                        local_wide_integer_type::wr_string_max_buffer_size_hex(),
+                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
+                                                                                         std::allocator<void>,
+                                                                                         AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
+
+      // TBD: There is redundant storage of this kind both here
+      // in this subroutine as well as in the wr_string method.
+      string_storage_hex_type str_result { };
+
+      str_result.fill('\0');
+
+      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+
+      static_cast<void>(ostr << str_result.data());
+    }
+
+    return (out << ostr.str());
+  }
+
+  template<typename char_type,
+           typename traits_type,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  auto operator>>(std::basic_istream<char_type, traits_type>& in,
+                  uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::basic_istream<char_type, traits_type>&
+  {
+    std::string str_in { };
+
+    in >> str_in;
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    x = local_wide_integer_type(str_in.c_str());
+
+    return in;
+  }
+
+  #endif // !defined(WIDE_INTEGER_DISABLE_IOSTREAM)
+
+  #if(__cplusplus >= 201703L)
+  } // namespace math::wide_integer
+  #else
+  } // namespace wide_integer
+  } // namespace math
+  #endif
+
+  // Implement various number-theoretical tools.
+
+  #if(__cplusplus >= 201703L)
+  namespace math::wide_integer {
+  #else
+  namespace math { namespace wide_integer { // NOLINT(modernize-concat-nested-namespaces)
+  #endif
+
+  namespace detail {
+
+  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+  namespace my_own {
+
+  template<typename FloatingPointType> constexpr auto frexp(FloatingPointType x, int* expptr) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value &&   std::numeric_limits<FloatingPointType>::is_iec559 ), FloatingPointType>
+  {
+    using local_floating_point_type = FloatingPointType;
+
+    const bool x_is_neg { (x < static_cast<local_floating_point_type>(0.0L)) };
+
+    local_floating_point_type f = (x_is_neg ? -x : x); // NOLINT(altera-id-dependent-backward-branch)
+
+    int e2 { static_cast<int>(INT8_C(0)) };
+
+    constexpr auto two_pow32 =
+      static_cast<long double>
+      (
+        static_cast<long double>(0x10000) * static_cast<long double>(0x10000)
+      );
+
+    while(f >= static_cast<local_floating_point_type>(two_pow32)) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      // TBD: Maybe optimize this exponent reduction
+      // with a more clever kind of binary searching.
+
+      f   = static_cast<local_floating_point_type>(f / static_cast<local_floating_point_type>(two_pow32));
+      e2 += static_cast<int>(INT32_C(32));
+    }
+
+    constexpr auto one_ldbl = static_cast<long double>(1.0L);
+
+    while(f >= static_cast<local_floating_point_type>(one_ldbl)) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      constexpr auto two_ldbl = static_cast<long double>(2.0L);
+
+      f = static_cast<local_floating_point_type>(f / static_cast<local_floating_point_type>(two_ldbl));
+
+      ++e2;
+    }
+
+    if(expptr != nullptr)
+    {
+      *expptr = e2;
+    }
+
+    return ((!x_is_neg) ? f : -f);
+  }
+
+  template<typename FloatingPointType> constexpr auto frexp(FloatingPointType x, int* expptr) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value && (!std::numeric_limits<FloatingPointType>::is_iec559)), FloatingPointType>
+  {
+    using std::frexp;
+
+    return frexp(x, expptr);
+  }
+
+  template<typename FloatingPointType> constexpr auto (isfinite)(FloatingPointType x) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value &&   std::numeric_limits<FloatingPointType>::is_iec559 ), bool>
+  {
+    using local_floating_point_type = FloatingPointType;
+
+    bool x_is_finite { true };
+
+    const auto x_is_nan = (x != x);
+
+    if(x_is_nan)
+    {
+      x_is_finite = false;
+    }
+    else
+    {
+      const auto x_is_inf_pos = (x > (std::numeric_limits<local_floating_point_type>::max)());
+      const auto x_is_inf_neg = (x <  std::numeric_limits<local_floating_point_type>::lowest());
+
+      if(x_is_inf_pos || x_is_inf_neg)
+      {
+        x_is_finite = false;
+      }
+    }
+
+    return x_is_finite;
+  }
+
+  template<typename FloatingPointType> constexpr auto (isfinite)(FloatingPointType x) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value && (!std::numeric_limits<FloatingPointType>::is_iec559)), bool>
+  {
+    using std::isfinite;
+
+    return (isfinite)(x);
+  }
+  } // namespace my_own
+  #endif // !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+
+  template<typename UnsignedIntegralType>
+  constexpr auto lsb_helper(const UnsignedIntegralType& u) -> unsigned_fast_type
+  {
+    // Compile-time checks.
+    static_assert((   std::is_integral<UnsignedIntegralType>::value
+                   && std::is_unsigned<UnsignedIntegralType>::value),
+                   "Error: Please check the characteristics of UnsignedIntegralType");
+
+    auto result = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+    using local_unsigned_integral_type = UnsignedIntegralType;
+
+    auto mask = static_cast<local_unsigned_integral_type>(u); // NOLINT(altera-id-dependent-backward-branch)
+
+    // This assumes that at least one bit is set.
+    // Otherwise saturation of the index will occur.
+
+    // Naive and basic LSB search.
+    // TBD: This could be improved with a binary search
+    // on the lowest bit position of the fundamental type.
+    while(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast8_t>(mask) & static_cast<std::uint_fast8_t>(UINT8_C(1))) == static_cast<std::uint_fast8_t>(UINT8_C(0))) // NOLINT(hicpp-signed-bitwise,altera-id-dependent-backward-branch)
+    {
+      mask = static_cast<local_unsigned_integral_type>(mask >> static_cast<unsigned>(UINT8_C(1)));
+
+      ++result;
+    }
+
+    return result;
+  }
+
+  template<typename UnsignedIntegralType>
+  constexpr auto msb_helper(const UnsignedIntegralType& u) -> unsigned_fast_type
+  {
+    // Compile-time checks.
+    static_assert((   std::is_integral<UnsignedIntegralType>::value
+                   && std::is_unsigned<UnsignedIntegralType>::value),
+                   "Error: Please check the characteristics of UnsignedIntegralType");
+
+    using local_unsigned_integral_type = UnsignedIntegralType;
+
+    auto i = signed_fast_type { };
+
+    // TBD: This could potentially be improved with a binary
+    // search for the highest bit position in the type.
+
+    for(i = static_cast<signed_fast_type>(std::numeric_limits<local_unsigned_integral_type>::digits - 1); i >= static_cast<signed_fast_type>(INT8_C(0)); --i)
+    {
+      const auto bit_is_set =
+      (
+        static_cast<local_unsigned_integral_type>
+        (
+          u & static_cast<local_unsigned_integral_type>(static_cast<local_unsigned_integral_type>(1U) << static_cast<unsigned_fast_type>(i))
+        )
+        != static_cast<local_unsigned_integral_type>(UINT8_C(0))
+      );
+
+      if(bit_is_set)
+      {
+        break;
+      }
+    }
+
+    return static_cast<unsigned_fast_type>((detail::max_unsafe)(static_cast<signed_fast_type>(INT8_C(0)), i));
+  }
+
+  template<>
+  constexpr auto msb_helper<std::uint64_t>(const std::uint64_t& u) -> unsigned_fast_type
+  {
+    constexpr unsigned thirty_two { unsigned { UINT8_C(32) } };
+
+    const std::uint32_t hi_dword { static_cast<std::uint32_t>(u >> thirty_two) };
+
+    const bool hi_dword_is_nonzero { (hi_dword != std::uint32_t { UINT8_C(0) }) };
+
+    return (hi_dword_is_nonzero ? static_cast<unsigned_fast_type>(msb_helper(hi_dword) + thirty_two) : msb_helper(static_cast<std::uint32_t>(u)));
+  }
+
+  template<>
+  constexpr auto msb_helper<std::uint32_t>(const std::uint32_t& u) -> unsigned_fast_type
+  {
+    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
+    auto x = static_cast<std::uint_fast32_t>(u);
+
+    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
+    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0xFFFF0000))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C(16))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C(16))); }
+    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x0000FF00))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 8))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 8))); }
+    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x000000F0))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 4))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 4))); }
+    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x0000000C))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 2))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 2))); }
+    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x00000002))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) {                                                                               r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 1))); }
+
+    return r;
+  }
+
+  template<>
+  constexpr auto msb_helper<std::uint16_t>(const std::uint16_t& u) -> unsigned_fast_type
+  {
+    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
+    auto x = static_cast<std::uint_fast16_t>(u);
+
+    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
+    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0xFF00)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(8))); r = static_cast<unsigned_fast_type>(r | UINT32_C(8)); }
+    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x00F0)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(4))); r = static_cast<unsigned_fast_type>(r | UINT32_C(4)); }
+    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x000C)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(2))); r = static_cast<unsigned_fast_type>(r | UINT32_C(2)); }
+    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x0002)) != UINT16_C(0)) {                                                                              r = static_cast<unsigned_fast_type>(r | UINT32_C(1)); }
+
+    return r;
+  }
+
+  template<>
+  constexpr auto msb_helper<std::uint8_t>(const std::uint8_t& u) -> unsigned_fast_type
+  {
+    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
+    auto x = static_cast<std::uint_fast8_t>(u);
+
+    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
+    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0xF0)) != UINT8_C(0)) { x = static_cast<std::uint_fast8_t>(x >> static_cast<unsigned>(UINT8_C(4))); r = static_cast<unsigned_fast_type>(r | UINT32_C(4)); }
+    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x0C)) != UINT8_C(0)) { x = static_cast<std::uint_fast8_t>(x >> static_cast<unsigned>(UINT8_C(2))); r = static_cast<unsigned_fast_type>(r | UINT32_C(2)); }
+    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x02)) != UINT8_C(0)) {                                                                             r = static_cast<unsigned_fast_type>(r | UINT32_C(1)); }
+
+    return r;
+  }
+
+  } // namespace detail
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto swap(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x,
+                      uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& y) noexcept -> void
+  {
+    if(&x != &y)
+    {
+      detail::swap_unsafe(x, y);
+    }
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto lsb(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> unsigned_fast_type
+  {
+    // Calculate the position of the least-significant bit.
+    // Use a linear search starting from the least significant limb.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_value_type        = typename local_wide_integer_type::representation_type::value_type;
+
+    auto bpos   = static_cast<unsigned_fast_type>(UINT8_C(0));
+    auto offset = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+    for(auto it = x.crepresentation().cbegin(); it != x.crepresentation().cend(); ++it, ++offset) // NOLINT(llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
+    {
+      const auto vi = static_cast<local_value_type>(*it & (std::numeric_limits<local_value_type>::max)());
+
+      if(vi != static_cast<local_value_type>(UINT8_C(0)))
+      {
+        bpos =
+          static_cast<unsigned_fast_type>
+          (
+              detail::lsb_helper(*it)
+            + static_cast<unsigned_fast_type>
+              (
+                static_cast<unsigned_fast_type>(std::numeric_limits<local_value_type>::digits) * offset
+              )
+          );
+
+        break;
+      }
+    }
+
+    return bpos;
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto msb(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> unsigned_fast_type
+  {
+    // Calculate the position of the most-significant bit.
+    // Use a linear search starting from the most significant limb.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_value_type        = typename local_wide_integer_type::representation_type::value_type;
+
+    unsigned_fast_type bpos   { static_cast<unsigned_fast_type>(UINT8_C(0)) };
+    std::uint32_t      offset { static_cast<std::uint32_t>(x.crepresentation().size() - 1U) };
+
+    for(auto ri { x.crepresentation().crbegin() }; ri != x.crepresentation().crend(); ++ri, --offset) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      const auto vr = static_cast<local_value_type>(*ri & (std::numeric_limits<local_value_type>::max)());
+
+      if(vr != static_cast<local_value_type>(UINT8_C(0)))
+      {
+        bpos =
+          static_cast<unsigned_fast_type>
+          (
+              detail::msb_helper(*ri)
+            + static_cast<unsigned_fast_type>
+              (
+                static_cast<unsigned_fast_type>(std::numeric_limits<local_value_type>::digits) * static_cast<unsigned_fast_type>(offset)
+              )
+          );
+
+        break;
+      }
+    }
+
+    return bpos;
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto abs(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    return ((!local_wide_integer_type::is_neg(x)) ? x : -x);
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto square(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate the square x * x (modulo 2^Width2). The multiplication
+    // of an operand with itself is detected and uses a squaring kernel,
+    // which forms each of the cross products only once.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    local_wide_integer_type result { x };
+
+    result *= result;
+
+    return result;
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto sqrt(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate the square root.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    local_wide_integer_type s { };
+
+    if(m.is_zero() || local_wide_integer_type::is_neg(m))
+    {
+      s = local_wide_integer_type(static_cast<std::uint_fast8_t>(UINT8_C(0)));
+    }
+    else
+    {
+      // Obtain the initial guess via algorithms
+      // involving the position of the msb.
+      const auto msb_pos = msb(m);
+
+      const auto msb_pos_mod_2 = static_cast<unsigned_fast_type>(msb_pos % static_cast<unsigned_fast_type>(UINT8_C(2)));
+
+      // Obtain the initial value.
+      const auto left_shift_amount =
+        static_cast<unsigned_fast_type>
+        (
+          ((msb_pos_mod_2 == static_cast<unsigned_fast_type>(UINT8_C(0)))
+            ? static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>((msb_pos + static_cast<unsigned_fast_type>(UINT8_C(0))) / 2U)
+            : static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>((msb_pos + static_cast<unsigned_fast_type>(UINT8_C(1))) / 2U))
+        );
+
+      auto u = static_cast<local_wide_integer_type>(static_cast<unsigned>(UINT8_C(1))) << left_shift_amount;
+
+      // Perform the iteration for the square root.
+      // See Algorithm 1.13 SqrtInt, Sect. 1.5.1
+      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
+      // Cambridge University Press, 2011.
+
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < static_cast<unsigned_fast_type>(UINT8_C(64)); ++i)
+      {
+        s = u;
+
+        u = (s + (m / s)) >> static_cast<unsigned>(UINT8_C(1));
+
+        if(u >= s) { break; } // LCOV_EXCL_LINE
+      }
+    }
+
+    return s;
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto cbrt(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> // NOLINT(misc-no-recursion)
+  {
+    // Calculate the cube root.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    local_wide_integer_type s;
+
+    if(local_wide_integer_type::is_neg(m))
+    {
+      s = -cbrt(-m);
+    }
+    else if(m.is_zero())
+    {
+      s = local_wide_integer_type(static_cast<std::uint_fast8_t>(UINT8_C(0)));
+    }
+    else
+    {
+      // Obtain the initial guess via algorithms
+      // involving the position of the msb.
+      const auto msb_pos = msb(m);
+
+      // Obtain the initial value.
+      const auto msb_pos_mod_3 = static_cast<unsigned_fast_type>(msb_pos % static_cast<unsigned_fast_type>(UINT8_C(3)));
+
+      const auto left_shift_amount =
+        static_cast<unsigned_fast_type>
+        (
+          (msb_pos_mod_3 == unsigned_fast_type { UINT8_C(0) })
+            ? unsigned_fast_type { UINT8_C(1) } + static_cast<unsigned_fast_type>(msb_pos / unsigned_fast_type { UINT8_C(3) })
+            : unsigned_fast_type { UINT8_C(1) } + static_cast<unsigned_fast_type>((msb_pos + (unsigned_fast_type { UINT8_C(3) } - msb_pos_mod_3)) / unsigned_fast_type { UINT8_C(3) })
+        );
+
+      auto u = static_cast<local_wide_integer_type>(static_cast<unsigned>(UINT8_C(1))) << left_shift_amount;
+
+      // Perform the iteration for the k'th root (applied for k = 3).
+      // See Algorithm 1.14 RootInt, Sect. 1.5.2
+      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
+      // Cambridge University Press, 2011.
+
+      const auto three_minus_one =
+        static_cast<unsigned_fast_type>
+        (
+          static_cast<unsigned>(static_cast<unsigned>(UINT8_C(3)) - static_cast<unsigned>(UINT8_C(1)))
+        );
+
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < static_cast<unsigned_fast_type>(UINT8_C(64)); ++i)
+      {
+        s = u;
+
+        local_wide_integer_type m_over_s_pow_3_minus_one(m);
+
+        // Use an unrolled loop to divide by s^2 here.
+        // Without a loop, s^2 could potentially overflow.
+        m_over_s_pow_3_minus_one /= s;
+        m_over_s_pow_3_minus_one /= s;
+
+        u = ((s * three_minus_one) + m_over_s_pow_3_minus_one) / static_cast<unsigned>(UINT8_C(3));
+
+        if(u >= s)
+        {
+          break;
+        }
+      }
+    }
+
+    return s;
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto rootk(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m, std::uint_fast8_t k) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate the k'th root.
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    local_wide_integer_type s;
+
+    if(k < static_cast<std::uint_fast8_t>(UINT8_C(2)))
+    {
+      s = m;
+    }
+    else if(k == static_cast<std::uint_fast8_t>(UINT8_C(2)))
+    {
+      s = sqrt(m);
+    }
+    else if(k == static_cast<std::uint_fast8_t>(UINT8_C(3)))
+    {
+      s = cbrt(m);
+    }
+    else
+    {
+      if(m.is_zero() || local_wide_integer_type::is_neg(m))
+      {
+        s = local_wide_integer_type(static_cast<std::uint_fast8_t>(UINT8_C(0)));
+      }
+      else
+      {
+        // Obtain the initial guess via algorithms
+        // involving the position of the msb.
+        const auto msb_pos = msb(m);
+
+        // Obtain the initial value.
+        const auto msb_pos_mod_k = static_cast<unsigned_fast_type>(msb_pos % static_cast<unsigned_fast_type>(k));
+
+        const auto left_shift_amount =
+          static_cast<unsigned_fast_type>
+          (
+            (msb_pos_mod_k == unsigned_fast_type { UINT8_C(0) })
+              ? unsigned_fast_type { UINT8_C(1) } + static_cast<unsigned_fast_type>(msb_pos / unsigned_fast_type { k })
+              : unsigned_fast_type { UINT8_C(1) } + static_cast<unsigned_fast_type>((msb_pos + (unsigned_fast_type { k } - msb_pos_mod_k)) / unsigned_fast_type { k })
+          );
+
+        auto u = static_cast<local_wide_integer_type>(static_cast<unsigned>(UINT8_C(1))) << left_shift_amount;
+
+        // Perform the iteration for the k'th root.
+        // See Algorithm 1.14 RootInt, Sect. 1.5.2
+        // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
+        // Cambridge University Press, 2011.
+
+        const auto k_minus_one = static_cast<unsigned_fast_type>(k - 1U);
+
+        for(auto   i = static_cast<unsigned_fast_type>(UINT8_C(0));
+                   i < static_cast<unsigned_fast_type>(UINT8_C(64));
+                 ++i)
+        {
+          s = u;
+
+          local_wide_integer_type m_over_s_pow_k_minus_one(m);
+
+          // Use a recursive call here to divide by s^(k - 1). This behaves like
+          // a loop. Without a "loop" (i.e., a recursive call) here, s^(k - 1)
+          // could potentially overflow.
+          detail::div_maker_recursive(m_over_s_pow_k_minus_one, s, static_cast<int>(k_minus_one));
+
+          u = ((s * k_minus_one) + m_over_s_pow_k_minus_one) / k;
+
+          if(u >= s)
+          {
+            break;
+          }
+        }
+      }
+    }
+
+    return s;
+  }
+
+  namespace detail {
+
+  template<typename IntegralTypeP>
+  constexpr auto exponent_bit_count(const IntegralTypeP& p) -> std::enable_if_t<std::is_integral<IntegralTypeP>::value, unsigned_fast_type>
+  {
+    IntegralTypeP p_local(p);
+
+    auto bit_count = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+    while(p_local != static_cast<IntegralTypeP>(0)) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      p_local >>= 1U; // NOLINT(hicpp-signed-bitwise)
+
+      ++bit_count;
+    }
+
+    return bit_count;
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto exponent_bit_count(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& p) -> unsigned_fast_type
+  {
+    return
+      static_cast<unsigned_fast_type>
+      (
+        (p == static_cast<unsigned>(UINT8_C(0))) ? static_cast<unsigned_fast_type>(UINT8_C(0))
+                                                 : static_cast<unsigned_fast_type>(msb(p) + static_cast<unsigned_fast_type>(UINT8_C(1)))
+      );
+  }
+
+  template<typename IntegralTypeP>
+  constexpr auto exponent_bits(const IntegralTypeP& p, const unsigned_fast_type pos, const unsigned_fast_type count) -> unsigned_fast_type
+  {
+    // Extract count <= 8 bits of the exponent p, starting at bit position pos.
+    const auto mask = static_cast<std::uint8_t>((static_cast<unsigned>(UINT8_C(1)) << static_cast<unsigned>(count)) - 1U);
+
+    return static_cast<unsigned_fast_type>(static_cast<std::uint8_t>(static_cast<std::uint8_t>(p >> pos) & mask));
+  }
+
+  template<typename IntegralTypeP>
+  constexpr auto exponent_bits_ct(const IntegralTypeP& p, const unsigned_fast_type pos, const unsigned_fast_type count) -> std::enable_if_t<std::is_integral<IntegralTypeP>::value, unsigned_fast_type>
+  {
+    // Extract count <= 8 bits of the built-in exponent p at bit position pos.
+    const auto mask = static_cast<std::uint8_t>((static_cast<unsigned>(UINT8_C(1)) << static_cast<unsigned>(count)) - 1U);
+
+    return static_cast<unsigned_fast_type>(static_cast<std::uint8_t>(static_cast<std::uint8_t>(p >> pos) & mask)); // NOLINT(hicpp-signed-bitwise)
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto exponent_bits_ct(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& p, const unsigned_fast_type pos, const unsigned_fast_type count) -> unsigned_fast_type
+  {
+    // Extract count <= 8 bits of the exponent p at bit position pos
+    // by reading the one limb that holds them. Unlike a shift of the
+    // whole exponent, the work does not depend on the value of p.
+    // The window may not straddle two limbs.
+
+    using local_limb_type = LimbType;
+
+    const auto mask = static_cast<std::uint8_t>((static_cast<unsigned>(UINT8_C(1)) << static_cast<unsigned>(count)) - 1U);
+
+    const auto limb_index = static_cast<unsigned_fast_type>(pos / static_cast<unsigned_fast_type>(std::numeric_limits<local_limb_type>::digits));
+    const auto limb_shift = static_cast<unsigned_fast_type>(pos % static_cast<unsigned_fast_type>(std::numeric_limits<local_limb_type>::digits));
+
+    const auto limb = p.crepresentation()[static_cast<typename uintwide_t<Width2, LimbType, AllocatorType, IsSigned>::representation_type::size_type>(limb_index)];
+
+    return static_cast<unsigned_fast_type>(static_cast<std::uint8_t>(static_cast<std::uint8_t>(limb >> limb_shift) & mask));
+  }
+
+  constexpr auto is_equal_ct(const unsigned_fast_type a, const unsigned_fast_type b) -> bool
+  {
+    // Compare two small values without a data-dependent branch.
+    // The top bit of (d | -d) is set if and only if d is nonzero.
+    const auto d = static_cast<unsigned_fast_type>(a ^ b);
+
+    const auto d_or_minus_d = static_cast<unsigned_fast_type>(d | static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(UINT8_C(0)) - d));
+
+    return (static_cast<unsigned_fast_type>(d_or_minus_d >> static_cast<unsigned>(std::numeric_limits<unsigned_fast_type>::digits - 1)) == static_cast<unsigned_fast_type>(UINT8_C(0)));
+  }
+
+  template<typename ValueType>
+  struct pow_policy_plain
+  {
+    WIDE_INTEGER_NODISCARD constexpr auto mul(const ValueType& a, const ValueType& b) const -> ValueType { return a * b; }
+    WIDE_INTEGER_NODISCARD constexpr auto sqr(const ValueType& a) const -> ValueType { return a * a; }
+  };
+
+  template<typename ValueType>
+  struct pow_policy_modulus
+  {
+    const ValueType& m; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+
+    WIDE_INTEGER_NODISCARD constexpr auto mul(const ValueType& a, const ValueType& b) const -> ValueType { return (a * b) % m; }
+    WIDE_INTEGER_NODISCARD constexpr auto sqr(const ValueType& a) const -> ValueType { return (a * a) % m; }
+  };
+
+  template<typename MontgomeryContextType>
+  struct pow_policy_montgomery
+  {
+    using value_type = typename MontgomeryContextType::result_type;
+
+    const MontgomeryContextType& ctx; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+
+    WIDE_INTEGER_NODISCARD constexpr auto mul(const value_type& a, const value_type& b) const -> value_type { return ctx.mont_mul(a, b); }
+    WIDE_INTEGER_NODISCARD constexpr auto sqr(const value_type& a) const -> value_type { return ctx.mont_sqr(a); }
+
+    WIDE_INTEGER_NODISCARD constexpr auto to_domain(const value_type& a) const -> value_type { return ctx.to_montgomery(a); }
+  };
+
+  template<typename BarrettReducerType>
+  struct pow_policy_barrett
+  {
+    using value_type = typename BarrettReducerType::result_type;
+
+    const BarrettReducerType& ctx; // NOLINT(cppcoreguidelines-avoid-const-or-ref-data-members)
+
+    WIDE_INTEGER_NODISCARD constexpr auto mul(const value_type& a, const value_type& b) const -> value_type { return ctx.mul_mod(a, b); }
+    WIDE_INTEGER_NODISCARD constexpr auto sqr(const value_type& a) const -> value_type { return ctx.sqr_mod(a); }
+
+    WIDE_INTEGER_NODISCARD constexpr auto to_domain(const value_type& a) const -> value_type { return (a < ctx.modulus()) ? a : (a % ctx.modulus()); }
+  };
+
+  template<const unsigned_fast_type WindowBits,
+           typename ValueType,
+           typename IntegralTypeP,
+           typename PowPolicyType>
+  constexpr auto pow_sliding_window_k(const ValueType&         one,
+                                      const ValueType&         b,
+                                      const IntegralTypeP&     p,
+                                      const unsigned_fast_type bit_count,
+                                      const PowPolicyType&     policy) -> ValueType
+  {
+    // Calculate b^p with left-to-right sliding-window exponentiation
+    // having the window width k = WindowBits. The odd powers
+    // b, b^3, ..., b^(2^k - 1) are tabulated first. The exponent is
+    // then scanned from the top, with one squaring per bit and one
+    // multiplication per window of up to k bits. The table holds
+    // exactly the 2^(k - 1) odd powers that are needed.
+
+    constexpr auto k = WindowBits;
+
+    constexpr auto table_count = static_cast<std::size_t>(static_cast<unsigned>(UINT8_C(1)) << static_cast<unsigned>(k - static_cast<unsigned_fast_type>(UINT8_C(1))));
+
+    detail::array_detail::array<ValueType, table_count> odd_powers { };
+
+    odd_powers[static_cast<std::size_t>(UINT8_C(0))] = b;
+
+    if(table_count > static_cast<std::size_t>(UINT8_C(1)))
+    {
+      const ValueType b2 { policy.sqr(b) };
+
+      for(auto i = static_cast<std::size_t>(UINT8_C(1)); i < table_count; ++i)
+      {
+        odd_powers[i] = policy.mul(odd_powers[static_cast<std::size_t>(i - static_cast<std::size_t>(UINT8_C(1)))], b2);
+      }
+    }
+
+    ValueType result { one };
+
+    auto result_is_one = true;
+
+    auto i = static_cast<signed_fast_type>(bit_count);
+
+    while(i > static_cast<signed_fast_type>(INT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      const auto top = static_cast<unsigned_fast_type>(i - static_cast<signed_fast_type>(INT8_C(1)));
+
+      if(exponent_bits(p, top, static_cast<unsigned_fast_type>(UINT8_C(1))) == static_cast<unsigned_fast_type>(UINT8_C(0)))
+      {
+        if(!result_is_one) { result = policy.sqr(result); }
+
+        --i;
+      }
+      else
+      {
+        // Take the longest window of at most k bits that starts
+        // at the top bit and ends in a set bit.
+        auto lo =
+          static_cast<unsigned_fast_type>
+          (
+            (top >= static_cast<unsigned_fast_type>(k - static_cast<unsigned_fast_type>(UINT8_C(1))))
+              ? static_cast<unsigned_fast_type>(top - static_cast<unsigned_fast_type>(k - static_cast<unsigned_fast_type>(UINT8_C(1))))
+              : static_cast<unsigned_fast_type>(UINT8_C(0))
+          );
+
+        while(exponent_bits(p, lo, static_cast<unsigned_fast_type>(UINT8_C(1))) == static_cast<unsigned_fast_type>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+        {
+          ++lo;
+        }
+
+        const auto width = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(top - lo) + static_cast<unsigned_fast_type>(UINT8_C(1)));
+
+        if(!result_is_one)
+        {
+          for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < width; ++j)
+          {
+            result = policy.sqr(result);
+          }
+        }
+
+        const auto& odd_power = odd_powers[static_cast<std::size_t>(exponent_bits(p, lo, width) >> 1U)];
+
+        result = (result_is_one ? odd_power : policy.mul(result, odd_power));
+
+        result_is_one = false;
+
+        i = static_cast<signed_fast_type>(lo);
+      }
+    }
+
+    return result;
+  }
+
+  template<typename ValueType,
+           typename IntegralTypeP,
+           typename PowPolicyType>
+  constexpr auto pow_sliding_window(const ValueType&     one,
+                                    const ValueType&     b,
+                                    const IntegralTypeP& p,
+                                    const std::uint_fast8_t window_bits,
+                                    const PowPolicyType& policy) -> ValueType
+  {
+    // Calculate b^p with sliding-window exponentiation. A window_bits
+    // of zero selects the window width automatically. The table of
+    // odd powers is sized at compile time for each width, so only
+    // the width that is chosen here occupies storage.
+
+    static_assert(exponent_window_bits_limit == static_cast<std::uint_fast8_t>(UINT8_C(6)),
+                  "Error: The dispatch of the window widths must cover exponent_window_bits_limit");
+
+    const auto bit_count = exponent_bit_count(p);
+
+    const auto k =
+      static_cast<unsigned_fast_type>
+      (
+        (window_bits == static_cast<std::uint_fast8_t>(UINT8_C(0)))
+          ? (detail::min_unsafe)(static_cast<unsigned_fast_type>(ValueType::exponent_window_bits), static_cast<unsigned_fast_type>(exponent_window_bits_for(bit_count)))
+          : (detail::min_unsafe)(static_cast<unsigned_fast_type>(exponent_window_bits_limit), static_cast<unsigned_fast_type>(window_bits))
+      );
+
+    return
+        (k == static_cast<unsigned_fast_type>(UINT8_C(1))) ? pow_sliding_window_k<static_cast<unsigned_fast_type>(UINT8_C(1))>(one, b, p, bit_count, policy)
+      : (k == static_cast<unsigned_fast_type>(UINT8_C(2))) ? pow_sliding_window_k<static_cast<unsigned_fast_type>(UINT8_C(2))>(one, b, p, bit_count, policy)
+      : (k == static_cast<unsigned_fast_type>(UINT8_C(3))) ? pow_sliding_window_k<static_cast<unsigned_fast_type>(UINT8_C(3))>(one, b, p, bit_count, policy)
+      : (k == static_cast<unsigned_fast_type>(UINT8_C(4))) ? pow_sliding_window_k<static_cast<unsigned_fast_type>(UINT8_C(4))>(one, b, p, bit_count, policy)
+      : (k == static_cast<unsigned_fast_type>(UINT8_C(5))) ? pow_sliding_window_k<static_cast<unsigned_fast_type>(UINT8_C(5))>(one, b, p, bit_count, policy)
+      :                                                      pow_sliding_window_k<static_cast<unsigned_fast_type>(UINT8_C(6))>(one, b, p, bit_count, policy);
+  }
+
+  // The number of terms that pow_interleaved combines in one chain of squarings.
+  constexpr auto pow_interleaved_term_limit = static_cast<std::size_t>(UINT8_C(8));
+
+  template<typename ValueType,
+           typename IntegralTypeP,
+           typename PowPolicyType>
+  constexpr auto pow_interleaved(const ValueType&     one,
+                                 const array_detail::array<ValueType,     pow_interleaved_term_limit>& b,
+                                 const array_detail::array<IntegralTypeP, pow_interleaved_term_limit>& p,
+                                 const std::size_t    count,
+                                 const PowPolicyType& policy) -> ValueType
+  {
+    // Calculate the product of the powers b[j]^p[j] for j < count
+    // with Straus' method, using interleaved sliding windows. The odd
+    // powers of each base are tabulated, and all of the exponents are
+    // scanned from the top in one shared chain of squarings. For each
+    // exponent, a window of up to 4 bits that ends in a set bit is
+    // multiplied in when the scan reaches the lowest bit of the window.
+
+    constexpr auto window_limit = static_cast<unsigned_fast_type>(UINT8_C(4));
+    constexpr auto table_size   = static_cast<std::size_t>(static_cast<unsigned>(UINT8_C(1)) << static_cast<unsigned>(window_limit - 1U));
+
+    array_detail::array<ValueType, static_cast<std::size_t>(pow_interleaved_term_limit * table_size)> odd_powers { };
+
+    array_detail::array<unsigned_fast_type, pow_interleaved_term_limit> bit_count   { };
+    array_detail::array<unsigned_fast_type, pow_interleaved_term_limit> window_bits { };
+    array_detail::array<signed_fast_type,   pow_interleaved_term_limit> window_lo   { };
+    array_detail::array<unsigned_fast_type, pow_interleaved_term_limit> window_val  { };
+
+    auto max_bit_count = static_cast<unsigned_fast_type>(UINT8_C(0));
+
+    for(auto j = static_cast<std::size_t>(UINT8_C(0)); j < count; ++j)
+    {
+      bit_count[j]   = exponent_bit_count(p[j]);
+      window_bits[j] = (detail::min_unsafe)(window_limit, static_cast<unsigned_fast_type>(exponent_window_bits_for(bit_count[j])));
+      window_lo[j]   = static_cast<signed_fast_type>(INT8_C(-1));
+
+      max_bit_count = (detail::max_unsafe)(max_bit_count, bit_count[j]);
+
+      const auto first = static_cast<std::size_t>(j * table_size);
+
+      odd_powers[first] = b[j];
+
+      const auto table_count = static_cast<std::size_t>(static_cast<unsigned>(UINT8_C(1)) << static_cast<unsigned>(window_bits[j] - 1U));
+
+      if(table_count > static_cast<std::size_t>(UINT8_C(1)))
+      {
+        const ValueType b2 { policy.sqr(b[j]) };
+
+        for(auto i = static_cast<std::size_t>(UINT8_C(1)); i < table_count; ++i)
+        {
+          odd_powers[static_cast<std::size_t>(first + i)] = policy.mul(odd_powers[static_cast<std::size_t>(first + i - 1U)], b2);
+        }
+      }
+    }
+
+    ValueType result { one };
+
+    auto result_is_one = true;
+
+    for(auto i = static_cast<signed_fast_type>(static_cast<signed_fast_type>(max_bit_count) - 1); i >= static_cast<signed_fast_type>(INT8_C(0)); --i) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      if(!result_is_one) { result = policy.sqr(result); }
+
+      const auto pos = static_cast<unsigned_fast_type>(i);
+
+      for(auto j = static_cast<std::size_t>(UINT8_C(0)); j < count; ++j)
+      {
+        if((window_lo[j] < static_cast<signed_fast_type>(INT8_C(0))) && (pos < bit_count[j]) && (exponent_bits(p[j], pos, static_cast<unsigned_fast_type>(UINT8_C(1))) != static_cast<unsigned_fast_type>(UINT8_C(0))))
+        {
+          // Open a new window having its top bit at pos.
+          auto lo =
+            static_cast<unsigned_fast_type>
+            (
+              (pos >= static_cast<unsigned_fast_type>(window_bits[j] - 1U)) ? static_cast<unsigned_fast_type>(pos - static_cast<unsigned_fast_type>(window_bits[j] - 1U))
+                                                                            : static_cast<unsigned_fast_type>(UINT8_C(0))
+            );
+
+          while(exponent_bits(p[j], lo, static_cast<unsigned_fast_type>(UINT8_C(1))) == static_cast<unsigned_fast_type>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+          {
+            ++lo;
+          }
+
+          window_lo [j] = static_cast<signed_fast_type>(lo);
+          window_val[j] = exponent_bits(p[j], lo, static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(pos - lo) + 1U));
+        }
+
+        if(window_lo[j] == i)
+        {
+          const auto& odd_power = odd_powers[static_cast<std::size_t>(static_cast<std::size_t>(j * table_size) + static_cast<std::size_t>(window_val[j] >> 1U))];
+
+          result = (result_is_one ? odd_power : policy.mul(result, odd_power));
+
+          result_is_one = false;
+
+          window_lo[j] = static_cast<signed_fast_type>(INT8_C(-1));
+        }
+      }
+    }
+
+    return result;
+  }
+
+  template<typename InputIterator,
+           typename ValueType,
+           typename PowPolicyType>
+  constexpr auto pow_interleaved_range(InputIterator        first,
+                                       InputIterator        last,
+                                       const ValueType&     one,
+                                       const PowPolicyType& policy) -> ValueType
+  {
+    // Multiply the powers of the pairs (b, p) in [first, last), taking
+    // the terms in groups of up to pow_interleaved_term_limit at a time.
+
+    using local_exponent_type = typename iterator_detail::iterator_traits<InputIterator>::value_type::second_type;
+
+    array_detail::array<ValueType,           pow_interleaved_term_limit> b { };
+    array_detail::array<local_exponent_type, pow_interleaved_term_limit> p { };
+
+    ValueType result { one };
+
+    auto result_is_one = true;
+
+    while(first != last) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      auto count = static_cast<std::size_t>(UINT8_C(0));
+
+      while((first != last) && (count < pow_interleaved_term_limit)) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        b[count] = policy.to_domain(first->first);
+        p[count] = first->second;
+
+        ++count;
+        ++first;
+      }
+
+      const ValueType group { pow_interleaved(one, b, p, count, policy) };
+
+      result = (result_is_one ? group : policy.mul(result, group));
+
+      result_is_one = false;
+    }
+
+    return result;
+  }
+
+  } // namespace detail
+
+  template<typename ValueType,
+           const unsigned_fast_type ExponentBits,
+           const unsigned_fast_type WindowBits>
+  class fixed_base_table
+  {
+  public:
+    // A table of powers of the fixed base g for exponentiations g^p,
+    // with exponents p having up to ExponentBits bits. Row i holds the
+    // powers g^(j * 2^(w * i)) for 0 < j < 2^w, where w is WindowBits.
+    // The power g^p is then the product of one entry per w-bit digit
+    // of p and needs no squaring at all. A wider window trades memory,
+    // growing as 2^w / w, for fewer multiplications (ExponentBits / w).
+    // The group operation is given by a policy having mul() and sqr().
+
+    using value_type     = ValueType;
+    using size_type      = std::size_t;
+    using iterator       =       value_type*;
+    using const_iterator = const value_type*;
+
+    static_assert((WindowBits >= static_cast<unsigned_fast_type>(UINT8_C(1))) && (WindowBits <= static_cast<unsigned_fast_type>(UINT8_C(8))),
+                  "Error: The window of the fixed-base table must have 1 to 8 bits");
+
+    static constexpr auto row_count = static_cast<size_type>((ExponentBits + WindowBits - static_cast<unsigned_fast_type>(UINT8_C(1))) / WindowBits);
+    static constexpr auto row_size  = static_cast<size_type>((static_cast<size_type>(UINT8_C(1)) << static_cast<unsigned>(WindowBits)) - static_cast<size_type>(UINT8_C(1)));
+
+    template<typename GroupPolicyType>
+    constexpr fixed_base_table(const value_type& g, const value_type& one, const GroupPolicyType& policy)
+      : my_one(one),
+        my_top(g)
+    {
+      // Fill the rows, with my_top running through the bases g^(2^(w * i))
+      // of the rows. It ends up being g^(2^(w * row_count)).
+
+      for(auto row = static_cast<size_type>(UINT8_C(0)); row < row_count; ++row)
+      {
+        const auto first = static_cast<size_type>(row * row_size);
+
+        my_powers[first] = my_top;
+
+        for(auto j = static_cast<size_type>(UINT8_C(1)); j < row_size; ++j)
+        {
+          my_powers[static_cast<size_type>(first + j)] = policy.mul(my_powers[static_cast<size_type>(first + j - 1U)], my_top);
+        }
+
+        my_top = policy.mul(my_powers[static_cast<size_type>(first + row_size - 1U)], my_top);
+      }
+    }
+
+    constexpr fixed_base_table() = delete;
+
+    constexpr fixed_base_table(const fixed_base_table&) = default;
+    constexpr fixed_base_table(fixed_base_table&&) noexcept = default;
+
+    ~fixed_base_table() = default;
+
+    constexpr auto operator=(const fixed_base_table&) -> fixed_base_table& = default;
+    constexpr auto operator=(fixed_base_table&&) noexcept -> fixed_base_table& = default;
+
+    // The entries may be modified in place, for instance in order
+    // to bring them into a representation that is faster to use.
+    WIDE_INTEGER_NODISCARD constexpr auto begin()       -> iterator       { return my_powers.begin(); }
+    WIDE_INTEGER_NODISCARD constexpr auto end  ()       -> iterator       { return my_powers.end(); }
+    WIDE_INTEGER_NODISCARD constexpr auto begin() const -> const_iterator { return my_powers.begin(); }
+    WIDE_INTEGER_NODISCARD constexpr auto end  () const -> const_iterator { return my_powers.end(); }
+
+    template<typename IntegralTypeP,
+             typename GroupPolicyType>
+    WIDE_INTEGER_NODISCARD constexpr auto pow(const IntegralTypeP& p, const GroupPolicyType& policy) const -> value_type
+    {
+      // Calculate g^p for 0 <= p. The (unusual) bits of p above the
+      // table are handled first, with square-and-multiply on my_top.
+
+      const auto bit_count  = detail::exponent_bit_count(p);
+      const auto table_bits = static_cast<unsigned_fast_type>(row_count * static_cast<size_type>(WindowBits));
+
+      value_type result { my_one };
+
+      auto result_is_one = true;
+
+      for(auto i = bit_count; i > table_bits; --i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        if(!result_is_one) { result = policy.sqr(result); }
+
+        if(detail::exponent_bits(p, static_cast<unsigned_fast_type>(i - 1U), static_cast<unsigned_fast_type>(UINT8_C(1))) != static_cast<unsigned_fast_type>(UINT8_C(0)))
+        {
+          result = (result_is_one ? my_top : policy.mul(result, my_top));
+
+          result_is_one = false;
+        }
+      }
+
+      for(auto row = static_cast<size_type>(UINT8_C(0)); ((row < row_count) && (static_cast<unsigned_fast_type>(row * static_cast<size_type>(WindowBits)) < bit_count)); ++row) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto digit = detail::exponent_bits(p, static_cast<unsigned_fast_type>(row * static_cast<size_type>(WindowBits)), WindowBits);
+
+        if(digit != static_cast<unsigned_fast_type>(UINT8_C(0)))
+        {
+          const auto& entry = my_powers[static_cast<size_type>(static_cast<size_type>(row * row_size) + static_cast<size_type>(digit - 1U))];
+
+          result = (result_is_one ? entry : policy.mul(result, entry));
+
+          result_is_one = false;
+        }
+      }
+
+      return result;
+    }
+
+  private:
+    using powers_array_type = detail::array_detail::array<value_type, static_cast<size_type>(row_count * row_size)>;
+
+    value_type        my_one;
+    value_type        my_top;
+    powers_array_type my_powers { };
+  };
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  class montgomery_context
+  {
+  public:
+    using result_type      = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using limb_type        = typename result_type::limb_type;
+    using double_limb_type = typename result_type::double_limb_type;
+
+    // Set up the Montgomery context for the odd, positive modulus m.
+    // Here, R = 2^(limb_bits * n), where n is the number of limbs
+    // that are actually used in m. This precomputes R^2 mod m,
+    // R mod m (being 1 in Montgomery form) and -m^-1 mod 2^limb_bits.
+    explicit constexpr montgomery_context(const result_type& m) // NOLINT(modernize-pass-by-value)
+      : my_m(m),
+        my_n(used_limbs(m)),
+        my_minv(negative_inverse_of_limb(*m.crepresentation().cbegin()))
+    {
+      using local_double_width_unsigned_type =
+        uintwide_t<static_cast<size_t>(Width2 * static_cast<size_t>(UINT8_C(2))), limb_type, AllocatorType, false>;
+
+      const local_double_width_unsigned_type m_wide(m);
+
+      local_double_width_unsigned_type r(static_cast<std::uint8_t>(UINT8_C(1)));
+
+      r <<= static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits) * my_n);
+      r  %= m_wide;
+
+      my_one = result_type(r);
+
+      r *= r;
+      r %= m_wide;
+
+      my_r2 = result_type(r);
+    }
+
+    constexpr montgomery_context() = delete;
+
+    constexpr montgomery_context(const montgomery_context&) = default;
+    constexpr montgomery_context(montgomery_context&&) noexcept = default;
+
+    ~montgomery_context() = default;
+
+    constexpr auto operator=(const montgomery_context&) -> montgomery_context& = default;
+    constexpr auto operator=(montgomery_context&&) noexcept -> montgomery_context& = default;
+
+    WIDE_INTEGER_NODISCARD constexpr auto modulus() const -> const result_type& { return my_m; }
+    WIDE_INTEGER_NODISCARD constexpr auto r2     () const -> const result_type& { return my_r2; }
+    WIDE_INTEGER_NODISCARD constexpr auto minv   () const -> limb_type          { return my_minv; }
+
+    WIDE_INTEGER_NODISCARD constexpr auto to_montgomery(const result_type& a) const -> result_type
+    {
+      return mont_mul((a < my_m) ? a : (a % my_m), my_r2);
+    }
+
+    WIDE_INTEGER_NODISCARD constexpr auto from_montgomery(const result_type& a) const -> result_type
+    {
+      return mont_mul(a, result_type(static_cast<std::uint8_t>(UINT8_C(1))));
+    }
+
+    WIDE_INTEGER_NODISCARD constexpr auto mont_mul(const result_type& a, const result_type& b) const -> result_type
+    {
+      // Calculate (a * b * R^-1) mod m for a, b < m using coarsely
+      // integrated operand scanning (CIOS). Each limb of b is multiplied
+      // in and one limb is reduced away right away, so the running sum
+      // t never exceeds n + 2 limbs. The top two limbs t[n] and t[n + 1]
+      // are held separately in t_n and t_n1.
+
+      result_type t { };
+
+      auto t_n  = static_cast<limb_type>(UINT8_C(0));
+      auto t_n1 = static_cast<limb_type>(UINT8_C(0));
+
+      const auto& av = a.crepresentation();
+      const auto& bv = b.crepresentation();
+      const auto& mv = my_m.crepresentation();
+            auto& tv = t.representation();
+
+      for(auto i = static_cast<local_size_type>(UINT8_C(0)); i < static_cast<local_size_type>(my_n); ++i)
+      {
+        const auto bi = bv[i];
+
+        auto carry = static_cast<limb_type>(UINT8_C(0));
+
+        for(auto j = static_cast<local_size_type>(UINT8_C(0)); j < static_cast<local_size_type>(my_n); ++j)
+        {
+          const auto uv =
+            static_cast<double_limb_type>
+            (
+                static_cast<double_limb_type>(tv[j])
+              + static_cast<double_limb_type>(static_cast<double_limb_type>(av[j]) * bi)
+              + carry
+            );
+
+          tv[j] = static_cast<limb_type>(uv);
+          carry = detail::make_hi<limb_type>(uv);
+        }
+
+        const auto uv_n = static_cast<double_limb_type>(static_cast<double_limb_type>(t_n) + carry);
+
+        t_n  = static_cast<limb_type>(uv_n);
+        t_n1 = detail::make_hi<limb_type>(uv_n);
+
+        // Add q * m, with q chosen such that the lowest limb vanishes,
+        // and shift the running sum down by one limb.
+        const auto q = static_cast<limb_type>(static_cast<double_limb_type>(tv[static_cast<local_size_type>(UINT8_C(0))]) * my_minv);
+
+        carry =
+          detail::make_hi<limb_type>
+          (
+            static_cast<double_limb_type>
+            (
+                static_cast<double_limb_type>(tv[static_cast<local_size_type>(UINT8_C(0))])
+              + static_cast<double_limb_type>(static_cast<double_limb_type>(q) * mv[static_cast<local_size_type>(UINT8_C(0))])
+            )
+          );
+
+        for(auto j = static_cast<local_size_type>(UINT8_C(1)); j < static_cast<local_size_type>(my_n); ++j)
+        {
+          const auto uv =
+            static_cast<double_limb_type>
+            (
+                static_cast<double_limb_type>(tv[j])
+              + static_cast<double_limb_type>(static_cast<double_limb_type>(q) * mv[j])
+              + carry
+            );
+
+          tv[static_cast<local_size_type>(j - static_cast<local_size_type>(UINT8_C(1)))] = static_cast<limb_type>(uv);
+
+          carry = detail::make_hi<limb_type>(uv);
+        }
+
+        const auto uv_top = static_cast<double_limb_type>(static_cast<double_limb_type>(t_n) + carry);
+
+        tv[static_cast<local_size_type>(my_n - static_cast<unsigned_fast_type>(UINT8_C(1)))] = static_cast<limb_type>(uv_top);
+
+        t_n = static_cast<limb_type>(t_n1 + detail::make_hi<limb_type>(uv_top));
+      }
+
+      subtract_modulus_if_needed(t, t_n);
+
+      return t;
+    }
+
+    WIDE_INTEGER_NODISCARD constexpr auto mont_sqr(const result_type& a) const -> result_type
+    {
+      // Calculate (a * a * R^-1) mod m for a < m. Square first, computing
+      // each cross product a[i] * a[j] (i < j) only once and doubling,
+      // then reduce the 2n-limb square with separated operand scanning.
+
+      using local_double_width_unsigned_type =
+        uintwide_t<static_cast<size_t>(Width2 * static_cast<size_t>(UINT8_C(2))), limb_type, AllocatorType, false>;
+
+      local_double_width_unsigned_type t { };
+
+      const auto& av = a.crepresentation();
+      const auto& mv = my_m.crepresentation();
+            auto& tv = t.representation();
+
+      using local_double_size_type = typename local_double_width_unsigned_type::representation_type::size_type;
+
+      const auto n  = (detail::min_unsafe)(static_cast<local_double_size_type>(my_n), static_cast<local_double_size_type>(result_type::number_of_limbs));
+      const auto n2 = static_cast<local_double_size_type>(n * static_cast<local_double_size_type>(UINT8_C(2)));
+
+      for(auto i = static_cast<local_double_size_type>(UINT8_C(0)); i < n; ++i)
+      {
+        const auto ai = av[static_cast<local_size_type>(i)];
+
+        auto carry = static_cast<limb_type>(UINT8_C(0));
+
+        for(auto j = static_cast<local_double_size_type>(i + static_cast<local_double_size_type>(UINT8_C(1))); j < n; ++j)
+        {
+          const auto uv =
+            static_cast<double_limb_type>
+            (
+                static_cast<double_limb_type>(tv[static_cast<local_double_size_type>(i + j)])
+              + static_cast<double_limb_type>(static_cast<double_limb_type>(av[static_cast<local_size_type>(j)]) * ai)
+              + carry
+            );
+
+          tv[static_cast<local_double_size_type>(i + j)] = static_cast<limb_type>(uv);
+
+          carry = detail::make_hi<limb_type>(uv);
+        }
+
+        tv[static_cast<local_double_size_type>(i + n)] = carry;
+      }
+
+      // Double the cross products and add the squares on the diagonal.
+      auto bit_in = static_cast<limb_type>(UINT8_C(0));
+      auto carry  = static_cast<limb_type>(UINT8_C(0));
+
+      for(auto i = static_cast<local_double_size_type>(UINT8_C(0)); i < n; ++i)
+      {
+        const auto ai = av[static_cast<local_size_type>(i)];
+
+        const auto sq = static_cast<double_limb_type>(static_cast<double_limb_type>(ai) * ai);
+
+        const auto i2 = static_cast<local_double_size_type>(i * static_cast<local_double_size_type>(UINT8_C(2)));
+
+        for(auto k = static_cast<local_double_size_type>(UINT8_C(0)); k < static_cast<local_double_size_type>(UINT8_C(2)); ++k)
+        {
+          const auto tk = tv[static_cast<local_double_size_type>(i2 + k)];
+
+          const auto doubled = static_cast<limb_type>(static_cast<limb_type>(tk << static_cast<unsigned>(UINT8_C(1))) | bit_in);
+
+          bit_in = static_cast<limb_type>(tk >> static_cast<unsigned>(std::numeric_limits<limb_type>::digits - 1));
+
+          const auto part = ((k == static_cast<local_double_size_type>(UINT8_C(0))) ? static_cast<limb_type>(sq) : detail::make_hi<limb_type>(sq));
+
+          const auto uv =
+            static_cast<double_limb_type>
+            (
+                static_cast<double_limb_type>(doubled)
+              + part
+              + carry
+            );
+
+          tv[static_cast<local_double_size_type>(i2 + k)] = static_cast<limb_type>(uv);
+
+          carry = detail::make_hi<limb_type>(uv);
+        }
+      }
+
+      // Reduce the square limb by limb from the bottom. The carry out
+      // of the top of each step is added in at the top of the next step.
+      auto carry_top = static_cast<limb_type>(UINT8_C(0));
+
+      for(auto i = static_cast<local_double_size_type>(UINT8_C(0)); i < n; ++i)
+      {
+        const auto q = static_cast<limb_type>(static_cast<double_limb_type>(tv[i]) * my_minv);
+
+        auto carry_q = static_cast<limb_type>(UINT8_C(0));
+
+        for(auto j = static_cast<local_double_size_type>(UINT8_C(0)); j < n; ++j)
+        {
+          const auto uv =
+            static_cast<double_limb_type>
+            (
+                static_cast<double_limb_type>(tv[static_cast<local_double_size_type>(i + j)])
+              + static_cast<double_limb_type>(static_cast<double_limb_type>(q) * mv[static_cast<local_size_type>(j)])
+              + carry_q
+            );
+
+          tv[static_cast<local_double_size_type>(i + j)] = static_cast<limb_type>(uv);
+
+          carry_q = detail::make_hi<limb_type>(uv);
+        }
+
+        const auto uv_top =
+          static_cast<double_limb_type>
+          (
+              static_cast<double_limb_type>(tv[static_cast<local_double_size_type>(i + n)])
+            + carry_q
+            + carry_top
+          );
+
+        tv[static_cast<local_double_size_type>(i + n)] = static_cast<limb_type>(uv_top);
+
+        carry_top = detail::make_hi<limb_type>(uv_top);
+      }
+
+      result_type result { };
+
+      detail::copy_unsafe(tv.cbegin() + static_cast<std::ptrdiff_t>(n), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                          tv.cbegin() + static_cast<std::ptrdiff_t>(n2), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                          result.representation().begin());
+
+      subtract_modulus_if_needed(result, carry_top);
+
+      return result;
+    }
+
+    template<typename OtherIntegralTypeP>
+    WIDE_INTEGER_NODISCARD constexpr auto powm(const result_type&       b,
+                                               const OtherIntegralTypeP& p,
+                                               const std::uint_fast8_t   window_bits = static_cast<std::uint_fast8_t>(UINT8_C(0))) const -> result_type
+    {
+      // Calculate (b ^ p) % m for 0 <= b, without any division
+      // in the loop over the bits of the exponent. A window_bits
+      // of zero selects the window width automatically.
+
+      const detail::pow_policy_montgomery<montgomery_context> policy { *this };
+
+      return from_montgomery(detail::pow_sliding_window(my_one, to_montgomery(b), p, window_bits, policy));
+    }
+
+    template<const unsigned_fast_type ExponentBits,
+             const unsigned_fast_type WindowBits = static_cast<unsigned_fast_type>(UINT8_C(4))>
+    WIDE_INTEGER_NODISCARD constexpr auto make_fixed_base_table(const result_type& g) const -> fixed_base_table<result_type, ExponentBits, WindowBits>
+    {
+      // Tabulate the powers of the fixed base g (in Montgomery form)
+      // for repeated use in powm(table, p).
+
+      const detail::pow_policy_montgomery<montgomery_context> policy { *this };
+
+      return fixed_base_table<result_type, ExponentBits, WindowBits>(to_montgomery(g), my_one, policy);
+    }
+
+    template<typename OtherIntegralTypeP,
+             const unsigned_fast_type ExponentBits,
+             const unsigned_fast_type WindowBits>
+    WIDE_INTEGER_NODISCARD constexpr auto powm(const fixed_base_table<result_type, ExponentBits, WindowBits>& table,
+                                               const OtherIntegralTypeP& p) const -> result_type
+    {
+      // Calculate (g ^ p) % m for the fixed base g of the table.
+
+      const detail::pow_policy_montgomery<montgomery_context> policy { *this };
+
+      return from_montgomery(table.pow(p, policy));
+    }
+
+    template<typename OtherIntegralTypeP>
+    WIDE_INTEGER_NODISCARD constexpr auto powm_ct(const result_type& b, const OtherIntegralTypeP& p) const -> result_type
+    {
+      // Calculate (b ^ p) % m for 0 <= b in constant time with respect
+      // to the (secret) exponent p. Use a fixed window of 4 bits over all
+      // of the digits of the type of p, not only its significant bits.
+      // Each window costs four squarings and one multiplication. The
+      // table entry is picked by scanning the whole table with
+      // conditional_select, so neither the sequence of operations nor
+      // the memory access pattern depends on the bits of p.
+
+      constexpr auto window_bits = static_cast<unsigned_fast_type>(UINT8_C(4));
+      constexpr auto table_size  = static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(1)) << window_bits);
+
+      constexpr auto digits_p = static_cast<unsigned_fast_type>(std::numeric_limits<OtherIntegralTypeP>::digits);
+
+      constexpr auto bit_count =
+        static_cast<unsigned_fast_type>
+        (
+          static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(digits_p + static_cast<unsigned_fast_type>(window_bits - 1U)) / window_bits) * window_bits
+        );
+
+      using table_type = detail::array_detail::array<result_type, table_size>;
+
+      table_type powers { };
+
+      powers[static_cast<typename table_type::size_type>(UINT8_C(0))] = my_one;
+      powers[static_cast<typename table_type::size_type>(UINT8_C(1))] = to_montgomery(b);
+
+      for(auto i = static_cast<typename table_type::size_type>(UINT8_C(2)); i < static_cast<typename table_type::size_type>(table_size); ++i)
+      {
+        powers[i] = mont_mul(powers[static_cast<typename table_type::size_type>(i - 1U)], powers[static_cast<typename table_type::size_type>(UINT8_C(1))]);
+      }
+
+      result_type x { my_one };
+
+      for(auto pos = bit_count; pos != static_cast<unsigned_fast_type>(UINT8_C(0)); ) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        pos = static_cast<unsigned_fast_type>(pos - window_bits);
+
+        for(auto j = static_cast<unsigned_fast_type>(UINT8_C(0)); j < window_bits; ++j)
+        {
+          x = mont_sqr(x);
+        }
+
+        const auto w = detail::exponent_bits_ct(p, pos, window_bits);
+
+        result_type power_w { };
+
+        for(auto i = static_cast<typename table_type::size_type>(UINT8_C(0)); i < static_cast<typename table_type::size_type>(table_size); ++i)
+        {
+          power_w.conditional_select(powers[i], detail::is_equal_ct(static_cast<unsigned_fast_type>(i), w));
+        }
+
+        x = mont_mul(x, power_w);
+      }
+
+      return from_montgomery(x);
+    }
+
+    template<typename OtherIntegralTypeP>
+    WIDE_INTEGER_NODISCARD constexpr auto powm_ladder_ct(const result_type& b, const OtherIntegralTypeP& p) const -> result_type
+    {
+      // Calculate (b ^ p) % m for 0 <= b in constant time with respect
+      // to the (secret) exponent p using the Montgomery ladder. This
+      // needs no table, at the cost of one multiplication per bit.
+      // The invariant r1 = r0 * b holds throughout. Each bit of p does
+      // one multiplication and one squaring, with the roles of r0 and r1
+      // swapped by conditional_select rather than by a branch.
 
-      auto it = values.begin(); // NOLINT(llvm-qualified-auto,readability-qualified-auto)
+      constexpr auto digits_p = static_cast<unsigned_fast_type>(std::numeric_limits<OtherIntegralTypeP>::digits);
 
-      do
+      result_type r0 { my_one };
+      result_type r1 { to_montgomery(b) };
+
+      for(auto pos = digits_p; pos != static_cast<unsigned_fast_type>(UINT8_C(0)); ) // NOLINT(altera-id-dependent-backward-branch)
       {
-        --(*it);
+        --pos;
+
+        const auto bit_is_set = (detail::exponent_bits_ct(p, pos, static_cast<unsigned_fast_type>(UINT8_C(1))) != static_cast<unsigned_fast_type>(UINT8_C(0)));
+
+        conditional_swap(r0, r1, bit_is_set);
+
+        r1 = mont_mul(r0, r1);
+        r0 = mont_sqr(r0);
+
+        conditional_swap(r0, r1, bit_is_set);
       }
-      while((*it++ == (std::numeric_limits<limb_type>::max)()) && (it != values.end())); // NOLINT(altera-id-dependent-backward-branch,bugprone-inc-dec-in-conditions)
+
+      return from_montgomery(r0);
     }
-  };
 
-  // Define some convenient unsigned wide integer types.
-  using uint64_t    = uintwide_t<static_cast<size_t>(UINT32_C(   64)), std::uint32_t>;
-  using  int64_t    = uintwide_t<static_cast<size_t>(UINT32_C(   64)), std::uint32_t, void, true>;
+  private:
+    using local_size_type = typename result_type::representation_type::size_type;
 
-  using uint128_t   = uintwide_t<static_cast<size_t>(UINT32_C(  128)), uint_defaultlimb_t>;
-  using uint256_t   = uintwide_t<static_cast<size_t>(UINT32_C(  256)), uint_defaultlimb_t>;
-  using uint512_t   = uintwide_t<static_cast<size_t>(UINT32_C(  512)), uint_defaultlimb_t>;
-  using uint1024_t  = uintwide_t<static_cast<size_t>(UINT32_C( 1024)), uint_defaultlimb_t>;
-  using uint2048_t  = uintwide_t<static_cast<size_t>(UINT32_C( 2048)), uint_defaultlimb_t>;
-  using uint4096_t  = uintwide_t<static_cast<size_t>(UINT32_C( 4096)), uint_defaultlimb_t>;
-  using uint8192_t  = uintwide_t<static_cast<size_t>(UINT32_C( 8192)), uint_defaultlimb_t>;
-  using uint16384_t = uintwide_t<static_cast<size_t>(UINT32_C(16384)), uint_defaultlimb_t>;
-  using uint32768_t = uintwide_t<static_cast<size_t>(UINT32_C(32768)), uint_defaultlimb_t>;
-  using uint65536_t = uintwide_t<static_cast<size_t>(UINT32_C(65536)), uint_defaultlimb_t>;
+    result_type        my_m;    // NOLINT(readability-identifier-naming)
+    unsigned_fast_type my_n;    // NOLINT(readability-identifier-naming)
+    limb_type          my_minv; // NOLINT(readability-identifier-naming)
+    result_type        my_one { }; // NOLINT(readability-identifier-naming)
+    result_type        my_r2  { }; // NOLINT(readability-identifier-naming)
 
-  using  int128_t   = uintwide_t<static_cast<size_t>(UINT32_C(  128)), uint_defaultlimb_t, void, true>;
-  using  int256_t   = uintwide_t<static_cast<size_t>(UINT32_C(  256)), uint_defaultlimb_t, void, true>;
-  using  int512_t   = uintwide_t<static_cast<size_t>(UINT32_C(  512)), uint_defaultlimb_t, void, true>;
-  using  int1024_t  = uintwide_t<static_cast<size_t>(UINT32_C( 1024)), uint_defaultlimb_t, void, true>;
-  using  int2048_t  = uintwide_t<static_cast<size_t>(UINT32_C( 2048)), uint_defaultlimb_t, void, true>;
-  using  int4096_t  = uintwide_t<static_cast<size_t>(UINT32_C( 4096)), uint_defaultlimb_t, void, true>;
-  using  int8192_t  = uintwide_t<static_cast<size_t>(UINT32_C( 8192)), uint_defaultlimb_t, void, true>;
-  using  int16384_t = uintwide_t<static_cast<size_t>(UINT32_C(16384)), uint_defaultlimb_t, void, true>;
-  using  int32768_t = uintwide_t<static_cast<size_t>(UINT32_C(32768)), uint_defaultlimb_t, void, true>;
-  using  int65536_t = uintwide_t<static_cast<size_t>(UINT32_C(65536)), uint_defaultlimb_t, void, true>;
+    static constexpr auto used_limbs(const result_type& m) -> unsigned_fast_type
+    {
+      auto n = static_cast<unsigned_fast_type>(result_type::number_of_limbs);
 
-  #if !defined(WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS)
-  static_assert(std::is_trivially_copyable<uint64_t   >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint128_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint256_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint512_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint1024_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint2048_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint4096_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint8192_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint16384_t>::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint32768_t>::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<uint65536_t>::value, "uintwide_t must be trivially copyable.");
+      while(   (n > static_cast<unsigned_fast_type>(UINT8_C(1)))
+            && (m.crepresentation()[static_cast<local_size_type>(n - static_cast<unsigned_fast_type>(UINT8_C(1)))] == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        --n;
+      }
 
-  static_assert(std::is_standard_layout<uint64_t   >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint128_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint256_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint512_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint1024_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint2048_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint4096_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint8192_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint16384_t>::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint32768_t>::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<uint65536_t>::value, "uintwide_t must have standard layout.");
-  #endif
+      return n;
+    }
 
-  #if !defined(WIDE_INTEGER_DISABLE_TRIVIAL_COPY_AND_STD_LAYOUT_CHECKS)
-  static_assert(std::is_trivially_copyable<int64_t   >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int128_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int256_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int512_t  >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int1024_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int2048_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int4096_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int8192_t >::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int16384_t>::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int32768_t>::value, "uintwide_t must be trivially copyable.");
-  static_assert(std::is_trivially_copyable<int65536_t>::value, "uintwide_t must be trivially copyable.");
+    static constexpr auto negative_inverse_of_limb(const limb_type m0) -> limb_type
+    {
+      // Find -m0^-1 mod 2^limb_bits for odd m0 with Newton iteration.
+      // The initial guess inv = m0 is correct to 3 bits, and each step
+      // doubles the number of correct bits.
 
-  static_assert(std::is_standard_layout<int64_t   >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int128_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int256_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int512_t  >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int1024_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int2048_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int4096_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int8192_t >::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int16384_t>::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int32768_t>::value, "uintwide_t must have standard layout.");
-  static_assert(std::is_standard_layout<int65536_t>::value, "uintwide_t must have standard layout.");
-  #endif
+      auto inv = m0;
 
-  // Insert a base class for numeric_limits<> support.
-  // This class inherits from std::numeric_limits<unsigned int>
-  // in order to provide limits for a non-specific unsigned type.
+      for(auto bits = static_cast<int>(INT8_C(3)); bits < std::numeric_limits<limb_type>::digits; bits *= static_cast<int>(INT8_C(2))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto m0_inv = static_cast<limb_type>(static_cast<double_limb_type>(m0) * inv);
+
+        inv = static_cast<limb_type>(static_cast<double_limb_type>(inv) * static_cast<limb_type>(static_cast<limb_type>(UINT8_C(2)) - m0_inv));
+      }
+
+      return static_cast<limb_type>(static_cast<limb_type>(UINT8_C(0)) - inv);
+    }
+
+    static constexpr auto conditional_swap(result_type& a, result_type& b, const bool condition) -> void
+    {
+      const result_type a_old { a };
+
+      a.conditional_select(b, condition);
+      b.conditional_select(a_old, condition);
+    }
+
+    constexpr auto subtract_modulus_if_needed(result_type& t, const limb_type t_n) const -> void
+    {
+      // The Montgomery product t + t_n * R is less than 2m.
+      // Subtract m once, if needed, to bring it below m.
+      // Both the difference and the choice are computed without
+      // branching on the value of t, so that the Montgomery
+      // multiplication runs in constant time (see powm_ct).
+
+      const auto t_n_is_in_t = (my_n < static_cast<unsigned_fast_type>(result_type::number_of_limbs));
+
+      if(t_n_is_in_t)
+      {
+        t.representation()[static_cast<local_size_type>(my_n)] = t_n;
+      }
+
+      result_type t_minus_m { t };
+
+      const auto borrow = t_minus_m.conditional_subtract(my_m, true);
+
+      // The sum is at least m if the subtraction did not borrow, or if
+      // the top limb t_n lies above all limbs of t and is nonzero.
+      const auto sum_is_ge_m =
+        static_cast<limb_type>
+        (
+            static_cast<limb_type>(borrow ^ static_cast<limb_type>(UINT8_C(1)))
+          | (t_n_is_in_t ? static_cast<limb_type>(UINT8_C(0)) : t_n)
+        );
+
+      t.conditional_select(t_minus_m, (sum_is_ge_m != static_cast<limb_type>(UINT8_C(0))));
+    }
+  };
 
   template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
            const bool IsSigned>
-  WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits_uintwide_t_base
-    : public std::numeric_limits<std::conditional_t<(!IsSigned), unsigned int, signed int>>
+  class barrett_reducer
   {
+  public:
+    using result_type       = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using double_width_type = typename result_type::double_width_type;
+    using limb_type         = typename result_type::limb_type;
+    using double_limb_type  = typename result_type::double_limb_type;
+
+    // Set up the Barrett reduction for the positive modulus m.
+    // Here, b = 2^limb_bits and k is the number of limbs that are
+    // actually used in m. This precomputes mu = (b^(2k) - 1) / m
+    // once, which has at most k + 1 limbs. (The usual choice
+    // b^(2k) / m would need k + 2 limbs for m = b^(k - 1).)
+    explicit constexpr barrett_reducer(const result_type& m) // NOLINT(modernize-pass-by-value)
+      : my_m(m),
+        my_k(used_limbs(m))
+    {
+      using local_double_width_unsigned_type =
+        uintwide_t<static_cast<size_t>(Width2 * static_cast<size_t>(UINT8_C(2))), limb_type, AllocatorType, false>;
+
+      const auto shift =
+        static_cast<unsigned_fast_type>
+        (
+            static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits)
+          * static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(result_type::number_of_limbs) - my_k)
+          * static_cast<unsigned_fast_type>(UINT8_C(2))
+        );
+
+      const local_double_width_unsigned_type b_pow_2k_minus_one { (std::numeric_limits<local_double_width_unsigned_type>::max)() >> shift };
+
+      my_mu = double_width_type(b_pow_2k_minus_one / local_double_width_unsigned_type(m));
+    }
+
+    constexpr barrett_reducer() = delete;
+
+    constexpr barrett_reducer(const barrett_reducer&) = default;
+    constexpr barrett_reducer(barrett_reducer&&) noexcept = default;
+
+    ~barrett_reducer() = default;
+
+    constexpr auto operator=(const barrett_reducer&) -> barrett_reducer& = default;
+    constexpr auto operator=(barrett_reducer&&) noexcept -> barrett_reducer& = default;
+
+    WIDE_INTEGER_NODISCARD constexpr auto modulus() const -> const result_type&       { return my_m; }
+    WIDE_INTEGER_NODISCARD constexpr auto mu     () const -> const double_width_type& { return my_mu; }
+
+    WIDE_INTEGER_NODISCARD constexpr auto reduce(const double_width_type& x) const -> result_type
+    {
+      // Calculate x % m for 0 <= x (HAC, Algorithm 14.42). The quotient
+      // is estimated as q = ((x / b^(k - 1)) * mu) / b^(k + 1), which is
+      // at most a few below x / m. Only the columns of the product that
+      // reach the upper k + 1 limbs are formed. Then r = x - q * m is found
+      // modulo b^(k + 1), and m is subtracted until r < m. Values x having
+      // more than 2k limbs use the division instead.
+
+      const auto& xv = x.crepresentation();
+
+      const auto k  = static_cast<local_double_size_type>(my_k);
+      const auto k1 = static_cast<local_double_size_type>(k + static_cast<local_double_size_type>(UINT8_C(1)));
+
+      auto x_fits = true;
+
+      for(auto i = static_cast<local_double_size_type>(k * static_cast<local_double_size_type>(UINT8_C(2))); (x_fits && (i < static_cast<local_double_size_type>(xv.size()))); ++i)
+      {
+        x_fits = (xv[i] == static_cast<limb_type>(UINT8_C(0)));
+      }
+
+      if(!x_fits)
+      {
+        return result_type(x % double_width_type(my_m));
+      }
+
+      const auto& muv = my_mu.crepresentation();
+      const auto& mv  = my_m.crepresentation();
+
+      // The upper part of the product (x / b^(k - 1)) * mu, being stored
+      // from column k - 1 upward. The quotient starts at column k + 1.
+      scratch_array_type<static_cast<size_t>(result_type::number_of_limbs + static_cast<size_t>(UINT8_C(3)))> t { };
+
+      for(auto i = static_cast<local_double_size_type>(UINT8_C(0)); i < k1; ++i)
+      {
+        const auto qi = xv[static_cast<local_double_size_type>(static_cast<local_double_size_type>(k + i) - static_cast<local_double_size_type>(UINT8_C(1)))];
+
+        const auto j0 = static_cast<local_double_size_type>((static_cast<local_double_size_type>(i + static_cast<local_double_size_type>(UINT8_C(1))) < k) ? static_cast<local_double_size_type>(static_cast<local_double_size_type>(k - i) - static_cast<local_double_size_type>(UINT8_C(1))) : static_cast<local_double_size_type>(UINT8_C(0)));
+
+        auto carry = static_cast<limb_type>(UINT8_C(0));
+
+        for(auto j = j0; j < k1; ++j)
+        {
+          const auto col = static_cast<local_double_size_type>(static_cast<local_double_size_type>(static_cast<local_double_size_type>(i + j) + static_cast<local_double_size_type>(UINT8_C(1))) - k);
+
+          const auto uv =
+            static_cast<double_limb_type>
+            (
+                static_cast<double_limb_type>(t[col])
+              + static_cast<double_limb_type>(static_cast<double_limb_type>(muv[j]) * qi)
+              + carry
+            );
+
+          t[col] = static_cast<limb_type>(uv);
+          carry  = detail::make_hi<limb_type>(uv);
+        }
+
+        t[static_cast<local_double_size_type>(i + static_cast<local_double_size_type>(UINT8_C(2)))] = carry;
+      }
+
+      // The lower k + 1 limbs of q * m, with q in t[2], ..., t[k + 2].
+      scratch_array_type<static_cast<size_t>(result_type::number_of_limbs + static_cast<size_t>(UINT8_C(1)))> r { };
+
+      for(auto i = static_cast<local_double_size_type>(UINT8_C(0)); i < k1; ++i)
+      {
+        const auto qi = t[static_cast<local_double_size_type>(i + static_cast<local_double_size_type>(UINT8_C(2)))];
+
+        auto carry = static_cast<limb_type>(UINT8_C(0));
+
+        for(auto j = static_cast<local_double_size_type>(UINT8_C(0)); ((j < k) && (static_cast<local_double_size_type>(i + j) < k1)); ++j)
+        {
+          const auto uv =
+            static_cast<double_limb_type>
+            (
+                static_cast<double_limb_type>(r[static_cast<local_double_size_type>(i + j)])
+              + static_cast<double_limb_type>(static_cast<double_limb_type>(mv[static_cast<local_size_type>(j)]) * qi)
+              + carry
+            );
+
+          r[static_cast<local_double_size_type>(i + j)] = static_cast<limb_type>(uv);
+
+          carry = detail::make_hi<limb_type>(uv);
+        }
+
+        if(i == static_cast<local_double_size_type>(UINT8_C(0)))
+        {
+          r[k] = carry;
+        }
+      }
+
+      // Form r = x - q * m modulo b^(k + 1).
+      auto borrow = static_cast<limb_type>(UINT8_C(0));
+
+      for(auto i = static_cast<local_double_size_type>(UINT8_C(0)); i < k1; ++i)
+      {
+        const auto uv =
+          static_cast<double_limb_type>
+          (
+              static_cast<double_limb_type>(xv[i])
+            - static_cast<double_limb_type>(r[i])
+            - borrow
+          );
+
+        r[i]   = static_cast<limb_type>(uv);
+        borrow = static_cast<limb_type>((detail::make_hi<limb_type>(uv) != static_cast<limb_type>(UINT8_C(0))) ? static_cast<limb_type>(UINT8_C(1)) : static_cast<limb_type>(UINT8_C(0)));
+      }
+
+      while(!is_less_than_modulus(r.cbegin())) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        subtract_modulus(r.begin());
+      }
+
+      result_type result { };
+
+      detail::copy_unsafe(r.cbegin(),
+                          r.cbegin() + static_cast<std::ptrdiff_t>(k), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                          result.representation().begin());
+
+      return result;
+    }
+
+    WIDE_INTEGER_NODISCARD constexpr auto mul_mod(const result_type& a, const result_type& b) const -> result_type
+    {
+      // Calculate (a * b) % m for 0 <= a, b < m.
+      return reduce(mul_wide(a, b));
+    }
+
+    WIDE_INTEGER_NODISCARD constexpr auto sqr_mod(const result_type& a) const -> result_type
+    {
+      // Calculate (a * a) % m for 0 <= a < m.
+      return reduce(mul_wide(a, a));
+    }
+
+    template<typename OtherIntegralTypeP>
+    WIDE_INTEGER_NODISCARD constexpr auto powm(const result_type&       b,
+                                               const OtherIntegralTypeP& p,
+                                               const std::uint_fast8_t   window_bits = static_cast<std::uint_fast8_t>(UINT8_C(0))) const -> result_type
+    {
+      // Calculate (b ^ p) % m for 0 <= b, with any positive modulus,
+      // without any division in the loop over the bits of the exponent.
+      // A window_bits of zero selects the window width automatically.
+
+      const detail::pow_policy_barrett<barrett_reducer> policy { *this };
+
+      const result_type one { static_cast<std::uint8_t>(UINT8_C(1)) };
+
+      return detail::pow_sliding_window((one < my_m) ? one : result_type { }, (b < my_m) ? b : (b % my_m), p, window_bits, policy);
+    }
+
+    template<const unsigned_fast_type ExponentBits,
+             const unsigned_fast_type WindowBits = static_cast<unsigned_fast_type>(UINT8_C(4))>
+    WIDE_INTEGER_NODISCARD constexpr auto make_fixed_base_table(const result_type& g) const -> fixed_base_table<result_type, ExponentBits, WindowBits>
+    {
+      // Tabulate the powers of the fixed base g for repeated use in powm(table, p).
+
+      const detail::pow_policy_barrett<barrett_reducer> policy { *this };
+
+      const result_type one { static_cast<std::uint8_t>(UINT8_C(1)) };
+
+      return fixed_base_table<result_type, ExponentBits, WindowBits>((g < my_m) ? g : (g % my_m), (one < my_m) ? one : result_type { }, policy);
+    }
+
+    template<typename OtherIntegralTypeP,
+             const unsigned_fast_type ExponentBits,
+             const unsigned_fast_type WindowBits>
+    WIDE_INTEGER_NODISCARD constexpr auto powm(const fixed_base_table<result_type, ExponentBits, WindowBits>& table,
+                                               const OtherIntegralTypeP& p) const -> result_type
+    {
+      // Calculate (g ^ p) % m for the fixed base g of the table.
+
+      const detail::pow_policy_barrett<barrett_reducer> policy { *this };
+
+      return table.pow(p, policy);
+    }
+
   private:
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_size_type        = typename result_type::representation_type::size_type;
+    using local_double_size_type = typename double_width_type::representation_type::size_type;
 
-  public:
-    static constexpr int digits          = (!IsSigned)
-                                             ? static_cast<int>(local_wide_integer_type::my_width2)
-                                             : static_cast<int>(local_wide_integer_type::my_width2 - static_cast<size_t>(UINT8_C(1)));
+    template<const size_t ArraySize>
+    using scratch_array_type = typename result_type::template scratch_array_type<limb_type, ArraySize>;
 
-    static constexpr int digits10        = static_cast<int>((static_cast<std::uintmax_t>(digits)       * UINTMAX_C(75257499)) / UINTMAX_C(250000000));
-    static constexpr int max_digits10    = digits10;
-    static constexpr int max_exponent    = digits;
-    static constexpr int max_exponent10  = static_cast<int>((static_cast<std::uintmax_t>(max_exponent) * UINTMAX_C(75257499)) / UINTMAX_C(250000000));
+    result_type        my_m;        // NOLINT(readability-identifier-naming)
+    unsigned_fast_type my_k;        // NOLINT(readability-identifier-naming)
+    double_width_type  my_mu { };   // NOLINT(readability-identifier-naming)
 
-    static constexpr auto (max) () -> local_wide_integer_type { return local_wide_integer_type::template limits_helper_max<IsSigned>(); }
-    static constexpr auto (min) () -> local_wide_integer_type { return local_wide_integer_type::template limits_helper_min<IsSigned>(); }
-    static constexpr auto lowest() -> local_wide_integer_type { return (min)(); }
+    static constexpr auto used_limbs(const result_type& m) -> unsigned_fast_type
+    {
+      auto n = static_cast<unsigned_fast_type>(result_type::number_of_limbs);
+
+      while(   (n > static_cast<unsigned_fast_type>(UINT8_C(1)))
+            && (m.crepresentation()[static_cast<local_size_type>(n - static_cast<unsigned_fast_type>(UINT8_C(1)))] == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        --n;
+      }
+
+      return n;
+    }
+
+    template<typename InputIteratorType>
+    constexpr auto is_less_than_modulus(InputIteratorType r) const -> bool
+    {
+      // Compare the k + 1 limbs of r with the k limbs of m.
+      if(*(r + static_cast<std::ptrdiff_t>(my_k)) != static_cast<limb_type>(UINT8_C(0))) // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      {
+        return false;
+      }
+
+      for(auto i = static_cast<signed_fast_type>(my_k - static_cast<unsigned_fast_type>(UINT8_C(1))); i >= static_cast<signed_fast_type>(INT8_C(0)); --i) // NOLINT(altera-id-dependent-backward-branch)
+      {
+        const auto ri = *(r + static_cast<std::ptrdiff_t>(i)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        const auto mi = my_m.crepresentation()[static_cast<local_size_type>(i)];
+
+        if(ri != mi)
+        {
+          return (ri < mi);
+        }
+      }
+
+      return false;
+    }
+
+    template<typename ForwardIteratorType>
+    constexpr auto subtract_modulus(ForwardIteratorType r) const -> void
+    {
+      // Subtract m from the k + 1 limbs of r, where r >= m.
+      auto borrow = static_cast<limb_type>(UINT8_C(0));
+
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i <= my_k; ++i)
+      {
+        const auto mi = ((i < my_k) ? my_m.crepresentation()[static_cast<local_size_type>(i)] : static_cast<limb_type>(UINT8_C(0)));
+
+        auto& ri = *(r + static_cast<std::ptrdiff_t>(i)); // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+
+        const auto uv =
+          static_cast<double_limb_type>
+          (
+              static_cast<double_limb_type>(ri)
+            - static_cast<double_limb_type>(mi)
+            - borrow
+          );
+
+        ri     = static_cast<limb_type>(uv);
+        borrow = static_cast<limb_type>((detail::make_hi<limb_type>(uv) != static_cast<limb_type>(UINT8_C(0))) ? static_cast<limb_type>(UINT8_C(1)) : static_cast<limb_type>(UINT8_C(0)));
+      }
+    }
   };
 
-  template<class T>
-  struct is_integral : public std::is_integral<T> { };
-
   template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
            const bool IsSigned>
-  struct is_integral<math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
-    : public std::integral_constant<bool, true> { };
+  class special_modulus
+  {
+  public:
+    using result_type       = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using double_width_type = typename result_type::double_width_type;
+    using limb_type         = typename result_type::limb_type;
+    using double_limb_type  = typename result_type::double_limb_type;
+
+    // Set up the reduction for the positive modulus m = 2^k - c,
+    // where 2^(k - 1) <= m < 2^k. The shape of m is detected here.
+    // Pseudo-Mersenne and many Solinas primes, such as 2^255 - 19,
+    // 2^256 - 2^32 - 977 (secp256k1), P-192, P-224, P-384 and
+    // 2^521 - 1 (P-521), have an offset c of at most k / 2 bits.
+    // For these, is_special() is true and x mod m is found
+    // by folding x = h * 2^k + l into l + h * c, needing only
+    // shifts, additions and the short products h * c.
+    explicit constexpr special_modulus(const result_type& m) // NOLINT(modernize-pass-by-value)
+      : my_m(m),
+        my_n(used_limbs(m)),
+        my_k(static_cast<unsigned_fast_type>(msb(m) + static_cast<unsigned_fast_type>(UINT8_C(1)))),
+        my_c(make_offset(m, my_k)),
+        my_c_limbs(used_limbs(my_c)),
+        my_is_special
+        (
+             (my_k > static_cast<unsigned_fast_type>(UINT8_C(1)))
+          && (static_cast<unsigned_fast_type>(msb(my_c) + static_cast<unsigned_fast_type>(UINT8_C(1))) <= static_cast<unsigned_fast_type>(my_k / static_cast<unsigned_fast_type>(UINT8_C(2))))
+        ) { }
 
-  #if(__cplusplus >= 201703L)
-  } // namespace math::wide_integer
-  #else
-  } // namespace wide_integer
-  } // namespace math
-  #endif
+    constexpr special_modulus() = delete;
 
-  WIDE_INTEGER_NAMESPACE_END
+    constexpr special_modulus(const special_modulus&) = default;
+    constexpr special_modulus(special_modulus&&) noexcept = default;
 
-  namespace std
-  {
-    // Specialization of std::numeric_limits<uintwide_t>.
-    #if defined(WIDE_INTEGER_NAMESPACE)
-    template<const WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t Width2,
-             typename LimbType,
-             typename AllocatorType,
-             const bool IsSigned>
-    WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits<WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
-      : public WIDE_INTEGER_NAMESPACE::math::wide_integer::numeric_limits_uintwide_t_base<Width2, LimbType, AllocatorType, IsSigned> { };
-    #else
-    template<const ::math::wide_integer::size_t Width2,
-             typename LimbType,
-             typename AllocatorType,
-             const bool IsSigned>
-    WIDE_INTEGER_NUM_LIMITS_CLASS_TYPE numeric_limits<::math::wide_integer::uintwide_t<Width2, LimbType, AllocatorType, IsSigned>> // NOLINT(cert-dcl58-cpp)
-      : public ::math::wide_integer::numeric_limits_uintwide_t_base<Width2, LimbType, AllocatorType, IsSigned> { };
-    #endif
-  } // namespace std
+    ~special_modulus() = default;
 
-  WIDE_INTEGER_NAMESPACE_BEGIN
+    constexpr auto operator=(const special_modulus&) -> special_modulus& = default;
+    constexpr auto operator=(special_modulus&&) noexcept -> special_modulus& = default;
 
-  #if(__cplusplus >= 201703L)
-  namespace math::wide_integer {
-  #else
-  namespace math { namespace wide_integer { // NOLINT(modernize-concat-nested-namespaces)
-  #endif
+    WIDE_INTEGER_NODISCARD constexpr auto modulus   () const -> const result_type& { return my_m; }
+    WIDE_INTEGER_NODISCARD constexpr auto exponent  () const -> unsigned_fast_type { return my_k; }
+    WIDE_INTEGER_NODISCARD constexpr auto offset    () const -> const result_type& { return my_c; }
+    WIDE_INTEGER_NODISCARD constexpr auto is_special() const -> bool               { return my_is_special; }
 
-  #if !defined(WIDE_INTEGER_DISABLE_IOSTREAM)
+    WIDE_INTEGER_NODISCARD constexpr auto reduce(const double_width_type& x) const -> result_type
+    {
+      // Calculate x % m for 0 <= x. Each fold replaces the bits of x
+      // above 2^k by their product with c, which shortens x by about
+      // k / 2 bits or more. A few folds bring x below 2^k < 2m, after which
+      // one subtraction of m at most remains. Moduli that do not have
+      // the special shape use the division instead.
 
-  // I/O streaming functions.
-  template<typename char_type,
-           typename traits_type,
-           const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  auto operator<<(std::basic_ostream<char_type, traits_type>& out,
-                  const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::basic_ostream<char_type, traits_type>&
-  {
-    std::basic_ostringstream<char_type, traits_type> ostr;
+      if(!my_is_special)
+      {
+        return result_type(x % double_width_type(my_m));
+      }
 
-    const std::ios::fmtflags my_flags = out.flags();
+      scratch_type t { };
 
-    const auto show_pos     = ((my_flags & std::ios::showpos)   == std::ios::showpos);
-    const auto show_base    = ((my_flags & std::ios::showbase)  == std::ios::showbase);
-    const auto is_uppercase = ((my_flags & std::ios::uppercase) == std::ios::uppercase);
+      detail::copy_unsafe(x.crepresentation().cbegin(), x.crepresentation().cend(), t.begin());
 
-    std::uint_fast8_t base_rep { };
+      return fold(t, static_cast<local_double_size_type>(double_width_type::number_of_limbs));
+    }
 
-    if     ((my_flags & std::ios::oct) == std::ios::oct) { base_rep = static_cast<std::uint_fast8_t>(UINT8_C( 8)); }
-    else if((my_flags & std::ios::hex) == std::ios::hex) { base_rep = static_cast<std::uint_fast8_t>(UINT8_C(16)); }
-    else                                                 { base_rep = static_cast<std::uint_fast8_t>(UINT8_C(10)); }
+    WIDE_INTEGER_NODISCARD constexpr auto mul_mod(const result_type& a, const result_type& b) const -> result_type
+    {
+      // Calculate (a * b) % m for 0 <= a, b < m. The product of the
+      // limbs that are used in m is formed right in the scratch of
+      // the folding.
 
-    const auto field_width   = static_cast<unsigned_fast_type>(out.width());
-    const auto fill_char_out = static_cast<char>(out.fill());
+      if(!my_is_special)
+      {
+        return reduce(mul_wide(a, b));
+      }
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+      scratch_type t { };
 
-    if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(8)))
-    {
-      using string_storage_oct_type =
-        std::conditional_t
-          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
-            detail::fixed_static_array <char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_oct()>,
-            detail::fixed_dynamic_array<char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_oct(),
-                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
-                                                                                         std::allocator<void>,
-                                                                                         AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
+      const auto& av = a.crepresentation();
+      const auto& bv = b.crepresentation();
 
-      // TBD: There is redundant storage of this kind both here
-      // in this subroutine as well as in the wr_string method.
-      string_storage_oct_type str_result { }; // LCOV_EXCL_LINE
+      const auto n = used_limbs_clamped();
 
-      str_result.fill('\0');
+      for(auto i = static_cast<local_size_type>(UINT8_C(0)); i < n; ++i)
+      {
+        const auto ai = av[i];
 
-      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+        auto carry = static_cast<limb_type>(UINT8_C(0));
 
-      static_cast<void>(ostr << str_result.data());
-    }
-    else if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(10)))
-    {
-      using string_storage_dec_type =
-        std::conditional_t
-          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
-            detail::fixed_static_array <char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_dec()>,
-            detail::fixed_dynamic_array<char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_dec(),
-                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
-                                                                                          std::allocator<void>,
-                                                                                          AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
+        for(auto j = static_cast<local_size_type>(UINT8_C(0)); j < n; ++j)
+        {
+          auto& tij = t[static_cast<local_double_size_type>(i + j)];
 
-      // TBD: There is redundant storage of this kind both here
-      // in this subroutine as well as in the wr_string method.
-      string_storage_dec_type str_result { };
+          const auto uv =
+            static_cast<double_limb_type>
+            (
+                static_cast<double_limb_type>(tij)
+              + static_cast<double_limb_type>(static_cast<double_limb_type>(ai) * bv[j])
+              + carry
+            );
 
-      str_result.fill('\0');
+          tij   = static_cast<limb_type>(uv);
+          carry = detail::make_hi<limb_type>(uv);
+        }
 
-      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+        t[static_cast<local_double_size_type>(i + n)] = carry;
+      }
 
-      static_cast<void>(ostr << str_result.data());
+      return fold(t, static_cast<local_double_size_type>(static_cast<local_double_size_type>(n) * static_cast<local_double_size_type>(UINT8_C(2))));
     }
-    else if(base_rep == static_cast<std::uint_fast8_t>(UINT8_C(16)))
+
+    WIDE_INTEGER_NODISCARD constexpr auto sqr_mod(const result_type& a) const -> result_type
     {
-      using string_storage_hex_type =
-        std::conditional_t
-          <local_wide_integer_type::my_width2 <= static_cast<size_t>(UINT32_C(2048)),
-            detail::fixed_static_array <char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_hex()>,
-            detail::fixed_dynamic_array<char,
-                                        local_wide_integer_type::wr_string_max_buffer_size_hex(),
-                                        typename std::allocator_traits<std::conditional_t<std::is_same<AllocatorType, void>::value,
-                                                                                         std::allocator<void>,
-                                                                                         AllocatorType>>::template rebind_alloc<typename local_wide_integer_type::limb_type>>>;
+      // Calculate (a * a) % m for 0 <= a < m. The cross products
+      // a_i * a_j with i < j are formed once and doubled, after which
+      // the squares a_i^2 are added on the diagonal.
 
-      // TBD: There is redundant storage of this kind both here
-      // in this subroutine as well as in the wr_string method.
-      string_storage_hex_type str_result { };
+      if(!my_is_special)
+      {
+        return reduce(mul_wide(a, a));
+      }
 
-      str_result.fill('\0');
+      scratch_type t { };
 
-      x.wr_string(str_result.begin(), base_rep, show_base, show_pos, is_uppercase, field_width, fill_char_out);
+      const auto& av = a.crepresentation();
 
-      static_cast<void>(ostr << str_result.data());
-    }
+      const auto n  = static_cast<local_double_size_type>(used_limbs_clamped());
+      const auto n2 = static_cast<local_double_size_type>(n * static_cast<local_double_size_type>(UINT8_C(2)));
 
-    return (out << ostr.str());
-  }
+      for(auto i = static_cast<local_double_size_type>(UINT8_C(0)); i < n; ++i)
+      {
+        const auto ai = av[static_cast<local_size_type>(i)];
 
-  template<typename char_type,
-           typename traits_type,
-           const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  auto operator>>(std::basic_istream<char_type, traits_type>& in,
-                  uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::basic_istream<char_type, traits_type>&
-  {
-    std::string str_in { };
+        auto carry = static_cast<limb_type>(UINT8_C(0));
 
-    in >> str_in;
+        for(auto j = static_cast<local_double_size_type>(i + static_cast<local_double_size_type>(UINT8_C(1))); j < n; ++j)
+        {
+          auto& tij = t[static_cast<local_double_size_type>(i + j)];
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+          const auto uv =
+            static_cast<double_limb_type>
+            (
+                static_cast<double_limb_type>(tij)
+              + static_cast<double_limb_type>(static_cast<double_limb_type>(ai) * av[static_cast<local_size_type>(j)])
+              + carry
+            );
 
-    x = local_wide_integer_type(str_in.c_str());
+          tij   = static_cast<limb_type>(uv);
+          carry = detail::make_hi<limb_type>(uv);
+        }
 
-    return in;
-  }
+        t[static_cast<local_double_size_type>(i + n)] = carry;
+      }
 
-  #endif // !defined(WIDE_INTEGER_DISABLE_IOSTREAM)
+      auto top = static_cast<limb_type>(UINT8_C(0));
+      auto carry = static_cast<limb_type>(UINT8_C(0));
 
-  #if(__cplusplus >= 201703L)
-  } // namespace math::wide_integer
-  #else
-  } // namespace wide_integer
-  } // namespace math
-  #endif
+      for(auto i = static_cast<local_double_size_type>(UINT8_C(0)); i < n2; ++i)
+      {
+        const auto ti = t[i];
 
-  // Implement various number-theoretical tools.
+        t[i] = static_cast<limb_type>(static_cast<limb_type>(ti << 1U) | top);
+        top  = static_cast<limb_type>(ti >> static_cast<unsigned>(std::numeric_limits<limb_type>::digits - 1));
+      }
 
-  #if(__cplusplus >= 201703L)
-  namespace math::wide_integer {
-  #else
-  namespace math { namespace wide_integer { // NOLINT(modernize-concat-nested-namespaces)
-  #endif
+      for(auto i = static_cast<local_double_size_type>(UINT8_C(0)); i < n; ++i)
+      {
+        const auto ai = av[static_cast<local_size_type>(i)];
 
-  namespace detail {
+        const auto i2 = static_cast<local_double_size_type>(i * static_cast<local_double_size_type>(UINT8_C(2)));
 
-  #if !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
-  namespace my_own {
+        const auto sq = static_cast<double_limb_type>(static_cast<double_limb_type>(ai) * ai);
 
-  template<typename FloatingPointType> constexpr auto frexp(FloatingPointType x, int* expptr) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value &&   std::numeric_limits<FloatingPointType>::is_iec559 ), FloatingPointType>
-  {
-    using local_floating_point_type = FloatingPointType;
+        auto uv = static_cast<double_limb_type>(static_cast<double_limb_type>(t[i2]) + static_cast<limb_type>(sq) + carry);
 
-    const bool x_is_neg { (x < static_cast<local_floating_point_type>(0.0L)) };
+        t[i2] = static_cast<limb_type>(uv);
 
-    local_floating_point_type f = (x_is_neg ? -x : x); // NOLINT(altera-id-dependent-backward-branch)
+        uv =
+          static_cast<double_limb_type>
+          (
+              static_cast<double_limb_type>(t[static_cast<local_double_size_type>(i2 + static_cast<local_double_size_type>(UINT8_C(1)))])
+            + detail::make_hi<limb_type>(sq)
+            + detail::make_hi<limb_type>(uv)
+          );
 
-    int e2 { static_cast<int>(INT8_C(0)) };
+        t[static_cast<local_double_size_type>(i2 + static_cast<local_double_size_type>(UINT8_C(1)))] = static_cast<limb_type>(uv);
 
-    constexpr auto two_pow32 =
-      static_cast<long double>
-      (
-        static_cast<long double>(0x10000) * static_cast<long double>(0x10000)
-      );
+        carry = detail::make_hi<limb_type>(uv);
+      }
 
-    while(f >= static_cast<local_floating_point_type>(two_pow32)) // NOLINT(altera-id-dependent-backward-branch)
+      return fold(t, n2);
+    }
+
+    template<typename OtherIntegralTypeP>
+    WIDE_INTEGER_NODISCARD constexpr auto powm(const result_type&       b,
+                                               const OtherIntegralTypeP& p,
+                                               const std::uint_fast8_t   window_bits = static_cast<std::uint_fast8_t>(UINT8_C(0))) const -> result_type
     {
-      // TBD: Maybe optimize this exponent reduction
-      // with a more clever kind of binary searching.
+      // Calculate (b ^ p) % m for 0 <= b. For the special moduli,
+      // there is no division in the loop over the bits of the exponent.
+      // The policy of the Barrett reduction fits, since it only
+      // needs mul_mod(), sqr_mod() and modulus().
 
-      f   = static_cast<local_floating_point_type>(f / static_cast<local_floating_point_type>(two_pow32));
-      e2 += static_cast<int>(INT32_C(32));
+      const detail::pow_policy_barrett<special_modulus> policy { *this };
+
+      const result_type one { static_cast<std::uint8_t>(UINT8_C(1)) };
+
+      return detail::pow_sliding_window((one < my_m) ? one : result_type { }, (b < my_m) ? b : (b % my_m), p, window_bits, policy);
     }
 
-    constexpr auto one_ldbl = static_cast<long double>(1.0L);
+  private:
+    using local_size_type        = typename result_type::representation_type::size_type;
+    using local_double_size_type = typename double_width_type::representation_type::size_type;
 
-    while(f >= static_cast<local_floating_point_type>(one_ldbl)) // NOLINT(altera-id-dependent-backward-branch)
+    // The scratch of the folding has one zero limb above the double width.
+    using scratch_type = typename result_type::template scratch_array_type<limb_type, static_cast<size_t>(double_width_type::number_of_limbs + static_cast<size_t>(UINT8_C(1)))>;
+
+    result_type        my_m;            // NOLINT(readability-identifier-naming)
+    unsigned_fast_type my_n;            // NOLINT(readability-identifier-naming)
+    unsigned_fast_type my_k;            // NOLINT(readability-identifier-naming)
+    result_type        my_c;            // NOLINT(readability-identifier-naming)
+    unsigned_fast_type my_c_limbs;      // NOLINT(readability-identifier-naming)
+    bool               my_is_special;   // NOLINT(readability-identifier-naming)
+
+    constexpr auto fold(scratch_type& t, local_double_size_type t_used) const -> result_type
     {
-      constexpr auto two_ldbl = static_cast<long double>(2.0L);
+      // Reduce the double-width value in t by repeated folding. Only the
+      // lowest t_used limbs of t can be nonzero. This bound shrinks with
+      // each fold.
 
-      f = static_cast<local_floating_point_type>(f / static_cast<local_floating_point_type>(two_ldbl));
+      constexpr auto limb_bits = static_cast<unsigned_fast_type>(std::numeric_limits<limb_type>::digits);
 
-      ++e2;
-    }
+      constexpr auto t_size = static_cast<local_double_size_type>(double_width_type::number_of_limbs);
 
-    if(expptr != nullptr)
-    {
-      *expptr = e2;
-    }
+      const auto k_limb = static_cast<local_double_size_type>(my_k / limb_bits);
+      const auto k_bits = static_cast<local_double_size_type>(my_k % limb_bits);
 
-    return ((!x_is_neg) ? f : -f);
-  }
+      // The bound is clamped to the double width, which is the size
+      // of the scratch below its extra zero limb.
+      t_used = (std::min)(t_used, t_size);
 
-  template<typename FloatingPointType> constexpr auto frexp(FloatingPointType x, int* expptr) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value && (!std::numeric_limits<FloatingPointType>::is_iec559)), FloatingPointType>
-  {
-    using std::frexp;
+      scratch_type h { };
 
-    return frexp(x, expptr);
-  }
+      const auto& cv = my_c.crepresentation();
 
-  template<typename FloatingPointType> constexpr auto (isfinite)(FloatingPointType x) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value &&   std::numeric_limits<FloatingPointType>::is_iec559 ), bool>
-  {
-    using local_floating_point_type = FloatingPointType;
+      for(;;)
+      {
+        // Split t into the high part h = t / 2^k and the low part t mod 2^k.
+        auto h_limbs = static_cast<local_double_size_type>(UINT8_C(0));
 
-    bool x_is_finite { true };
+        for(auto i = k_limb; i < t_used; ++i)
+        {
+          const auto j = static_cast<local_double_size_type>(i - k_limb);
 
-    const auto x_is_nan = (x != x);
+          // The upper neighbor is shifted in two steps, such that
+          // no shift reaches the full width of the limb for k_bits = 0.
+          const auto hj =
+            static_cast<limb_type>
+            (
+                static_cast<limb_type>(t[i] >> k_bits)
+              | static_cast<limb_type>(static_cast<limb_type>(t[static_cast<local_double_size_type>(i + static_cast<local_double_size_type>(UINT8_C(1)))] << 1U) << static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(limb_bits - static_cast<unsigned_fast_type>(UINT8_C(1))) - k_bits))
+            );
 
-    if(x_is_nan)
-    {
-      x_is_finite = false;
-    }
-    else
-    {
-      const auto x_is_inf_pos = (x > (std::numeric_limits<local_floating_point_type>::max)());
-      const auto x_is_inf_neg = (x <  std::numeric_limits<local_floating_point_type>::lowest());
+          h[j] = hj;
 
-      if(x_is_inf_pos || x_is_inf_neg)
-      {
-        x_is_finite = false;
-      }
-    }
+          if(hj != static_cast<limb_type>(UINT8_C(0)))
+          {
+            h_limbs = static_cast<local_double_size_type>(j + static_cast<local_double_size_type>(UINT8_C(1)));
+          }
+        }
+
+        if(h_limbs == static_cast<local_double_size_type>(UINT8_C(0)))
+        {
+          break;
+        }
+
+        t[k_limb] = static_cast<limb_type>(t[k_limb] & static_cast<limb_type>(static_cast<limb_type>(static_cast<limb_type>(UINT8_C(1)) << k_bits) - static_cast<limb_type>(UINT8_C(1))));
+
+        for(auto i = static_cast<local_double_size_type>(k_limb + static_cast<local_double_size_type>(UINT8_C(1))); i < t_used; ++i)
+        {
+          t[i] = static_cast<limb_type>(UINT8_C(0));
+        }
 
-    return x_is_finite;
-  }
+        // The sum of (t mod 2^k) and h * c has at most one more limb
+        // than the larger of the two.
+        t_used = (std::min)(t_size, static_cast<local_double_size_type>((std::max)(static_cast<local_double_size_type>(k_limb + static_cast<local_double_size_type>(UINT8_C(1))), static_cast<local_double_size_type>(h_limbs + static_cast<local_double_size_type>(my_c_limbs))) + static_cast<local_double_size_type>(UINT8_C(1))));
 
-  template<typename FloatingPointType> constexpr auto (isfinite)(FloatingPointType x) -> std::enable_if_t<(std::is_floating_point<FloatingPointType>::value && (!std::numeric_limits<FloatingPointType>::is_iec559)), bool>
-  {
-    using std::isfinite;
+        // Add h * c to the low part, one limb of c at a time.
+        for(auto j = static_cast<local_double_size_type>(UINT8_C(0)); j < static_cast<local_double_size_type>(my_c_limbs); ++j)
+        {
+          const auto cj = cv[static_cast<local_size_type>(j)];
 
-    return (isfinite)(x);
-  }
-  } // namespace my_own
-  #endif // !defined(WIDE_INTEGER_DISABLE_FLOAT_INTEROP)
+          auto carry = static_cast<limb_type>(UINT8_C(0));
 
-  template<typename UnsignedIntegralType>
-  constexpr auto lsb_helper(const UnsignedIntegralType& u) -> unsigned_fast_type
-  {
-    // Compile-time checks.
-    static_assert((   std::is_integral<UnsignedIntegralType>::value
-                   && std::is_unsigned<UnsignedIntegralType>::value),
-                   "Error: Please check the characteristics of UnsignedIntegralType");
+          for(auto i = static_cast<local_double_size_type>(UINT8_C(0)); i < h_limbs; ++i)
+          {
+            auto& tij = t[static_cast<local_double_size_type>(i + j)];
 
-    auto result = static_cast<unsigned_fast_type>(UINT8_C(0));
+            const auto uv =
+              static_cast<double_limb_type>
+              (
+                  static_cast<double_limb_type>(tij)
+                + static_cast<double_limb_type>(static_cast<double_limb_type>(h[i]) * cj)
+                + carry
+              );
 
-    using local_unsigned_integral_type = UnsignedIntegralType;
+            tij   = static_cast<limb_type>(uv);
+            carry = detail::make_hi<limb_type>(uv);
+          }
 
-    auto mask = static_cast<local_unsigned_integral_type>(u); // NOLINT(altera-id-dependent-backward-branch)
+          for(auto ij = static_cast<local_double_size_type>(h_limbs + j); ((carry != static_cast<limb_type>(UINT8_C(0))) && (ij < t_used)); ++ij)
+          {
+            t[ij] = static_cast<limb_type>(t[ij] + carry);
 
-    // This assumes that at least one bit is set.
-    // Otherwise saturation of the index will occur.
+            carry = ((t[ij] < carry) ? static_cast<limb_type>(UINT8_C(1)) : static_cast<limb_type>(UINT8_C(0)));
+          }
+        }
+      }
 
-    // Naive and basic LSB search.
-    // TBD: This could be improved with a binary search
-    // on the lowest bit position of the fundamental type.
-    while(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast8_t>(mask) & static_cast<std::uint_fast8_t>(UINT8_C(1))) == static_cast<std::uint_fast8_t>(UINT8_C(0))) // NOLINT(hicpp-signed-bitwise,altera-id-dependent-backward-branch)
-    {
-      mask = static_cast<local_unsigned_integral_type>(mask >> static_cast<unsigned>(UINT8_C(1)));
+      // Now t < 2^k, which fits in the normal width.
+      result_type result { };
 
-      ++result;
-    }
+      detail::copy_unsafe(t.cbegin(),
+                          t.cbegin() + static_cast<std::ptrdiff_t>(result_type::number_of_limbs), // NOLINT(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+                          result.representation().begin());
 
-    return result;
-  }
+      if(result >= my_m)
+      {
+        result -= my_m;
+      }
 
-  template<typename UnsignedIntegralType>
-  constexpr auto msb_helper(const UnsignedIntegralType& u) -> unsigned_fast_type
-  {
-    // Compile-time checks.
-    static_assert((   std::is_integral<UnsignedIntegralType>::value
-                   && std::is_unsigned<UnsignedIntegralType>::value),
-                   "Error: Please check the characteristics of UnsignedIntegralType");
+      return result;
+    }
 
-    using local_unsigned_integral_type = UnsignedIntegralType;
+    static constexpr auto make_offset(const result_type& m, const unsigned_fast_type k) -> result_type
+    {
+      // Form c = 2^k - m, where 2^k wraps to zero for k = Width2.
+      result_type two_pow_k { };
 
-    auto i = signed_fast_type { };
+      if(k < static_cast<unsigned_fast_type>(Width2))
+      {
+        two_pow_k = result_type(static_cast<std::uint8_t>(UINT8_C(1)));
 
-    // TBD: This could potentially be improved with a binary
-    // search for the highest bit position in the type.
+        two_pow_k <<= k;
+      }
 
-    for(i = static_cast<signed_fast_type>(std::numeric_limits<local_unsigned_integral_type>::digits - 1); i >= static_cast<signed_fast_type>(INT8_C(0)); --i)
+      return result_type(two_pow_k - m);
+    }
+
+    static constexpr auto used_limbs(const result_type& u) -> unsigned_fast_type
     {
-      const auto bit_is_set =
-      (
-        static_cast<local_unsigned_integral_type>
-        (
-          u & static_cast<local_unsigned_integral_type>(static_cast<local_unsigned_integral_type>(1U) << static_cast<unsigned_fast_type>(i))
-        )
-        != static_cast<local_unsigned_integral_type>(UINT8_C(0))
-      );
+      auto n = static_cast<unsigned_fast_type>(result_type::number_of_limbs);
 
-      if(bit_is_set)
+      while(   (n > static_cast<unsigned_fast_type>(UINT8_C(1)))
+            && (u.crepresentation()[static_cast<local_size_type>(n - static_cast<unsigned_fast_type>(UINT8_C(1)))] == static_cast<limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
       {
-        break;
+        --n;
       }
+
+      return n;
     }
 
-    return static_cast<unsigned_fast_type>((detail::max_unsafe)(static_cast<signed_fast_type>(INT8_C(0)), i));
-  }
+    WIDE_INTEGER_NODISCARD constexpr auto used_limbs_clamped() const -> local_size_type
+    {
+      // The used limbs of m never exceed the normal width. The clamp
+      // makes this bound visible to the compiler for the indexing
+      // of the scratch in mul_mod() and sqr_mod().
+      return static_cast<local_size_type>((std::min)(my_n, static_cast<unsigned_fast_type>(result_type::number_of_limbs)));
+    }
+  };
 
-  template<>
-  constexpr auto msb_helper<std::uint64_t>(const std::uint64_t& u) -> unsigned_fast_type
+  namespace detail {
+
+  // The check for the special shape of the modulus in powm is only
+  // made for types having at least this many limbs. Narrower types
+  // (such as the uint24_t of example011) do not construct a special_modulus
+  // in each call of powm.
+  constexpr auto special_modulus_limbs_min = static_cast<size_t>(UINT8_C(4));
+
+  template<typename OtherIntegralTypeP,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto powm_special_modulus(      uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& result,
+                                      const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b,
+                                      const OtherIntegralTypeP& p,
+                                      const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m,
+                                      const std::uint_fast8_t   window_bits) -> std::enable_if_t<(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>::number_of_limbs >= special_modulus_limbs_min), bool>
   {
-    constexpr unsigned thirty_two { unsigned { UINT8_C(32) } };
+    // Moduli of pseudo-Mersenne shape 2^k - c, with c having at most
+    // a quarter of the bits of m (such as 2^255 - 19, 2^521 - 1 and
+    // the prime of secp256k1), are reduced by the folding of special_modulus
+    // in about two rounds. The result is set for these moduli only.
 
-    const std::uint32_t hi_dword { static_cast<std::uint32_t>(u >> thirty_two) };
+    // For this shape, the bits of m from k / 4 up to its top bit are all
+    // set. Having at least special_modulus_limbs_min limbs, these cover
+    // the two upper limbs that are used in m. Moduli having a clear bit
+    // there are rejected before the special_modulus is set up.
 
-    const bool hi_dword_is_nonzero { (hi_dword != std::uint32_t { UINT8_C(0) }) };
+    using local_limb_type = typename uintwide_t<Width2, LimbType, AllocatorType, IsSigned>::limb_type;
 
-    return (hi_dword_is_nonzero ? static_cast<unsigned_fast_type>(msb_helper(hi_dword) + thirty_two) : msb_helper(static_cast<std::uint32_t>(u)));
-  }
+    const auto& mv = m.crepresentation();
 
-  template<>
-  constexpr auto msb_helper<std::uint32_t>(const std::uint32_t& u) -> unsigned_fast_type
-  {
-    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
-    auto x = static_cast<std::uint_fast32_t>(u);
+    auto n = static_cast<size_t>(mv.size());
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0xFFFF0000))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C(16))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C(16))); }
-    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x0000FF00))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 8))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 8))); }
-    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x000000F0))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 4))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 4))); }
-    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x0000000C))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) { x = static_cast<std::uint_fast32_t>(x >> static_cast<unsigned>(UINT8_C( 2))); r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 2))); }
-    if(static_cast<std::uint_fast32_t>(x & static_cast<std::uint_fast32_t>(UINT32_C(0x00000002))) != static_cast<std::uint_fast32_t>(UINT8_C(0))) {                                                                               r = static_cast<unsigned_fast_type>(r | static_cast<unsigned_fast_type>(UINT8_C( 1))); }
+    while((n > static_cast<size_t>(UINT8_C(0))) && (mv[static_cast<size_t>(n - static_cast<size_t>(UINT8_C(1)))] == static_cast<local_limb_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      --n;
+    }
 
-    return r;
-  }
+    if(n < static_cast<size_t>(UINT8_C(2)))
+    {
+      return false;
+    }
 
-  template<>
-  constexpr auto msb_helper<std::uint16_t>(const std::uint16_t& u) -> unsigned_fast_type
-  {
-    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
-    auto x = static_cast<std::uint_fast16_t>(u);
+    const auto m_top = mv[static_cast<size_t>(n - static_cast<size_t>(UINT8_C(1)))];
+    const auto m_sub = mv[static_cast<size_t>(n - static_cast<size_t>(UINT8_C(2)))];
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0xFF00)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(8))); r = static_cast<unsigned_fast_type>(r | UINT32_C(8)); }
-    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x00F0)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(4))); r = static_cast<unsigned_fast_type>(r | UINT32_C(4)); }
-    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x000C)) != UINT16_C(0)) { x = static_cast<std::uint_fast16_t>(x >> static_cast<unsigned>(UINT8_C(2))); r = static_cast<unsigned_fast_type>(r | UINT32_C(2)); }
-    if(static_cast<std::uint_fast16_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x0002)) != UINT16_C(0)) {                                                                              r = static_cast<unsigned_fast_type>(r | UINT32_C(1)); }
+    const auto m_top_limbs_are_ones =
+      (
+           (static_cast<local_limb_type>(m_top & static_cast<local_limb_type>(m_top + static_cast<local_limb_type>(UINT8_C(1)))) == static_cast<local_limb_type>(UINT8_C(0)))
+        && (m_sub == (std::numeric_limits<local_limb_type>::max)())
+      );
 
-    return r;
-  }
+    if(!m_top_limbs_are_ones)
+    {
+      return false;
+    }
 
-  template<>
-  constexpr auto msb_helper<std::uint8_t>(const std::uint8_t& u) -> unsigned_fast_type
-  {
-    auto r = static_cast<unsigned_fast_type>(UINT8_C(0));
-    auto x = static_cast<std::uint_fast8_t>(u);
+    const special_modulus<Width2, LimbType, AllocatorType, IsSigned> special_m(m);
 
-    // Use O(log2[N]) binary-halving in an unrolled loop to find the msb.
-    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0xF0)) != UINT8_C(0)) { x = static_cast<std::uint_fast8_t>(x >> static_cast<unsigned>(UINT8_C(4))); r = static_cast<unsigned_fast_type>(r | UINT32_C(4)); }
-    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x0C)) != UINT8_C(0)) { x = static_cast<std::uint_fast8_t>(x >> static_cast<unsigned>(UINT8_C(2))); r = static_cast<unsigned_fast_type>(r | UINT32_C(2)); }
-    if(static_cast<std::uint_fast8_t>(static_cast<std::uint_fast32_t>(x) & UINT32_C(0x02)) != UINT8_C(0)) {                                                                             r = static_cast<unsigned_fast_type>(r | UINT32_C(1)); }
+    const auto use_special_modulus =
+      (
+           special_m.is_special()
+        && (msb(special_m.offset()) < static_cast<unsigned_fast_type>(special_m.exponent() / static_cast<unsigned_fast_type>(UINT8_C(4))))
+      );
 
-    return r;
-  }
+    if(use_special_modulus)
+    {
+      result = special_m.powm(b, p, window_bits);
+    }
 
-  } // namespace detail
+    return use_special_modulus;
+  }
 
-  template<const size_t Width2,
+  template<typename OtherIntegralTypeP,
+           const size_t Width2,
            typename LimbType,
            typename AllocatorType,
            const bool IsSigned>
-  constexpr auto swap(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x,
-                      uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& y) noexcept -> void
+  constexpr auto powm_special_modulus(      uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& result,
+                                      const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b,
+                                      const OtherIntegralTypeP& p,
+                                      const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m,
+                                      const std::uint_fast8_t   window_bits) -> std::enable_if_t<(uintwide_t<Width2, LimbType, AllocatorType, IsSigned>::number_of_limbs < special_modulus_limbs_min), bool>
   {
-    if(&x != &y)
-    {
-      detail::swap_unsafe(x, y);
-    }
+    static_cast<void>(result);
+    static_cast<void>(b);
+    static_cast<void>(p);
+    static_cast<void>(m);
+    static_cast<void>(window_bits);
+
+    return false;
   }
 
-  template<const size_t Width2,
+  } // namespace detail
+
+  template<typename OtherIntegralTypeP,
+           const size_t Width2,
            typename LimbType,
            typename AllocatorType,
            const bool IsSigned>
-  constexpr auto lsb(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> unsigned_fast_type
+  constexpr auto pow(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b, const OtherIntegralTypeP& p, const std::uint_fast8_t window_bits) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
   {
-    // Calculate the position of the least-significant bit.
-    // Use a linear search starting from the least significant limb.
-
+    // Calculate (b ^ p).
     using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
-    using local_value_type        = typename local_wide_integer_type::representation_type::value_type;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
 
-    auto bpos   = static_cast<unsigned_fast_type>(UINT8_C(0));
-    auto offset = static_cast<unsigned_fast_type>(UINT8_C(0));
+    local_wide_integer_type result { };
 
-    for(auto it = x.crepresentation().cbegin(); it != x.crepresentation().cend(); ++it, ++offset) // NOLINT(llvm-qualified-auto,readability-qualified-auto,altera-id-dependent-backward-branch)
-    {
-      const auto vi = static_cast<local_value_type>(*it & (std::numeric_limits<local_value_type>::max)());
+    const local_limb_type p0 { static_cast<local_limb_type>(p) };
 
-      if(vi != static_cast<local_value_type>(UINT8_C(0)))
-      {
-        bpos =
-          static_cast<unsigned_fast_type>
-          (
-              detail::lsb_helper(*it)
-            + static_cast<unsigned_fast_type>
-              (
-                static_cast<unsigned_fast_type>(std::numeric_limits<local_value_type>::digits) * offset
-              )
-          );
+    if((p0 == static_cast<local_limb_type>(UINT8_C(0))) && (p == static_cast<OtherIntegralTypeP>(0)))
+    {
+      result = local_wide_integer_type(static_cast<std::uint8_t>(UINT8_C(1)));
+    }
+    else if((p0 == static_cast<local_limb_type>(UINT8_C(1))) && (p == static_cast<OtherIntegralTypeP>(UINT8_C(1))))
+    {
+      result = b;
+    }
+    else if((p0 == static_cast<local_limb_type>(UINT8_C(2))) && (p == static_cast<OtherIntegralTypeP>(UINT8_C(2))))
+    {
+      result  = b;
+      result *= b;
+    }
+    else
+    {
+      const local_wide_integer_type p_local { p };
 
-        break;
-      }
+      result =
+        detail::pow_sliding_window(local_wide_integer_type(static_cast<std::uint8_t>(UINT8_C(1))),
+                                   b,
+                                   p_local,
+                                   window_bits,
+                                   detail::pow_policy_plain<local_wide_integer_type> { });
     }
 
-    return bpos;
+    return result;
   }
 
-  template<const size_t Width2,
+  template<typename OtherIntegralTypeP,
+           typename OtherIntegralTypeM,
+           const size_t Width2,
            typename LimbType,
            typename AllocatorType,
            const bool IsSigned>
-  constexpr auto msb(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> unsigned_fast_type
+  constexpr auto powm(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b,
+                      const OtherIntegralTypeP& p,
+                      const OtherIntegralTypeM& m,
+                      const std::uint_fast8_t   window_bits) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
   {
-    // Calculate the position of the most-significant bit.
-    // Use a linear search starting from the most significant limb.
+    // Calculate (b ^ p) % m.
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
-    using local_value_type        = typename local_wide_integer_type::representation_type::value_type;
+    using local_normal_width_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_double_width_type = typename local_normal_width_type::double_width_type;
+    using local_limb_type         = typename local_normal_width_type::limb_type;
 
-    unsigned_fast_type bpos   { static_cast<unsigned_fast_type>(UINT8_C(0)) };
-    std::uint32_t      offset { static_cast<std::uint32_t>(x.crepresentation().size() - 1U) };
+          local_normal_width_type result  { };
+    const local_double_width_type m_local { m };
 
-    for(auto ri { x.crepresentation().crbegin() }; ri != x.crepresentation().crend(); ++ri, --offset) // NOLINT(altera-id-dependent-backward-branch)
+    const local_limb_type p0 { static_cast<local_limb_type>(p) };
+
+    if((p0 == static_cast<local_limb_type>(UINT8_C(0))) && (p == static_cast<OtherIntegralTypeP>(static_cast<int>(INT8_C(0)))))
     {
-      const auto vr = static_cast<local_value_type>(*ri & (std::numeric_limits<local_value_type>::max)());
+      result = local_normal_width_type((m != static_cast<unsigned>(UINT8_C(1))) ? static_cast<std::uint8_t>(UINT8_C(1)) : static_cast<std::uint8_t>(UINT8_C(0)));
+    }
+    else if((p0 == static_cast<local_limb_type>(UINT8_C(1))) && (p == static_cast<OtherIntegralTypeP>(static_cast<int>(INT8_C(1)))))
+    {
+      result = b % m;
+    }
+    else if((p0 == static_cast<local_limb_type>(UINT8_C(2))) && (p == static_cast<OtherIntegralTypeP>(static_cast<int>(INT8_C(2)))))
+    {
+      result = local_normal_width_type(mul_wide(b, b) % m_local);
+    }
+    else
+    {
+      const local_normal_width_type m_normal(m);
 
-      if(vr != static_cast<local_value_type>(UINT8_C(0)))
+      // Positive moduli that fit in the normal width (with nonnegative
+      // bases) keep the powers in the normal width. These are multiplied
+      // to the double width with mul_wide, instead of being multiplied
+      // in the double width, and reduced without division.
+      const auto use_normal_width =
+        (
+             (m_normal > static_cast<unsigned>(UINT8_C(0)))
+          && (b >= static_cast<unsigned>(UINT8_C(0)))
+          && (local_double_width_type(m_normal) == m_local)
+        );
+
+      // Use Montgomery multiplication for odd moduli among these
+      // and Barrett reduction for even moduli. Both avoid the long
+      // divisions inside of the loop.
+      const auto use_montgomery_context =
+        (
+             use_normal_width
+          && (static_cast<unsigned_fast_type>(static_cast<local_limb_type>(m_normal) & static_cast<local_limb_type>(UINT8_C(1))) != static_cast<unsigned_fast_type>(UINT8_C(0)))
+        );
+
+      // Moduli of pseudo-Mersenne shape are reduced by the folding
+      // of special_modulus. This is preferred over the other reductions.
+      const auto result_is_special =
+        (use_normal_width && detail::powm_special_modulus(result, b, p, m_normal, window_bits));
+
+      if(result_is_special)
       {
-        bpos =
-          static_cast<unsigned_fast_type>
+        ; // The result has been found with the special modulus.
+      }
+      else if(use_montgomery_context)
+      {
+        result = montgomery_context<Width2, LimbType, AllocatorType, IsSigned>(m_normal).powm(b, p, window_bits);
+      }
+      else if(use_normal_width)
+      {
+        result = barrett_reducer<Width2, LimbType, AllocatorType, IsSigned>(m_normal).powm(b, p, window_bits);
+      }
+      else
+      {
+        const detail::pow_policy_modulus<local_double_width_type> policy { m_local };
+
+        result =
+          local_normal_width_type
           (
-              detail::msb_helper(*ri)
-            + static_cast<unsigned_fast_type>
-              (
-                static_cast<unsigned_fast_type>(std::numeric_limits<local_value_type>::digits) * static_cast<unsigned_fast_type>(offset)
-              )
+            detail::pow_sliding_window(local_double_width_type(static_cast<std::uint8_t>(UINT8_C(1))) % m_local,
+                                       local_double_width_type(b) % m_local,
+                                       p,
+                                       window_bits,
+                                       policy)
           );
-
-        break;
       }
     }
 
-    return bpos;
+    return result;
   }
 
-  template<const size_t Width2,
+  template<typename OtherIntegralTypeP,
+           const size_t Width2,
            typename LimbType,
            typename AllocatorType,
            const bool IsSigned>
-  constexpr auto abs(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  constexpr auto powm_ct(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b,
+                         const OtherIntegralTypeP& p,
+                         const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
   {
+    // Calculate (b ^ p) % m for odd, positive m and 0 <= b in constant
+    // time with respect to the exponent p. This is intended for secret
+    // exponents such as private keys. The base and the modulus are
+    // treated as public. Unlike powm, there are no special cases for
+    // small exponents and no fallback for even moduli. Zero is returned
+    // if m is even (including zero) or negative.
+
     using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
 
-    return ((!local_wide_integer_type::is_neg(x)) ? x : -x);
+    const auto m_is_odd_and_positive =
+      (
+           (m > static_cast<unsigned>(UINT8_C(0)))
+        && (static_cast<local_limb_type>(*m.crepresentation().cbegin() & static_cast<local_limb_type>(UINT8_C(1))) != static_cast<local_limb_type>(UINT8_C(0)))
+      );
+
+    return
+      (
+        m_is_odd_and_positive
+          ? montgomery_context<Width2, LimbType, AllocatorType, IsSigned>(m).powm_ct(b, p)
+          : local_wide_integer_type { static_cast<unsigned>(UINT8_C(0)) }
+      );
   }
 
-  template<const size_t Width2,
+  template<typename InputIterator,
+           const size_t Width2,
            typename LimbType,
            typename AllocatorType,
            const bool IsSigned>
-  constexpr auto sqrt(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  constexpr auto multi_powm(InputIterator first,
+                            InputIterator last,
+                            const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
   {
-    // Calculate the square root.
+    // Calculate the product of the powers (b_i ^ p_i) % m for the pairs
+    // (b_i, p_i) in [first, last), with 0 <= b_i and positive m. Up to
+    // eight of the powers share one chain of squarings (Straus' method).
+    // Odd moduli use Montgomery multiplication, even moduli Barrett reduction.
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_wide_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type = typename local_wide_type::limb_type;
 
-    local_wide_integer_type s { };
+    const local_wide_type one { static_cast<std::uint8_t>(UINT8_C(1)) };
 
-    if(m.is_zero() || local_wide_integer_type::is_neg(m))
+    if(static_cast<local_limb_type>(static_cast<local_limb_type>(m) & static_cast<local_limb_type>(UINT8_C(1))) != static_cast<local_limb_type>(UINT8_C(0)))
     {
-      s = local_wide_integer_type(static_cast<std::uint_fast8_t>(UINT8_C(0)));
-    }
-    else
-    {
-      // Obtain the initial guess via algorithms
-      // involving the position of the msb.
-      const auto msb_pos = msb(m);
-
-      const auto msb_pos_mod_2 = static_cast<unsigned_fast_type>(msb_pos % static_cast<unsigned_fast_type>(UINT8_C(2)));
+      using local_montgomery_type = montgomery_context<Width2, LimbType, AllocatorType, IsSigned>;
 
-      // Obtain the initial value.
-      const auto left_shift_amount =
-        static_cast<unsigned_fast_type>
-        (
-          ((msb_pos_mod_2 == static_cast<unsigned_fast_type>(UINT8_C(0)))
-            ? static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>((msb_pos + static_cast<unsigned_fast_type>(UINT8_C(0))) / 2U)
-            : static_cast<unsigned_fast_type>(UINT8_C(1)) + static_cast<unsigned_fast_type>((msb_pos + static_cast<unsigned_fast_type>(UINT8_C(1))) / 2U))
-        );
+      const local_montgomery_type ctx(m);
 
-      auto u = static_cast<local_wide_integer_type>(static_cast<unsigned>(UINT8_C(1))) << left_shift_amount;
+      const detail::pow_policy_montgomery<local_montgomery_type> policy { ctx };
 
-      // Perform the iteration for the square root.
-      // See Algorithm 1.13 SqrtInt, Sect. 1.5.1
-      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
-      // Cambridge University Press, 2011.
+      return ctx.from_montgomery(detail::pow_interleaved_range(first, last, ctx.to_montgomery(one), policy));
+    }
 
-      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < static_cast<unsigned_fast_type>(UINT8_C(64)); ++i)
-      {
-        s = u;
+    using local_barrett_type = barrett_reducer<Width2, LimbType, AllocatorType, IsSigned>;
 
-        u = (s + (m / s)) >> static_cast<unsigned>(UINT8_C(1));
+    const local_barrett_type brt(m);
 
-        if(u >= s) { break; } // LCOV_EXCL_LINE
-      }
-    }
+    const detail::pow_policy_barrett<local_barrett_type> policy { brt };
 
-    return s;
+    return detail::pow_interleaved_range(first, last, (one < m) ? one : local_wide_type { }, policy);
   }
 
-  template<const size_t Width2,
+  template<typename OtherIntegralTypeP,
+           const size_t Width2,
            typename LimbType,
            typename AllocatorType,
            const bool IsSigned>
-  constexpr auto cbrt(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned> // NOLINT(misc-no-recursion)
+  constexpr auto multi_powm(std::initializer_list<std::pair<uintwide_t<Width2, LimbType, AllocatorType, IsSigned>, OtherIntegralTypeP>> terms,
+                            const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
   {
-    // Calculate the cube root.
+    return multi_powm(terms.begin(), terms.end(), m);
+  }
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+  namespace detail {
 
-    local_wide_integer_type s;
+  template<typename UnsignedShortType>
+  constexpr auto integer_gcd_reduce(UnsignedShortType u, UnsignedShortType v) -> UnsignedShortType
+  {
+    return detail::gcd_unsafe(u, v);
+  }
 
-    if(local_wide_integer_type::is_neg(m))
+  template<typename InputIterator>
+  constexpr auto gcd_lehmer_limb_at(InputIterator x, const unsigned_fast_type count, const unsigned_fast_type i) -> typename iterator_detail::iterator_traits<InputIterator>::value_type
+  {
+    using local_limb_type = typename iterator_detail::iterator_traits<InputIterator>::value_type;
+
+    return ((i < count) ? *advance_and_point(x, i) : static_cast<local_limb_type>(UINT8_C(0)));
+  }
+
+  template<typename SignedLargeType>
+  constexpr auto gcd_lehmer_abs_less(const SignedLargeType& x, const SignedLargeType& limit) -> bool
+  {
+    return ((x < limit) && (x > static_cast<SignedLargeType>(-limit)));
+  }
+
+  template<typename UnsignedShortType,
+           typename SignedLargeType>
+  constexpr auto gcd_lehmer_abs_limb(const SignedLargeType& x) -> UnsignedShortType
+  {
+    return static_cast<UnsignedShortType>((x < static_cast<SignedLargeType>(INT8_C(0))) ? -x : x);
+  }
+
+  template<typename InputIterator>
+  constexpr auto gcd_lehmer_top_bits(InputIterator x, const unsigned_fast_type count, const unsigned_fast_type bit_offset) -> typename uint_type_helper<static_cast<size_t>(std::numeric_limits<typename iterator_detail::iterator_traits<InputIterator>::value_type>::digits * 2)>::exact_unsigned_type
+  {
+    // Get the double limb found at bit_offset in the count limbs of x.
+
+    using local_limb_type        = typename iterator_detail::iterator_traits<InputIterator>::value_type;
+    using local_double_limb_type = typename uint_type_helper<static_cast<size_t>(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+    constexpr auto limb_bits = static_cast<unsigned_fast_type>(std::numeric_limits<local_limb_type>::digits);
+
+    const auto index = static_cast<unsigned_fast_type>(bit_offset / limb_bits);
+    const auto shift = static_cast<unsigned>(bit_offset % limb_bits);
+
+    auto result = static_cast<local_double_limb_type>(make_large(gcd_lehmer_limb_at(x, count, index), gcd_lehmer_limb_at(x, count, static_cast<unsigned_fast_type>(index + 1U))) >> shift);
+
+    if(shift != static_cast<unsigned>(UINT8_C(0)))
     {
-      s = -cbrt(-m);
+      result =
+        static_cast<local_double_limb_type>
+        (
+            result
+          | static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(gcd_lehmer_limb_at(x, count, static_cast<unsigned_fast_type>(index + 2U))) << static_cast<unsigned>(static_cast<unsigned>(limb_bits * 2U) - shift))
+        );
     }
-    else if(m.is_zero())
+
+    return result;
+  }
+
+  template<typename UnsignedLargeType>
+  constexpr auto gcd_lehmer_quotient(UnsignedLargeType x, const UnsignedLargeType y) -> UnsignedLargeType
+  {
+    // Calculate x / y for y != 0. Most quotients in the Euclidean
+    // algorithm are small, and these are found by subtraction.
+
+    auto q = static_cast<UnsignedLargeType>(UINT8_C(0));
+
+    for( ; (q < static_cast<UnsignedLargeType>(UINT8_C(4))) && (x >= y); ++q) // NOLINT(altera-id-dependent-backward-branch)
     {
-      s = local_wide_integer_type(static_cast<std::uint_fast8_t>(UINT8_C(0)));
+      x = static_cast<UnsignedLargeType>(x - y);
     }
-    else
+
+    return ((x < y) ? q : static_cast<UnsignedLargeType>(q + static_cast<UnsignedLargeType>(x / y)));
+  }
+
+  template<typename ResultIterator,
+           typename InputIterator,
+           typename LimbType>
+  constexpr auto gcd_lehmer_combine(      ResultIterator     r,
+                                          InputIterator      x,
+                                          InputIterator      y,
+                                    const LimbType           a,
+                                    const LimbType           b,
+                                    const unsigned_fast_type count) -> void
+  {
+    // Calculate r = a * x - b * y in count limbs. The difference
+    // is known to be non-negative and to fit in count limbs.
+
+    using local_limb_type        = LimbType;
+    using local_double_limb_type = typename uint_type_helper<static_cast<size_t>(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+    auto carry_ax = static_cast<local_limb_type>(UINT8_C(0));
+    auto carry_by = static_cast<local_limb_type>(UINT8_C(0));
+    auto borrow   = static_cast<local_limb_type>(UINT8_C(0));
+
+    for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < count; ++i)
     {
-      // Obtain the initial guess via algorithms
-      // involving the position of the msb.
-      const auto msb_pos = msb(m);
+      const auto ax = static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(a) * *x++) + carry_ax);
+      const auto by = static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(b) * *y++) + carry_by);
 
-      // Obtain the initial value.
-      const auto msb_pos_mod_3 = static_cast<unsigned_fast_type>(msb_pos % static_cast<unsigned_fast_type>(UINT8_C(3)));
+      carry_ax = make_hi<local_limb_type>(ax);
+      carry_by = make_hi<local_limb_type>(by);
 
-      const auto left_shift_amount =
-        static_cast<unsigned_fast_type>
+      const auto diff =
+        static_cast<local_double_limb_type>
         (
-          (msb_pos_mod_3 == unsigned_fast_type { UINT8_C(0) })
-            ? unsigned_fast_type { UINT8_C(1) } + static_cast<unsigned_fast_type>(msb_pos / unsigned_fast_type { UINT8_C(3) })
-            : unsigned_fast_type { UINT8_C(1) } + static_cast<unsigned_fast_type>((msb_pos + (unsigned_fast_type { UINT8_C(3) } - msb_pos_mod_3)) / unsigned_fast_type { UINT8_C(3) })
+            static_cast<local_double_limb_type>(make_lo<local_limb_type>(ax))
+          - static_cast<local_double_limb_type>(make_lo<local_limb_type>(by))
+          - borrow
         );
 
-      auto u = static_cast<local_wide_integer_type>(static_cast<unsigned>(UINT8_C(1))) << left_shift_amount;
+      *r++ = make_lo<local_limb_type>(diff);
 
-      // Perform the iteration for the k'th root (applied for k = 3).
-      // See Algorithm 1.14 RootInt, Sect. 1.5.2
-      // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
-      // Cambridge University Press, 2011.
+      borrow = static_cast<local_limb_type>(make_hi<local_limb_type>(diff) & static_cast<local_limb_type>(UINT8_C(1)));
+    }
+  }
 
-      const auto three_minus_one =
-        static_cast<unsigned_fast_type>
-        (
-          static_cast<unsigned>(static_cast<unsigned>(UINT8_C(3)) - static_cast<unsigned>(UINT8_C(1)))
-        );
+  template<typename SignedLargeType>
+  struct gcd_lehmer_matrix
+  {
+    // The cofactors (a, b; c, d) of one Lehmer step, the number of
+    // Euclidean steps that these combine and the number of limbs
+    // of the operands to which they apply.
+
+    SignedLargeType    a     { static_cast<SignedLargeType>(INT8_C(1)) };
+    SignedLargeType    b     { static_cast<SignedLargeType>(INT8_C(0)) };
+    SignedLargeType    c     { static_cast<SignedLargeType>(INT8_C(0)) };
+    SignedLargeType    d     { static_cast<SignedLargeType>(INT8_C(1)) };
+    unsigned_fast_type steps { static_cast<unsigned_fast_type>(UINT8_C(0)) };
+    unsigned_fast_type count { static_cast<unsigned_fast_type>(UINT8_C(0)) };
+  };
 
-      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < static_cast<unsigned_fast_type>(UINT8_C(64)); ++i)
-      {
-        s = u;
+  template<typename WideIntegerType>
+  constexpr auto gcd_lehmer_find_matrix(const WideIntegerType& u, const WideIntegerType& v) -> gcd_lehmer_matrix<typename uint_type_helper<static_cast<size_t>(std::numeric_limits<typename WideIntegerType::limb_type>::digits * 2)>::exact_signed_type>
+  {
+    // Find the cofactors of one step of Lehmer's algorithm for u >= v
+    // (D. E. Knuth, The Art of Computer Programming, Vol. 2,
+    // Sect. 4.5.2, Algorithm L). The Euclidean algorithm is carried
+    // out on the leading 2 * limb_bits - 2 bits of u and v for as long
+    // as the quotients are certain to be the same as those of u and v.
+    // If not even one quotient is certain, the cofactor b remains zero.
 
-        local_wide_integer_type m_over_s_pow_3_minus_one(m);
+    using local_wide_integer_type        = WideIntegerType;
+    using local_limb_type                = typename local_wide_integer_type::limb_type;
+    using local_double_limb_type         = typename local_wide_integer_type::double_limb_type;
+    using local_signed_double_limb_type  = typename uint_type_helper<static_cast<size_t>(std::numeric_limits<local_limb_type>::digits * 2)>::exact_signed_type;
 
-        // Use an unrolled loop to divide by s^2 here.
-        // Without a loop, s^2 could potentially overflow.
-        m_over_s_pow_3_minus_one /= s;
-        m_over_s_pow_3_minus_one /= s;
+    constexpr auto limb_bits = static_cast<unsigned_fast_type>(std::numeric_limits<local_limb_type>::digits);
+    constexpr auto top_bits  = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(limb_bits * 2U) - 2U);
 
-        u = ((s * three_minus_one) + m_over_s_pow_3_minus_one) / static_cast<unsigned>(UINT8_C(3));
+    // The cofactors are kept below 2^(limb_bits - 1) in magnitude,
+    // which fits them in one limb and prevents overflow in the
+    // signed double limb.
+    constexpr auto cofactor_limit = static_cast<local_signed_double_limb_type>(static_cast<local_signed_double_limb_type>(INT8_C(1)) << static_cast<unsigned>(limb_bits - 1U));
 
-        if(u >= s)
-        {
-          break;
-        }
-      }
-    }
+    gcd_lehmer_matrix<local_signed_double_limb_type> m { };
 
-    return s;
-  }
+    const auto u_bits = static_cast<unsigned_fast_type>(msb(u) + 1U);
 
-  template<const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto rootk(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m, std::uint_fast8_t k) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
-  {
-    // Calculate the k'th root.
+    m.count = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(u_bits + static_cast<unsigned_fast_type>(limb_bits - 1U)) / limb_bits);
 
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    const auto offset = static_cast<unsigned_fast_type>((u_bits > top_bits) ? static_cast<unsigned_fast_type>(u_bits - top_bits) : static_cast<unsigned_fast_type>(UINT8_C(0)));
 
-    local_wide_integer_type s;
+    auto uh = static_cast<local_signed_double_limb_type>(gcd_lehmer_top_bits(u.crepresentation().cbegin(), m.count, offset));
+    auto vh = static_cast<local_signed_double_limb_type>(gcd_lehmer_top_bits(v.crepresentation().cbegin(), m.count, offset));
 
-    if(k < static_cast<std::uint_fast8_t>(UINT8_C(2)))
-    {
-      s = m;
-    }
-    else if(k == static_cast<std::uint_fast8_t>(UINT8_C(2)))
-    {
-      s = sqrt(m);
-    }
-    else if(k == static_cast<std::uint_fast8_t>(UINT8_C(3)))
+    for(;;)
     {
-      s = cbrt(m);
-    }
-    else
-    {
-      if(m.is_zero() || local_wide_integer_type::is_neg(m))
+      const auto uh_plus_a = static_cast<local_signed_double_limb_type>(uh + m.a);
+      const auto uh_plus_b = static_cast<local_signed_double_limb_type>(uh + m.b);
+      const auto vh_plus_c = static_cast<local_signed_double_limb_type>(vh + m.c);
+      const auto vh_plus_d = static_cast<local_signed_double_limb_type>(vh + m.d);
+
+      if(   (vh_plus_c <= static_cast<local_signed_double_limb_type>(INT8_C(0)))
+         || (vh_plus_d <= static_cast<local_signed_double_limb_type>(INT8_C(0)))
+         || (uh_plus_a <  static_cast<local_signed_double_limb_type>(INT8_C(0)))
+         || (uh_plus_b <  static_cast<local_signed_double_limb_type>(INT8_C(0))))
       {
-        s = local_wide_integer_type(static_cast<std::uint_fast8_t>(UINT8_C(0)));
+        break;
       }
-      else
-      {
-        // Obtain the initial guess via algorithms
-        // involving the position of the msb.
-        const auto msb_pos = msb(m);
-
-        // Obtain the initial value.
-        const auto msb_pos_mod_k = static_cast<unsigned_fast_type>(msb_pos % static_cast<unsigned_fast_type>(k));
 
-        const auto left_shift_amount =
-          static_cast<unsigned_fast_type>
-          (
-            (msb_pos_mod_k == unsigned_fast_type { UINT8_C(0) })
-              ? unsigned_fast_type { UINT8_C(1) } + static_cast<unsigned_fast_type>(msb_pos / unsigned_fast_type { k })
-              : unsigned_fast_type { UINT8_C(1) } + static_cast<unsigned_fast_type>((msb_pos + (unsigned_fast_type { k } - msb_pos_mod_k)) / unsigned_fast_type { k })
-          );
-
-        auto u = static_cast<local_wide_integer_type>(static_cast<unsigned>(UINT8_C(1))) << left_shift_amount;
+      const auto q =
+        static_cast<local_signed_double_limb_type>
+        (
+          gcd_lehmer_quotient(static_cast<local_double_limb_type>(uh_plus_a), static_cast<local_double_limb_type>(vh_plus_c))
+        );
 
-        // Perform the iteration for the k'th root.
-        // See Algorithm 1.14 RootInt, Sect. 1.5.2
-        // in R.P. Brent and Paul Zimmermann, "Modern Computer Arithmetic",
-        // Cambridge University Press, 2011.
+      if(   (q != static_cast<local_signed_double_limb_type>(gcd_lehmer_quotient(static_cast<local_double_limb_type>(uh_plus_b), static_cast<local_double_limb_type>(vh_plus_d))))
+         || (!gcd_lehmer_abs_less(q, cofactor_limit)))
+      {
+        break;
+      }
 
-        const auto k_minus_one = static_cast<unsigned_fast_type>(k - 1U);
+      const auto next_c = static_cast<local_signed_double_limb_type>(m.a - static_cast<local_signed_double_limb_type>(q * m.c));
+      const auto next_d = static_cast<local_signed_double_limb_type>(m.b - static_cast<local_signed_double_limb_type>(q * m.d));
 
-        for(auto   i = static_cast<unsigned_fast_type>(UINT8_C(0));
-                   i < static_cast<unsigned_fast_type>(UINT8_C(64));
-                 ++i)
-        {
-          s = u;
+      if((!gcd_lehmer_abs_less(next_c, cofactor_limit)) || (!gcd_lehmer_abs_less(next_d, cofactor_limit)))
+      {
+        break;
+      }
 
-          local_wide_integer_type m_over_s_pow_k_minus_one(m);
+      m.a = m.c;
+      m.b = m.d;
+      m.c = next_c;
+      m.d = next_d;
 
-          // Use a recursive call here to divide by s^(k - 1). This behaves like
-          // a loop. Without a "loop" (i.e., a recursive call) here, s^(k - 1)
-          // could potentially overflow.
-          detail::div_maker_recursive(m_over_s_pow_k_minus_one, s, static_cast<int>(k_minus_one));
+      ++m.steps;
 
-          u = ((s * k_minus_one) + m_over_s_pow_k_minus_one) / k;
+      const auto next_vh = static_cast<local_signed_double_limb_type>(uh - static_cast<local_signed_double_limb_type>(q * vh));
 
-          if(u >= s)
-          {
-            break;
-          }
-        }
-      }
+      uh = vh;
+      vh = next_vh;
     }
 
-    return s;
+    return m;
   }
 
-  template<typename OtherIntegralTypeP,
-           const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto pow(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b, const OtherIntegralTypeP& p) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  template<typename ResultIterator,
+           typename InputIterator,
+           typename LimbType>
+  constexpr auto gcd_lehmer_combine_sum(      ResultIterator     r,
+                                              InputIterator      x,
+                                              InputIterator      y,
+                                        const LimbType           a,
+                                        const LimbType           b,
+                                        const unsigned_fast_type count) -> void
   {
-    // Calculate (b ^ p).
-    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
-    using local_limb_type         = typename local_wide_integer_type::limb_type;
+    // Calculate r = a * x + b * y in count limbs.
 
-    local_wide_integer_type result { };
-    local_limb_type p0 { static_cast<local_limb_type>(p) };
-
-    if((p0 == static_cast<local_limb_type>(UINT8_C(0))) && (p == static_cast<OtherIntegralTypeP>(0)))
-    {
-      result = local_wide_integer_type(static_cast<std::uint8_t>(UINT8_C(1)));
-    }
-    else if((p0 == static_cast<local_limb_type>(UINT8_C(1))) && (p == static_cast<OtherIntegralTypeP>(UINT8_C(1))))
-    {
-      result = b;
-    }
-    else if((p0 == static_cast<local_limb_type>(UINT8_C(2))) && (p == static_cast<OtherIntegralTypeP>(UINT8_C(2))))
-    {
-      result  = b;
-      result *= b;
-    }
-    else
+    using local_limb_type        = LimbType;
+    using local_double_limb_type = typename uint_type_helper<static_cast<size_t>(std::numeric_limits<local_limb_type>::digits * 2)>::exact_unsigned_type;
+
+    auto carry_ax = static_cast<local_limb_type>(UINT8_C(0));
+    auto carry_by = static_cast<local_limb_type>(UINT8_C(0));
+    auto carry    = static_cast<local_limb_type>(UINT8_C(0));
+
+    for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < count; ++i)
     {
-      result = local_wide_integer_type(static_cast<std::uint8_t>(UINT8_C(1)));
+      const auto ax = static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(a) * *x++) + carry_ax);
+      const auto by = static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(static_cast<local_double_limb_type>(b) * *y++) + carry_by);
 
-      local_wide_integer_type y       { b };
-      local_wide_integer_type p_local { p };
+      carry_ax = make_hi<local_limb_type>(ax);
+      carry_by = make_hi<local_limb_type>(by);
 
-      while(((p0 = static_cast<local_limb_type>(p_local)) != static_cast<local_limb_type>(UINT8_C(0))) || (p_local != static_cast<local_wide_integer_type>(UINT8_C(0)))) // NOLINT(altera-id-dependent-backward-branch)
-      {
-        if(static_cast<unsigned_fast_type>(p0 & static_cast<local_limb_type>(UINT8_C(1))) != static_cast<unsigned_fast_type>(UINT8_C(0)))
-        {
-          result *= y;
-        }
+      const auto sum =
+        static_cast<local_double_limb_type>
+        (
+            static_cast<local_double_limb_type>(make_lo<local_limb_type>(ax))
+          + static_cast<local_double_limb_type>(make_lo<local_limb_type>(by))
+          + carry
+        );
 
-        y *= y;
+      *r++ = make_lo<local_limb_type>(sum);
 
-        p_local >>= 1U;
-      }
+      carry = make_hi<local_limb_type>(sum);
     }
-
-    return result;
   }
 
-  template<typename OtherIntegralTypeP,
-           typename OtherIntegralTypeM,
-           const size_t Width2,
-           typename LimbType,
-           typename AllocatorType,
-           const bool IsSigned>
-  constexpr auto powm(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b,
-                      const OtherIntegralTypeP& p,
-                      const OtherIntegralTypeM& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  template<typename WideIntegerType,
+           typename SignedLargeType>
+  constexpr auto gcd_lehmer_apply(WideIntegerType& u, WideIntegerType& v, const gcd_lehmer_matrix<SignedLargeType>& m) -> void
   {
-    // Calculate (b ^ p) % m.
-
-    using local_normal_width_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
-    using local_double_width_type = typename local_normal_width_type::double_width_type;
-    using local_limb_type         = typename local_normal_width_type::limb_type;
+    // Set (u, v) = (a * u + b * v, c * u + d * v) in one single pass.
+    // The nonzero cofactor b has the sign of c and the opposite sign
+    // of a and d.
 
-          local_normal_width_type result  { };
-          local_double_width_type y       { b };
-    const local_double_width_type m_local { m };
+    using local_wide_integer_type = WideIntegerType;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
 
-    local_limb_type p0 { static_cast<local_limb_type>(p) }; // NOLINT(altera-id-dependent-backward-branch)
+    local_wide_integer_type u_next { };
+    local_wide_integer_type v_next { };
 
-    if((p0 == static_cast<local_limb_type>(UINT8_C(0))) && (p == static_cast<OtherIntegralTypeP>(static_cast<int>(INT8_C(0)))))
+    if(m.b < static_cast<SignedLargeType>(INT8_C(0)))
     {
-      result = local_normal_width_type((m != static_cast<unsigned>(UINT8_C(1))) ? static_cast<std::uint8_t>(UINT8_C(1)) : static_cast<std::uint8_t>(UINT8_C(0)));
+      gcd_lehmer_combine(u_next.representation().begin(), u.crepresentation().cbegin(), v.crepresentation().cbegin(), gcd_lehmer_abs_limb<local_limb_type>(m.a), gcd_lehmer_abs_limb<local_limb_type>(m.b), m.count);
+      gcd_lehmer_combine(v_next.representation().begin(), v.crepresentation().cbegin(), u.crepresentation().cbegin(), gcd_lehmer_abs_limb<local_limb_type>(m.d), gcd_lehmer_abs_limb<local_limb_type>(m.c), m.count);
     }
-    else if((p0 == static_cast<local_limb_type>(UINT8_C(1))) && (p == static_cast<OtherIntegralTypeP>(static_cast<int>(INT8_C(1)))))
+    else
     {
-      result = b % m;
+      gcd_lehmer_combine(u_next.representation().begin(), v.crepresentation().cbegin(), u.crepresentation().cbegin(), gcd_lehmer_abs_limb<local_limb_type>(m.b), gcd_lehmer_abs_limb<local_limb_type>(m.a), m.count);
+      gcd_lehmer_combine(v_next.representation().begin(), u.crepresentation().cbegin(), v.crepresentation().cbegin(), gcd_lehmer_abs_limb<local_limb_type>(m.c), gcd_lehmer_abs_limb<local_limb_type>(m.d), m.count);
     }
-    else if((p0 == static_cast<local_limb_type>(UINT8_C(2))) && (p == static_cast<OtherIntegralTypeP>(static_cast<int>(INT8_C(2)))))
+
+    u = std::move(u_next);
+    v = std::move(v_next);
+  }
+
+  template<typename WideIntegerType,
+           typename SignedLargeType>
+  constexpr auto gcd_lehmer_apply_to_cofactors(WideIntegerType& s_u, WideIntegerType& s_v, const gcd_lehmer_matrix<SignedLargeType>& m) -> void
+  {
+    // Transform the magnitudes of the Bezout coefficients belonging
+    // to u and v along with these. The signs of the coefficients
+    // alternate along the remainder sequence, such that their
+    // magnitudes add up as (|a| |s_u| + |b| |s_v|, |c| |s_u| + |d| |s_v|).
+
+    using local_wide_integer_type = WideIntegerType;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
+
+    local_wide_integer_type s_u_next { };
+    local_wide_integer_type s_v_next { };
+
+    constexpr auto count = static_cast<unsigned_fast_type>(local_wide_integer_type::number_of_limbs);
+
+    gcd_lehmer_combine_sum(s_u_next.representation().begin(), s_u.crepresentation().cbegin(), s_v.crepresentation().cbegin(), gcd_lehmer_abs_limb<local_limb_type>(m.a), gcd_lehmer_abs_limb<local_limb_type>(m.b), count);
+    gcd_lehmer_combine_sum(s_v_next.representation().begin(), s_u.crepresentation().cbegin(), s_v.crepresentation().cbegin(), gcd_lehmer_abs_limb<local_limb_type>(m.c), gcd_lehmer_abs_limb<local_limb_type>(m.d), count);
+
+    s_u = std::move(s_u_next);
+    s_v = std::move(s_v_next);
+  }
+
+  template<typename WideIntegerType>
+  constexpr auto gcd_lehmer_step(WideIntegerType& u, WideIntegerType& v) -> void
+  {
+    // Perform one step of Lehmer's algorithm for u >= v, where v is
+    // wider than a double limb. If not even one quotient is certain,
+    // a full division step is done instead.
+
+    const auto m = gcd_lehmer_find_matrix(u, v);
+
+    if(m.b == static_cast<decltype(m.b)>(INT8_C(0)))
     {
-      y *= y;
-      y %= m_local;
+      WideIntegerType r { u % v };
 
-      result = local_normal_width_type(y);
+      u = std::move(v);
+      v = std::move(r);
     }
     else
     {
-      using local_other_integral_p_type = OtherIntegralTypeP;
+      gcd_lehmer_apply(u, v, m);
+    }
+  }
+
+  template<typename UnsignedWideType>
+  constexpr auto extended_gcd_lehmer(UnsignedWideType  u,
+                                     UnsignedWideType  v,
+                                     UnsignedWideType* s,
+                                     UnsignedWideType* t,
+                                     bool&             t_is_neg) -> UnsignedWideType
+  {
+    // Calculate g = gcd(u, v) for u >= v with Lehmer's algorithm, along
+    // with the magnitudes of the Bezout coefficients s and t having
+    // s * u + t * v = g. The coefficients s and t have opposite signs.
+    // The coefficient s is only calculated if requested (s != nullptr).
+    // The magnitudes are bounded by u and v, such that these are found
+    // at the width of u and v. The remainder sequence r_k has the
+    // coefficients s_k and t_k with signs that alternate in k.
 
-      local_double_width_type     x      (static_cast<std::uint8_t>(UINT8_C(1)));
-      local_other_integral_p_type p_local(p);
+    using local_wide_integer_type = UnsignedWideType;
+
+    local_wide_integer_type s_u { static_cast<unsigned>(UINT8_C(1)) };
+    local_wide_integer_type s_v { static_cast<unsigned>(UINT8_C(0)) };
+    local_wide_integer_type t_u { static_cast<unsigned>(UINT8_C(0)) };
+    local_wide_integer_type t_v { static_cast<unsigned>(UINT8_C(1)) };
+
+    auto k_is_odd = false;
+
+    while(v != static_cast<unsigned>(UINT8_C(0))) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      const auto m = gcd_lehmer_find_matrix(u, v);
 
-      while(((p0 = static_cast<local_limb_type>(p_local)) != static_cast<local_limb_type>(UINT8_C(0))) || (p_local != static_cast<local_other_integral_p_type>(0))) // NOLINT(altera-id-dependent-backward-branch)
+      if(m.b == static_cast<decltype(m.b)>(INT8_C(0)))
       {
-        if(static_cast<unsigned_fast_type>(p0 & static_cast<local_limb_type>(UINT8_C(1))) != static_cast<unsigned_fast_type>(UINT8_C(0)))
+        // Do a full division step. The product of the quotient and the
+        // coefficient is correct in the low limbs, which hold the result.
+
+        auto qr = divmod(u, v);
+
+        u = std::move(v);
+        v = std::move(qr.second);
+
+        local_wide_integer_type t_next { t_u + (qr.first * t_v) };
+
+        t_u = std::move(t_v);
+        t_v = std::move(t_next);
+
+        if(s != nullptr)
         {
-          x *= y;
-          x %= m_local;
-        }
+          local_wide_integer_type s_next { s_u + (qr.first * s_v) };
 
-        y *= y;
-        y %= m_local;
+          s_u = std::move(s_v);
+          s_v = std::move(s_next);
+        }
 
-        p_local >>= 1U; // NOLINT(hicpp-signed-bitwise) // LCOV_EXCL_LINE
+        k_is_odd = (!k_is_odd);
       }
+      else
+      {
+        gcd_lehmer_apply(u, v, m);
+
+        gcd_lehmer_apply_to_cofactors(t_u, t_v, m);
+
+        if(s != nullptr)
+        {
+          gcd_lehmer_apply_to_cofactors(s_u, s_v, m);
+        }
 
-      result = local_normal_width_type(x);
+        k_is_odd = (k_is_odd != (static_cast<unsigned_fast_type>(m.steps % 2U) != static_cast<unsigned_fast_type>(UINT8_C(0))));
+      }
     }
 
-    return result;
-  }
+    // The coefficient t_k is negative for even k and s_k is negative for odd k.
+    t_is_neg = (!k_is_odd);
 
-  namespace detail {
+    if(s != nullptr)
+    {
+      *s = std::move(s_u);
+    }
 
-  template<typename UnsignedShortType>
-  constexpr auto integer_gcd_reduce(UnsignedShortType u, UnsignedShortType v) -> UnsignedShortType
-  {
-    return detail::gcd_unsafe(u, v);
+    *t = std::move(t_u);
+
+    return u;
   }
 
   } // namespace detail
@@ -6501,70 +11430,77 @@
       u >>= u_shift;
       v >>= v_shift;
 
+      constexpr unsigned local_ularge_bits { static_cast<unsigned>(sizeof(local_ularge_type) * std::size_t { UINT8_C(8) }) };
+
+      const local_wide_integer_type ularge_type_max { (local_wide_integer_type{1} << local_ularge_bits) - 1U };
+
+      // Reduce with Lehmer steps for as long as v is wider than a double
+      // limb. Each step replaces a sequence of Euclidean steps with one
+      // single pass over the limbs of u and v.
+
       for(;;)
       {
-        // Now u and v are both odd, so diff(u, v) is even.
-        // Let u = min(u, v), v = diff(u, v) / 2.
-
-        if(u == v)
+        if(u < v)
         {
-          break;
+          swap(u, v);
         }
 
-        if(u > v)
+        if(v <= ularge_type_max)
         {
-          swap(u, v);
+          break;
         }
 
-        constexpr unsigned local_ularge_bits { static_cast<unsigned>(sizeof(local_ularge_type) * std::size_t { UINT8_C(8) }) };
-
-        const local_wide_integer_type ularge_type_max { (local_wide_integer_type{1} << local_ularge_bits) - 1U };
+        detail::gcd_lehmer_step(u, v);
+      }
 
-        if(v <= ularge_type_max)
+      if(v != static_cast<unsigned>(UINT8_C(0)))
+      {
+        if(u > ularge_type_max)
         {
-          const auto my_v_hi =
-            static_cast<local_ushort_type>
-            (
-              (v.crepresentation().size() >= static_cast<typename local_wide_integer_type::representation_type::size_type>(UINT8_C(2)))
-                ? static_cast<local_ushort_type>(*detail::advance_and_point(v.crepresentation().cbegin(), static_cast<local_size_type>(UINT8_C(1))))
-                : static_cast<local_ushort_type>(UINT8_C(0))
-            );
+          u %= v;
 
-          const auto my_u_hi =
-            static_cast<local_ushort_type>
-            (
-              (u.crepresentation().size() >= static_cast<typename local_wide_integer_type::representation_type::size_type>(UINT8_C(2)))
-                ? static_cast<local_ushort_type>(*detail::advance_and_point(u.crepresentation().cbegin(), static_cast<local_size_type>(UINT8_C(1))))
-                : static_cast<local_ushort_type>(UINT8_C(0))
-            );
+          swap(u, v);
+        }
 
-          const local_ularge_type v_large = detail::make_large(*v.crepresentation().cbegin(), my_v_hi);
-          const local_ularge_type u_large = detail::make_large(*u.crepresentation().cbegin(), my_u_hi);
+        // Now u and v both fit in a double limb.
 
-          const local_ularge_type
-            gcd_reduce_value
-            {
-              detail::integer_gcd_reduce
-              (
-                v_large,
-                u_large
-              )
-            };
+        const auto my_v_hi =
+          static_cast<local_ushort_type>
+          (
+            (v.crepresentation().size() >= static_cast<typename local_wide_integer_type::representation_type::size_type>(UINT8_C(2)))
+              ? static_cast<local_ushort_type>(*detail::advance_and_point(v.crepresentation().cbegin(), static_cast<local_size_type>(UINT8_C(1))))
+              : static_cast<local_ushort_type>(UINT8_C(0))
+          );
 
-          const local_ushort_type u_lo { detail::make_lo<local_ushort_type>(gcd_reduce_value) };
-          const local_ushort_type u_hi { detail::make_hi<local_ushort_type>(gcd_reduce_value) };
+        const auto my_u_hi =
+          static_cast<local_ushort_type>
+          (
+            (u.crepresentation().size() >= static_cast<typename local_wide_integer_type::representation_type::size_type>(UINT8_C(2)))
+              ? static_cast<local_ushort_type>(*detail::advance_and_point(u.crepresentation().cbegin(), static_cast<local_size_type>(UINT8_C(1))))
+              : static_cast<local_ushort_type>(UINT8_C(0))
+          );
 
-          u = local_wide_integer_type { u_hi };
+        const local_ularge_type v_large = detail::make_large(*v.crepresentation().cbegin(), my_v_hi);
+        const local_ularge_type u_large = detail::make_large(*u.crepresentation().cbegin(), my_u_hi);
 
-          u <<= static_cast<unsigned>(sizeof(local_ushort_type) * std::size_t { UINT8_C(8) });
+        const local_ularge_type
+          gcd_reduce_value
+          {
+            detail::integer_gcd_reduce
+            (
+              v_large,
+              u_large
+            )
+          };
 
-          u |= u_lo;
+        const local_ushort_type u_lo { detail::make_lo<local_ushort_type>(gcd_reduce_value) };
+        const local_ushort_type u_hi { detail::make_hi<local_ushort_type>(gcd_reduce_value) };
 
-          break;
-        }
+        u = local_wide_integer_type { u_hi };
 
-        v  -= u;
-        v >>= lsb(v);
+        u <<= static_cast<unsigned>(sizeof(local_ushort_type) * std::size_t { UINT8_C(8) });
+
+        u |= u_lo;
       }
 
       result = (u << left_shift_amount);
@@ -6582,62 +11518,332 @@
   constexpr auto gcd(const UnsignedShortType& u, const UnsignedShortType& v) -> std::enable_if_t<(   std::is_integral<UnsignedShortType>::value
                                                                                                   && std::is_unsigned<UnsignedShortType>::value), UnsignedShortType>
   {
-    return detail::gcd_unsafe(u, v);
-  }
+    return detail::gcd_unsafe(u, v);
+  }
+
+  namespace detail {
+
+  // Use a local, constexpr, unsafe implementation of the abs-function.
+  template<typename ArithmeticType>
+  constexpr auto abs_unsafe(const ArithmeticType& val) -> ArithmeticType
+  {
+    if(val > static_cast<int>(INT8_C(0)))
+    {
+      return val;
+    }
+    else // NOLINT(llvm-else-after-return,readability-else-after-return)
+    {
+      ArithmeticType val_unsigned { val };
+
+      val_unsigned.negate();
+
+      return val_unsigned;
+    }
+  }
+
+  template<typename IntegerType>
+  constexpr auto lcm_impl(const IntegerType& a, const IntegerType& b) -> IntegerType
+  {
+    using local_integer_type = IntegerType;
+
+    const local_integer_type ap = detail::abs_unsafe(a);
+    const local_integer_type bp = detail::abs_unsafe(b);
+
+    const auto a_is_greater_than_b = (ap > bp);
+
+    const auto gcd_of_ab = gcd(a, b);
+
+    return (a_is_greater_than_b ? ap * (bp / gcd_of_ab)
+                                : bp * (ap / gcd_of_ab));
+  }
+
+  } // namespace detail
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto lcm(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                     const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    return detail::lcm_impl(a, b);
+  }
+
+  template<typename UnsignedShortType>
+  constexpr auto lcm(const UnsignedShortType& a, const UnsignedShortType& b) -> std::enable_if_t<(   std::is_integral<UnsignedShortType>::value
+                                                                                                  && std::is_unsigned<UnsignedShortType>::value), UnsignedShortType>
+  {
+    return detail::lcm_impl(a, b);
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto extended_gcd(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                              const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> extended_gcd_result<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate g = gcd(a, b) along with the Bezout coefficients s and t
+    // having s * a + t * b = g. The calculation uses Lehmer's algorithm
+    // on the magnitudes of a and b at their own width. Signed operands
+    // are handled by negating the coefficients of negative operands.
+
+    using local_wide_integer_type     = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_unsigned_wide_type    = uintwide_t<Width2, LimbType, AllocatorType, false>;
+    using local_signed_wide_type      = uintwide_t<Width2, LimbType, AllocatorType, true>;
+    using local_result_type           = extended_gcd_result<Width2, LimbType, AllocatorType, IsSigned>;
+
+    const auto a_is_neg = local_wide_integer_type::is_neg(a);
+    const auto b_is_neg = local_wide_integer_type::is_neg(b);
+
+    const local_unsigned_wide_type ua((!a_is_neg) ? a : -a);
+    const local_unsigned_wide_type ub((!b_is_neg) ? b : -b);
+
+    const auto swap_ab = (ua < ub);
+
+    local_unsigned_wide_type s_abs { };
+    local_unsigned_wide_type t_abs { };
+
+    auto t_is_neg = false;
+
+    const local_unsigned_wide_type
+      g
+      {
+        (!swap_ab) ? detail::extended_gcd_lehmer(ua, ub, &s_abs, &t_abs, t_is_neg)
+                   : detail::extended_gcd_lehmer(ub, ua, &s_abs, &t_abs, t_is_neg)
+      };
+
+    local_signed_wide_type s((!t_is_neg) ? local_signed_wide_type(-s_abs) : local_signed_wide_type(s_abs));
+    local_signed_wide_type t(( t_is_neg) ? local_signed_wide_type(-t_abs) : local_signed_wide_type(t_abs));
+
+    if(swap_ab)
+    {
+      swap(s, t);
+    }
+
+    if(a_is_neg) { s.negate(); }
+    if(b_is_neg) { t.negate(); }
+
+    return local_result_type { local_wide_integer_type(g), std::move(s), std::move(t) };
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto invmod(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                        const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate the inverse x of a modulo m > 1, having (x * a) % m = 1
+    // and 0 < x < m. Zero is returned if a has no inverse modulo m.
+    // Only the Bezout coefficient of a is tracked in the extended
+    // Lehmer GCD of m and a.
+
+    using local_wide_integer_type  = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_unsigned_wide_type = uintwide_t<Width2, LimbType, AllocatorType, false>;
+
+    const local_unsigned_wide_type um(m);
+
+    local_unsigned_wide_type ua { a };
+
+    if(local_wide_integer_type::is_neg(a))
+    {
+      ua = um - (local_unsigned_wide_type(-a) % um);
+    }
+
+    if(ua >= um)
+    {
+      ua %= um;
+    }
+
+    local_unsigned_wide_type x { };
+
+    auto x_is_neg = false;
+
+    const local_unsigned_wide_type g { detail::extended_gcd_lehmer(um, ua, static_cast<local_unsigned_wide_type*>(nullptr), &x, x_is_neg) };
+
+    if(g != static_cast<unsigned>(UINT8_C(1)))
+    {
+      return local_wide_integer_type { static_cast<unsigned>(UINT8_C(0)) };
+    }
+
+    if(x_is_neg && (x != static_cast<unsigned>(UINT8_C(0))))
+    {
+      x = um - x;
+    }
+
+    return local_wide_integer_type(x);
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto invmod_ct(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                           const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate the inverse of a modulo odd m > 1 for 0 <= a < m in
+    // constant time with respect to a. This is intended for secret
+    // values such as the nonces of signatures. The modulus is treated
+    // as public. Zero is returned if a has no inverse modulo m.
+
+    // This is the binary algorithm of N. Moeller (see GMP's
+    // mpn_sec_invert) with the invariants a = u * x and b = v * x
+    // (mod m) for the original x = a. In each step, the odd one of a
+    // and b is subtracted from the other, and a is halved. Since the
+    // sum of the bit lengths of a and b drops by at least one per step,
+    // a fixed 2 * bit_length(m) steps reduce a to zero and b to the
+    // GCD. All choices are made with masks, and not with branches.
+
+    using local_wide_integer_type  = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_unsigned_wide_type = uintwide_t<Width2, LimbType, AllocatorType, false>;
+    using local_limb_type          = typename local_unsigned_wide_type::limb_type;
+
+    const local_unsigned_wide_type um(m);
+
+    local_unsigned_wide_type ua(a);
+    local_unsigned_wide_type ub(um);
+    local_unsigned_wide_type uu { static_cast<unsigned>(UINT8_C(1)) };
+    local_unsigned_wide_type uv { static_cast<unsigned>(UINT8_C(0)) };
+
+    const auto step_count = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(msb(um) + 1U) * 2U);
+
+    for(auto step = static_cast<unsigned_fast_type>(UINT8_C(0)); step < step_count; ++step) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      const auto a_is_odd = (static_cast<local_limb_type>(*ua.crepresentation().cbegin() & static_cast<local_limb_type>(UINT8_C(1))) != static_cast<local_limb_type>(UINT8_C(0)));
+
+      // If a is odd and a < b, then swap a with b and u with v.
+      local_unsigned_wide_type a_minus_b { ua };
+
+      const auto a_is_less = (a_minus_b.conditional_subtract(ub, true) != static_cast<local_limb_type>(UINT8_C(0)));
+
+      const auto do_swap = (a_is_odd && a_is_less);
+
+      const local_unsigned_wide_type a_old { ua };
+      const local_unsigned_wide_type u_old { uu };
+
+      ua.conditional_select(ub, do_swap);
+      ub.conditional_select(a_old, do_swap);
+      uu.conditional_select(uv, do_swap);
+      uv.conditional_select(u_old, do_swap);
+
+      // If a is odd, then set a = a - b and u = (u - v) % m.
+      static_cast<void>(ua.conditional_subtract(ub, a_is_odd));
+
+      const auto borrow = uu.conditional_subtract(uv, a_is_odd);
+
+      static_cast<void>(uu.conditional_add(um, (borrow != static_cast<local_limb_type>(UINT8_C(0)))));
+
+      // Halve a, and halve u modulo m.
+      ua >>= 1U;
+
+      const auto u_is_odd = (static_cast<local_limb_type>(*uu.crepresentation().cbegin() & static_cast<local_limb_type>(UINT8_C(1))) != static_cast<local_limb_type>(UINT8_C(0)));
+
+      const auto carry = uu.conditional_add(um, u_is_odd);
+
+      uu >>= 1U;
+
+      uu.representation().back() =
+        static_cast<local_limb_type>
+        (
+            uu.crepresentation().back()
+          | static_cast<local_limb_type>(carry << static_cast<unsigned>(std::numeric_limits<local_limb_type>::digits - 1))
+        );
+    }
+
+    return ((ub == static_cast<unsigned>(UINT8_C(1))) ? local_wide_integer_type(uv) : local_wide_integer_type { static_cast<unsigned>(UINT8_C(0)) });
+  }
+
+  template<typename InputIterator,
+           typename OutputIterator,
+           typename ScratchIterator,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto batch_invmod(InputIterator                                                first,
+                              InputIterator                                                last,
+                              const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m,
+                              OutputIterator                                               out,
+                              ScratchIterator                                              scratch) -> bool
+  {
+    // Calculate the inverses modulo m of the elements 0 <= a_i < m in
+    // [first, last) and write these to out. Montgomery's trick finds
+    // all n inverses with one single inversion and 3 * (n - 1) modular
+    // multiplications. The prefix products a_0 * ... * a_i are stored
+    // in the caller-provided scratch range of n elements. The output
+    // may be the input range itself, or the scratch range.
+
+    // If the product of the elements has no inverse, then each element
+    // is inverted on its own, whereby elements having no inverse are
+    // set to zero. The return value tells whether all elements have
+    // an inverse.
 
-  namespace detail {
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_reducer_type      = barrett_reducer<Width2, LimbType, AllocatorType, IsSigned>;
 
-  // Use a local, constexpr, unsafe implementation of the abs-function.
-  template<typename ArithmeticType>
-  constexpr auto abs_unsafe(const ArithmeticType& val) -> ArithmeticType
-  {
-    if(val > static_cast<int>(INT8_C(0)))
+    const auto n = static_cast<unsigned_fast_type>(last - first);
+
+    if(n == static_cast<unsigned_fast_type>(UINT8_C(0)))
     {
-      return val;
+      return true;
     }
-    else // NOLINT(llvm-else-after-return,readability-else-after-return)
+
+    const local_reducer_type reducer(m);
+
+    *scratch = *first;
+
+    for(auto i = static_cast<unsigned_fast_type>(UINT8_C(1)); i < n; ++i)
     {
-      ArithmeticType val_unsigned { val };
+      *detail::advance_and_point(scratch, i) = reducer.mul_mod(*detail::advance_and_point(scratch, static_cast<unsigned_fast_type>(i - 1U)),
+                                                               *detail::advance_and_point(first,   i));
+    }
 
-      val_unsigned.negate();
+    local_wide_integer_type inv { invmod(*detail::advance_and_point(scratch, static_cast<unsigned_fast_type>(n - 1U)), m) };
 
-      return val_unsigned;
+    if(inv == static_cast<unsigned>(UINT8_C(0)))
+    {
+      for(auto i = static_cast<unsigned_fast_type>(UINT8_C(0)); i < n; ++i)
+      {
+        *detail::advance_and_point(out, i) = invmod(*detail::advance_and_point(first, i), m);
+      }
+
+      return false;
     }
-  }
 
-  template<typename IntegerType>
-  constexpr auto lcm_impl(const IntegerType& a, const IntegerType& b) -> IntegerType
-  {
-    using local_integer_type = IntegerType;
+    for(auto i = static_cast<unsigned_fast_type>(n - 1U); i > static_cast<unsigned_fast_type>(UINT8_C(0)); --i)
+    {
+      // Here, inv is the inverse of a_0 * ... * a_i. The inverse of a_i
+      // is inv * (a_0 * ... * a_(i - 1)), and a_i is read before the
+      // output is written, which allows for in-place operation.
 
-    const local_integer_type ap = detail::abs_unsafe(a);
-    const local_integer_type bp = detail::abs_unsafe(b);
+      local_wide_integer_type inv_a_i { reducer.mul_mod(inv, *detail::advance_and_point(scratch, static_cast<unsigned_fast_type>(i - 1U))) };
 
-    const auto a_is_greater_than_b = (ap > bp);
+      inv = reducer.mul_mod(inv, *detail::advance_and_point(first, i));
 
-    const auto gcd_of_ab = gcd(a, b);
+      *detail::advance_and_point(out, i) = std::move(inv_a_i);
+    }
 
-    return (a_is_greater_than_b ? ap * (bp / gcd_of_ab)
-                                : bp * (ap / gcd_of_ab));
-  }
+    *out = std::move(inv);
 
-  } // namespace detail
+    return true;
+  }
 
-  template<const size_t Width2,
+  template<typename InputIterator,
+           typename OutputIterator,
+           const size_t Width2,
            typename LimbType,
            typename AllocatorType,
            const bool IsSigned>
-  constexpr auto lcm(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
-                     const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<Width2, LimbType, AllocatorType, IsSigned>
+  constexpr auto batch_invmod(InputIterator                                                first,
+                              InputIterator                                                last,
+                              const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& m,
+                              OutputIterator                                               out) -> bool
   {
-    return detail::lcm_impl(a, b);
-  }
+    // Use the output range as the scratch range. The output
+    // may not be the input range in this case.
 
-  template<typename UnsignedShortType>
-  constexpr auto lcm(const UnsignedShortType& a, const UnsignedShortType& b) -> std::enable_if_t<(   std::is_integral<UnsignedShortType>::value
-                                                                                                  && std::is_unsigned<UnsignedShortType>::value), UnsignedShortType>
-  {
-    return detail::lcm_impl(a, b);
+    return batch_invmod(first, last, m, out, out);
   }
 
   template<const size_t Width2,
@@ -6729,6 +11935,158 @@
     return result;
   }
 
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto mul_wide(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& a,
+                          const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& b) -> uintwide_t<static_cast<size_t>(Width2 * static_cast<size_t>(UINT8_C(2))), LimbType, AllocatorType, IsSigned>
+  {
+    // Calculate the full product of a and b in the double-width type.
+    // This multiplies the n limbs of a and b to 2n limbs, whereas
+    // promoting a and b to the double-width type first would multiply
+    // 2n limbs by 2n limbs. If a and b are the same object, the product
+    // is computed with squaring.
+
+    using local_wide_integer_type  = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_unsigned_wide_type = uintwide_t<Width2, LimbType, AllocatorType, false>;
+    using local_double_width_type  = typename local_wide_integer_type::double_width_type;
+
+    const auto a_is_neg = local_wide_integer_type::is_neg(a);
+    const auto b_is_neg = local_wide_integer_type::is_neg(b);
+
+    local_unsigned_wide_type ua(a);
+
+    if(a_is_neg) { ua.negate(); }
+
+    local_double_width_type result { };
+
+    if(&a == &b)
+    {
+      local_unsigned_wide_type::eval_mul_wide(result.representation().begin(), ua, ua);
+    }
+    else
+    {
+      local_unsigned_wide_type ub(b);
+
+      if(b_is_neg) { ub.negate(); }
+
+      local_unsigned_wide_type::eval_mul_wide(result.representation().begin(), ua, ub);
+    }
+
+    if(a_is_neg != b_is_neg) { result.negate(); }
+
+    return result;
+  }
+
+  namespace detail {
+
+  template<const std::uintmax_t Divisor,
+           const size_t Width2,
+           const bool IsSigned>
+  constexpr auto constant_divisor_is_in_range() -> bool
+  {
+    // Query if the constant divisor can be represented in the value
+    // bits of a wide integer type having Width2 bits and signedness IsSigned.
+    constexpr auto value_digits = static_cast<int>(static_cast<int>(Width2) - (IsSigned ? static_cast<int>(INT8_C(1)) : static_cast<int>(INT8_C(0))));
+
+    constexpr auto uintmax_digits = std::numeric_limits<std::uintmax_t>::digits;
+
+    return
+    (
+         (value_digits >= uintmax_digits)
+      || (static_cast<std::uintmax_t>(Divisor >> static_cast<unsigned>((value_digits < uintmax_digits) ? value_digits : static_cast<int>(INT8_C(0)))) == static_cast<std::uintmax_t>(UINT8_C(0)))
+    );
+  }
+
+  } // namespace detail
+
+  template<const std::uintmax_t Divisor,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto div_by_constant(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::enable_if_t<(Divisor <= static_cast<std::uintmax_t>((std::numeric_limits<LimbType>::max)())), uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+  {
+    // Calculate x / Divisor for a constant divisor that fits in one limb.
+    // The reciprocal of the divisor is computed at compile time,
+    // such that the division only multiplies.
+
+    static_assert(Divisor != static_cast<std::uintmax_t>(UINT8_C(0)), "Error: The constant divisor must be nonzero");
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
+
+    constexpr limb_divisor<local_limb_type> divisor { static_cast<local_limb_type>(Divisor) };
+
+    const auto x_is_neg = local_wide_integer_type::is_neg(x);
+
+    local_wide_integer_type result((!x_is_neg) ? x : -x);
+
+    static_cast<void>(divisor.divide(result));
+
+    if(x_is_neg) { result.negate(); }
+
+    return result;
+  }
+
+  template<const std::uintmax_t Divisor,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto div_by_constant(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::enable_if_t<(Divisor >  static_cast<std::uintmax_t>((std::numeric_limits<LimbType>::max)())), uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+  {
+    // The constant divisor is wider than one limb. Use ordinary division.
+    // A divisor beyond the range of the type exceeds the magnitude of x,
+    // and it can not be represented, so the quotient is zero.
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    return (detail::constant_divisor_is_in_range<Divisor, Width2, IsSigned>() ? x / local_wide_integer_type(Divisor)
+                                                                               : local_wide_integer_type(static_cast<std::uint8_t>(UINT8_C(0))));
+  }
+
+  template<const std::uintmax_t Divisor,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto mod_by_constant(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::enable_if_t<(Divisor <= static_cast<std::uintmax_t>((std::numeric_limits<LimbType>::max)())), uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+  {
+    // Calculate x % Divisor for a constant divisor that fits in one limb.
+    // The remainder has the sign of x, as for the operator %.
+
+    static_assert(Divisor != static_cast<std::uintmax_t>(UINT8_C(0)), "Error: The constant divisor must be nonzero");
+
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+    using local_limb_type         = typename local_wide_integer_type::limb_type;
+
+    constexpr limb_divisor<local_limb_type> divisor { static_cast<local_limb_type>(Divisor) };
+
+    const auto x_is_neg = local_wide_integer_type::is_neg(x);
+
+    local_wide_integer_type result((!x_is_neg) ? divisor.remainder(x) : divisor.remainder(-x));
+
+    if(x_is_neg) { result.negate(); }
+
+    return result;
+  }
+
+  template<const std::uintmax_t Divisor,
+           const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  constexpr auto mod_by_constant(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& x) -> std::enable_if_t<(Divisor >  static_cast<std::uintmax_t>((std::numeric_limits<LimbType>::max)())), uintwide_t<Width2, LimbType, AllocatorType, IsSigned>>
+  {
+    // The constant divisor is wider than one limb. Use ordinary division.
+    // A divisor beyond the range of the type exceeds the magnitude of x,
+    // which is then the remainder.
+    using local_wide_integer_type = uintwide_t<Width2, LimbType, AllocatorType, IsSigned>;
+
+    return (detail::constant_divisor_is_in_range<Divisor, Width2, IsSigned>() ? x % local_wide_integer_type(Divisor) : x);
+  }
+
   template<const size_t Width2,
            typename LimbType,
            typename AllocatorType,
@@ -6947,6 +12305,142 @@
     friend constexpr auto operator!=(const uniform_int_distribution& lhs, const uniform_int_distribution& rhs) -> bool { return (lhs.param() != rhs.param()); }
   };
 
+  namespace detail {
+
+  template<typename ValueType>
+  constexpr auto miller_rabin_small_primes() -> array_detail::array<ValueType, static_cast<std::size_t>(UINT8_C(48))>
+  {
+    // Table[Prime[i], {i, 2, 49, 1}] =
+    // {
+    //     3,   5,   7,  11,  13,  17,  19,  23,
+    //    29,  31,  37,  41,  43,  47,  53,  59,
+    //    61,  67,  71,  73,  79,  83,  89,  97,
+    //   101, 103, 107, 109, 113, 127, 131, 137,
+    //   139, 149, 151, 157, 163, 167, 173, 179,
+    //   181, 191, 193, 197, 199, 211, 223, 227
+    // }
+    // See also:
+    // https://www.wolframalpha.com/input/?i=Table%5BPrime%5Bi%5D%2C+%7Bi%2C+2%2C+49%7D%5D
+
+    return
+    {
+      static_cast<ValueType>(UINT8_C(  3)), static_cast<ValueType>(UINT8_C(  5)), static_cast<ValueType>(UINT8_C(  7)), static_cast<ValueType>(UINT8_C( 11)), static_cast<ValueType>(UINT8_C( 13)), static_cast<ValueType>(UINT8_C( 17)), static_cast<ValueType>(UINT8_C( 19)), static_cast<ValueType>(UINT8_C( 23)),
+      static_cast<ValueType>(UINT8_C( 29)), static_cast<ValueType>(UINT8_C( 31)), static_cast<ValueType>(UINT8_C( 37)), static_cast<ValueType>(UINT8_C( 41)), static_cast<ValueType>(UINT8_C( 43)), static_cast<ValueType>(UINT8_C( 47)), static_cast<ValueType>(UINT8_C( 53)), static_cast<ValueType>(UINT8_C( 59)),
+      static_cast<ValueType>(UINT8_C( 61)), static_cast<ValueType>(UINT8_C( 67)), static_cast<ValueType>(UINT8_C( 71)), static_cast<ValueType>(UINT8_C( 73)), static_cast<ValueType>(UINT8_C( 79)), static_cast<ValueType>(UINT8_C( 83)), static_cast<ValueType>(UINT8_C( 89)), static_cast<ValueType>(UINT8_C( 97)),
+      static_cast<ValueType>(UINT8_C(101)), static_cast<ValueType>(UINT8_C(103)), static_cast<ValueType>(UINT8_C(107)), static_cast<ValueType>(UINT8_C(109)), static_cast<ValueType>(UINT8_C(113)), static_cast<ValueType>(UINT8_C(127)), static_cast<ValueType>(UINT8_C(131)), static_cast<ValueType>(UINT8_C(137)),
+      static_cast<ValueType>(UINT8_C(139)), static_cast<ValueType>(UINT8_C(149)), static_cast<ValueType>(UINT8_C(151)), static_cast<ValueType>(UINT8_C(157)), static_cast<ValueType>(UINT8_C(163)), static_cast<ValueType>(UINT8_C(167)), static_cast<ValueType>(UINT8_C(173)), static_cast<ValueType>(UINT8_C(179)),
+      static_cast<ValueType>(UINT8_C(181)), static_cast<ValueType>(UINT8_C(191)), static_cast<ValueType>(UINT8_C(193)), static_cast<ValueType>(UINT8_C(197)), static_cast<ValueType>(UINT8_C(199)), static_cast<ValueType>(UINT8_C(211)), static_cast<ValueType>(UINT8_C(223)), static_cast<ValueType>(UINT8_C(227))
+    };
+  }
+
+  constexpr auto miller_rabin_small_prime_group_last(const std::size_t first) -> std::size_t
+  {
+    // Find the end of the group of small primes that begins at the
+    // index first. The group grows as long as the product of its
+    // primes stays below 2^32.
+
+    constexpr auto primes = miller_rabin_small_primes<std::uint64_t>();
+
+    auto product = static_cast<std::uint64_t>(UINT8_C(1));
+    auto last    = first;
+
+    while((last < primes.size()) && (static_cast<std::uint64_t>(product * primes[last]) <= static_cast<std::uint64_t>(UINT32_MAX))) // NOLINT(altera-id-dependent-backward-branch)
+    {
+      product = static_cast<std::uint64_t>(product * primes[last]);
+
+      ++last;
+    }
+
+    return last;
+  }
+
+  constexpr auto miller_rabin_small_prime_group_product(const std::size_t first, const std::size_t last) -> std::uint32_t
+  {
+    constexpr auto primes = miller_rabin_small_primes<std::uint32_t>();
+
+    auto product = static_cast<std::uint32_t>(UINT8_C(1));
+
+    for(auto i = first; i < last; ++i)
+    {
+      product = static_cast<std::uint32_t>(product * primes[i]);
+    }
+
+    return product;
+  }
+
+  template<const std::size_t First,
+           const bool IsEnd = (First == miller_rabin_small_primes<std::uint32_t>().size())>
+  struct miller_rabin_small_prime_groups
+  {
+    template<typename WideIntegerType>
+    static auto has_factor(const WideIntegerType& np) -> bool
+    {
+      // The remainder of np by the product of the primes of this group
+      // is obtained with one pass of division by a constant. The
+      // remainders by the primes of the group follow from it in 32-bit
+      // arithmetic.
+
+      constexpr auto last    = miller_rabin_small_prime_group_last(First);
+      constexpr auto product = miller_rabin_small_prime_group_product(First, last);
+      constexpr auto primes  = miller_rabin_small_primes<std::uint32_t>();
+
+      const auto r = static_cast<std::uint32_t>(mod_by_constant<static_cast<std::uintmax_t>(product)>(np));
+
+      for(auto i = First; i < last; ++i)
+      {
+        if(static_cast<std::uint32_t>(r % primes[i]) == static_cast<std::uint32_t>(UINT8_C(0)))
+        {
+          return true;
+        }
+      }
+
+      return miller_rabin_small_prime_groups<last>::has_factor(np);
+    }
+  };
+
+  template<const std::size_t First>
+  struct miller_rabin_small_prime_groups<First, true>
+  {
+    template<typename WideIntegerType>
+    static auto has_factor(const WideIntegerType&) -> bool { return false; }
+  };
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  auto miller_rabin_has_small_factor(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& np) -> std::enable_if_t<(Width2 >= static_cast<size_t>(UINT8_C(32))), bool>
+  {
+    // Test the small primes in groups whose products lie below 2^32.
+    return miller_rabin_small_prime_groups<static_cast<std::size_t>(UINT8_C(0))>::has_factor(np);
+  }
+
+  template<const size_t Width2,
+           typename LimbType,
+           typename AllocatorType,
+           const bool IsSigned>
+  auto miller_rabin_has_small_factor(const uintwide_t<Width2, LimbType, AllocatorType, IsSigned>& np) -> std::enable_if_t<(Width2 < static_cast<size_t>(UINT8_C(32))), bool>
+  {
+    // The group products do not fit in narrow types.
+    // Test the small primes one by one.
+
+    using local_limb_type = typename uintwide_t<Width2, LimbType, AllocatorType, IsSigned>::limb_type;
+
+    constexpr auto small_primes = miller_rabin_small_primes<local_limb_type>();
+
+    for(const auto& small_p : small_primes)
+    {
+      if(static_cast<local_limb_type>(np % small_p) == static_cast<local_limb_type>(UINT8_C(0)))
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  } // namespace detail
+
   template<typename DistributionType,
            typename GeneratorType,
            const size_t Width2,
@@ -6971,27 +12465,7 @@
 
     const local_wide_integer_type np((!local_wide_integer_type::is_neg(n)) ? n : -n);
 
-    // Table[Prime[i], {i, 2, 49, 1}] =
-    // {
-    //     3,   5,   7,  11,  13,  17,  19,  23,
-    //    29,  31,  37,  41,  43,  47,  53,  59,
-    //    61,  67,  71,  73,  79,  83,  89,  97,
-    //   101, 103, 107, 109, 113, 127, 131, 137,
-    //   139, 149, 151, 157, 163, 167, 173, 179,
-    //   181, 191, 193, 197, 199, 211, 223, 227
-    // }
-    // See also:
-    // https://www.wolframalpha.com/input/?i=Table%5BPrime%5Bi%5D%2C+%7Bi%2C+2%2C+49%7D%5D
-
-    constexpr detail::array_detail::array<local_limb_type, static_cast<std::size_t>(UINT8_C(48))> small_primes =
-    {
-      static_cast<local_limb_type>(UINT8_C(  3)), static_cast<local_limb_type>(UINT8_C(  5)), static_cast<local_limb_type>(UINT8_C(  7)), static_cast<local_limb_type>(UINT8_C( 11)), static_cast<local_limb_type>(UINT8_C( 13)), static_cast<local_limb_type>(UINT8_C( 17)), static_cast<local_limb_type>(UINT8_C( 19)), static_cast<local_limb_type>(UINT8_C( 23)),
-      static_cast<local_limb_type>(UINT8_C( 29)), static_cast<local_limb_type>(UINT8_C( 31)), static_cast<local_limb_type>(UINT8_C( 37)), static_cast<local_limb_type>(UINT8_C( 41)), static_cast<local_limb_type>(UINT8_C( 43)), static_cast<local_limb_type>(UINT8_C( 47)), static_cast<local_limb_type>(UINT8_C( 53)), static_cast<local_limb_type>(UINT8_C( 59)),
-      static_cast<local_limb_type>(UINT8_C( 61)), static_cast<local_limb_type>(UINT8_C( 67)), static_cast<local_limb_type>(UINT8_C( 71)), static_cast<local_limb_type>(UINT8_C( 73)), static_cast<local_limb_type>(UINT8_C( 79)), static_cast<local_limb_type>(UINT8_C( 83)), static_cast<local_limb_type>(UINT8_C( 89)), static_cast<local_limb_type>(UINT8_C( 97)),
-      static_cast<local_limb_type>(UINT8_C(101)), static_cast<local_limb_type>(UINT8_C(103)), static_cast<local_limb_type>(UINT8_C(107)), static_cast<local_limb_type>(UINT8_C(109)), static_cast<local_limb_type>(UINT8_C(113)), static_cast<local_limb_type>(UINT8_C(127)), static_cast<local_limb_type>(UINT8_C(131)), static_cast<local_limb_type>(UINT8_C(137)),
-      static_cast<local_limb_type>(UINT8_C(139)), static_cast<local_limb_type>(UINT8_C(149)), static_cast<local_limb_type>(UINT8_C(151)), static_cast<local_limb_type>(UINT8_C(157)), static_cast<local_limb_type>(UINT8_C(163)), static_cast<local_limb_type>(UINT8_C(167)), static_cast<local_limb_type>(UINT8_C(173)), static_cast<local_limb_type>(UINT8_C(179)),
-      static_cast<local_limb_type>(UINT8_C(181)), static_cast<local_limb_type>(UINT8_C(191)), static_cast<local_limb_type>(UINT8_C(193)), static_cast<local_limb_type>(UINT8_C(197)), static_cast<local_limb_type>(UINT8_C(199)), static_cast<local_limb_type>(UINT8_C(211)), static_cast<local_limb_type>(UINT8_C(223)), static_cast<local_limb_type>(UINT8_C(227))
-    };
+    constexpr auto small_primes = detail::miller_rabin_small_primes<local_limb_type>();
 
     {
       // Handle even numbers.
@@ -7049,23 +12523,12 @@
       }
 
       // Handle numbers divisible by small primes in the small_primes table.
-      bool is_small_prime_divisible { false };
 
-      for(const auto& small_p : small_primes)
-      {
-        // The following test does not include the secondary query
-        // if (np == small_p). This is OK here because exact small
-        // primes have already been filtered out above.
-
-        if(static_cast<local_limb_type>(np % small_p) == static_cast<local_limb_type>(UINT8_C(0)))
-        {
-          is_small_prime_divisible = true;
-
-          break;
-        }
-      }
+      // The following test does not include the secondary query
+      // if (np == small_p). This is OK here because exact small
+      // primes have already been filtered out above.
 
-      if(is_small_prime_divisible)
+      if(detail::miller_rabin_has_small_factor(np))
       {
         return false;
       }
@@ -7156,11 +12619,7 @@
         }
 
         // Compute y = y^2 mod np.
-        {
-          const local_double_width_type y_dbl { static_cast<local_double_width_type>(y) };
-
-          y = static_cast<local_wide_integer_type>((y_dbl * y_dbl) % np_dbl);
-        }
+        y = static_cast<local_wide_integer_type>(mul_wide(y, y) % np_dbl);
 
         // If we reach the final iteration without hitting nm1,
         // then the candidate is not prime.
@@ -7882,6 +13341,31 @@
     return out;
   }
 
+  // The compile-time value of a wide-integer constant given as a string
+  // (hexadecimal with 0x, octal with 0 or decimal). The string is parsed
+  // once during compilation and the result is a single static object.
+  // Returning a reference to value, as in
+  //   from_string_constant<uint256_t, MyPrime>::value,
+  // does not parse the string again on each use, which a constexpr
+  // function that constructs the integer from the string would do
+  // when it is called at run time. StrValue must point to a char array
+  // with static storage duration, such as a namespace-scope constexpr
+  // char array, and WideIntegerType must have a void allocator.
+  template<typename WideIntegerType,
+           const char* StrValue>
+  struct from_string_constant
+  {
+    using value_type = WideIntegerType;
+
+    static constexpr value_type value { StrValue };
+  };
+
+  #if(__cplusplus < 201703L)
+  template<typename WideIntegerType,
+           const char* StrValue>
+  constexpr typename from_string_constant<WideIntegerType, StrValue>::value_type from_string_constant<WideIntegerType, StrValue>::value;
+  #endif
+
   #if(__cplusplus >= 201703L)
   } // namespace math::wide_integer
   #else
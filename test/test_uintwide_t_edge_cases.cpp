@@ -5,9 +5,14 @@
 //  or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 
+#include <algorithm>
+#include <array>
 #include <charconv>
+#include <memory>
 #include <random>
+#include <sstream>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <math/wide_integer/uintwide_t.h>
@@ -85,6 +90,32 @@
   #endif
 #endif
 
+WIDE_INTEGER_NAMESPACE_BEGIN
+
+#if(__cplusplus >= 201703L)
+namespace math::wide_integer {
+#else
+namespace math { namespace wide_integer { // NOLINT(modernize-concat-nested-namespaces)
+#endif
+
+// Lower the NTT threshold of one narrow type having a void allocator,
+// so that the NTT multiplication is tested without an allocator, too.
+template<>
+struct multiplication_traits<static_cast<size_t>(UINT16_C(6144)), std::uint16_t, void, false>
+  : public multiplication_traits_default
+{
+  static constexpr size_t number_of_limbs_ntt_threshold { static_cast<size_t>(UINT8_C(64)) };
+};
+
+#if(__cplusplus >= 201703L)
+} // namespace math::wide_integer
+#else
+} // namespace wide_integer
+} // namespace math
+#endif
+
+WIDE_INTEGER_NAMESPACE_END
+
 auto local_inf_f () -> float;
 auto local_inf_d () -> double;
 auto local_inf_ld() -> long double;
@@ -308,6 +339,28 @@ auto generate_wide_integer_value(bool       is_positive           = true,
   return local_integral_type(str_x.c_str());
 }
 
+auto generate_hex_string(std::size_t digit_count) -> std::string;
+
+auto generate_hex_string(std::size_t digit_count) -> std::string
+{
+  // Generate a string of digit_count random, nonzero lowercase hexadecimal
+  // digits having the prefix 0x. This can be read both by uintwide_t
+  // and by the cpp_int of Boost.Multiprecision.
+
+  std::string str(digit_count, '0');
+
+  std::generate(str.begin(),
+                str.end(),
+                []() // NOLINT(modernize-use-trailing-return-type,-warnings-as-errors)
+                {
+                  const auto dig = static_cast<char>(dist_dig_hex()(eng_dig()));
+
+                  return static_cast<char>((dig < static_cast<char>(INT8_C(10))) ? static_cast<char>(dig + '0') : static_cast<char>(static_cast<char>(dig + 'a') - static_cast<char>(INT8_C(10))));
+                });
+
+  return std::string("0x" + str);
+}
+
 #if !defined(UINTWIDE_T_REDUCE_TEST_DEPTH)
 auto test_various_edge_operations() -> bool;
 
@@ -2842,6 +2895,256 @@ namespace from_pr_454
   }
 } // namespace from_pr_454
 
+namespace decimal_output
+{
+  template<typename UnsignedType,
+           typename SignedType>
+  auto test_dec_output_of_width() -> bool;
+
+  template<typename UnsignedType,
+           typename SignedType>
+  auto test_dec_output_of_width() -> bool // LCOV_EXCL_LINE
+  {
+    // Check the decimal output of unsigned and signed values having
+    // enough limbs for the recursive digit extraction against cpp_int.
+    // Use to_string, the stream with showpos, uppercase and showbase,
+    // and to_chars. Read each decimal string back in.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::to_string;
+    #else
+    using ::math::wide_integer::to_string;
+    #endif
+
+    using local_cpp_int_type = boost::multiprecision::cpp_int;
+
+    constexpr auto digits2 = static_cast<unsigned>(std::numeric_limits<UnsignedType>::digits);
+
+    static_assert(static_cast<unsigned>(digits2 / static_cast<unsigned>(std::numeric_limits<typename UnsignedType::limb_type>::digits)) >= static_cast<unsigned>(UnsignedType::number_of_limbs_dec_recursive_threshold),
+                  "Error: The width must reach the recursive decimal conversion");
+
+    const local_cpp_int_type two_pow_digits2 { local_cpp_int_type(1) << digits2 };
+
+    bool result_is_ok { true };
+
+    const auto check =
+      [&result_is_ok, &two_pow_digits2](const UnsignedType& u, const local_cpp_int_type& u_cp)
+      {
+        const SignedType s { u };
+
+        const local_cpp_int_type s_cp { (u_cp >= (two_pow_digits2 >> 1U)) ? local_cpp_int_type(u_cp - two_pow_digits2) : u_cp };
+
+        const std::string str_u { u_cp.str() };
+        const std::string str_s { s_cp.str() };
+
+        result_is_ok = ((to_string(u) == str_u) && result_is_ok);
+        result_is_ok = ((to_string(s) == str_s) && result_is_ok);
+
+        result_is_ok = ((UnsignedType(str_u.c_str()) == u) && result_is_ok);
+        result_is_ok = ((SignedType  (str_s.c_str()) == s) && result_is_ok);
+
+        std::stringstream strm_u { };
+        std::stringstream strm_s { };
+
+        strm_u << std::showpos << std::uppercase << std::showbase << u;
+        strm_s << std::showpos << std::uppercase << std::showbase << s;
+
+        result_is_ok = ((strm_u.str() == ("+" + str_u))                                     && result_is_ok);
+        result_is_ok = ((strm_s.str() == ((s_cp < 0) ? str_s : std::string("+" + str_s))) && result_is_ok);
+
+        #if (defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L))
+        std::vector<char> arr_dec(static_cast<std::size_t>(SignedType::wr_string_max_buffer_size_dec()), '\0');
+
+        using std::to_chars;
+
+        const auto result_dec_as_chars = to_chars(arr_dec.data(), arr_dec.data() + arr_dec.size(), s, 10);
+
+        result_is_ok = (((result_dec_as_chars.ec == std::errc()) && (std::string(arr_dec.data()) == str_s)) && result_is_ok);
+        #endif
+      };
+
+    const std::size_t hex_digit_count { static_cast<std::size_t>(digits2 / 4U) };
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(4)); ++i)
+    {
+      // Full-width values use all of the limbs.
+      const std::string str_full { generate_hex_string(hex_digit_count) };
+
+      check(UnsignedType(str_full.c_str()), local_cpp_int_type(str_full));
+
+      // Values with long runs of zero limbs between the high and low parts.
+      const std::string str_hi { generate_hex_string(static_cast<std::size_t>(hex_digit_count / 16U)) };
+      const std::string str_lo { generate_hex_string(static_cast<std::size_t>(UINT8_C(24))) };
+
+      const auto shift = static_cast<unsigned>(digits2 - static_cast<unsigned>(static_cast<unsigned>(digits2 / 16U) + static_cast<unsigned>(i * 64U)));
+
+      check((UnsignedType(str_hi.c_str()) << shift) | UnsignedType(str_lo.c_str()),
+            (local_cpp_int_type(str_hi) << shift) | local_cpp_int_type(str_lo));
+    }
+
+    // A power of ten has a run of zero decimal digits across the splits.
+    const auto p10 = static_cast<unsigned>(static_cast<unsigned>(digits2 * 3U) / 10U);
+
+    check(pow(UnsignedType(10U), p10), boost::multiprecision::pow(local_cpp_int_type(10), p10));
+
+    // Zero, one below the minimum negative value (the maximum), and the minimum negative value.
+    check(UnsignedType(0U), local_cpp_int_type(0));
+    check((std::numeric_limits<UnsignedType>::max)(), two_pow_digits2 - 1);
+    check(UnsignedType((std::numeric_limits<SignedType>::min)()), two_pow_digits2 >> 1U);
+
+    return result_is_ok;
+  }
+
+  auto test_dec_output() -> bool;
+
+  auto test_dec_output() -> bool // LCOV_EXCL_LINE
+  {
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t;
+    using local_size_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t;
+    #else
+    using ::math::wide_integer::uintwide_t;
+    using local_size_type = ::math::wide_integer::size_t;
+    #endif
+
+    using local_uint16384_t = uintwide_t<static_cast<local_size_type>(UINT32_C(16384)), std::uint32_t, void, false>;
+    using local_int16384_t  = uintwide_t<static_cast<local_size_type>(UINT32_C(16384)), std::uint32_t, void, true>;
+
+    using local_uint8192_t  = uintwide_t<static_cast<local_size_type>(UINT32_C(8192)), std::uint16_t, void, false>;
+    using local_int8192_t   = uintwide_t<static_cast<local_size_type>(UINT32_C(8192)), std::uint16_t, void, true>;
+
+    bool result_is_ok { true };
+
+    result_is_ok = (test_dec_output_of_width<local_uint16384_t, local_int16384_t>() && result_is_ok);
+    result_is_ok = (test_dec_output_of_width<local_uint8192_t,  local_int8192_t> () && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace decimal_output
+
+namespace decimal_input
+{
+  template<typename UnsignedType,
+           typename SignedType>
+  auto test_dec_input_of_width() -> bool;
+
+  template<typename UnsignedType,
+           typename SignedType>
+  auto test_dec_input_of_width() -> bool // LCOV_EXCL_LINE
+  {
+    // Check the reading of decimal strings long enough for the
+    // recursive reading against cpp_int. Include apostrophes,
+    // a leading minus sign, invalid characters and inputs having
+    // more digits than digits10, which wrap modulo 2^digits2.
+
+    using local_cpp_int_type = boost::multiprecision::cpp_int;
+
+    constexpr auto digits2 = static_cast<unsigned>(std::numeric_limits<UnsignedType>::digits);
+
+    const local_cpp_int_type two_pow_digits2 { local_cpp_int_type(1) << digits2 };
+
+    const auto is_equal =
+      [](const UnsignedType& u, const local_cpp_int_type& u_cp)
+      {
+        std::stringstream strm_u_wi { };
+        std::stringstream strm_u_cp { };
+
+        strm_u_wi << std::hex << u;
+        strm_u_cp << std::hex << u_cp;
+
+        return (strm_u_wi.str() == strm_u_cp.str());
+      };
+
+    bool result_is_ok { true };
+
+    const std::size_t hex_digit_count { static_cast<std::size_t>(digits2 / 4U) };
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(4)); ++i)
+    {
+      // Get pseudo-random decimal strings from the hexadecimal ones.
+      const local_cpp_int_type u_cp { generate_hex_string(static_cast<std::size_t>(hex_digit_count - static_cast<std::size_t>(i * 97U))) };
+
+      const std::string str_dec { u_cp.str() };
+
+      result_is_ok = (is_equal(UnsignedType(str_dec.c_str()), u_cp) && result_is_ok);
+
+      // Apostrophes may lead and may be embedded anywhere, also in a row.
+      std::string str_apos { "'" };
+
+      for(std::size_t n = static_cast<std::size_t>(UINT8_C(0)); n < str_dec.length(); ++n)
+      {
+        str_apos += str_dec[n];
+
+        if((n % static_cast<std::size_t>(static_cast<std::size_t>(i) + static_cast<std::size_t>(UINT8_C(3)))) == static_cast<std::size_t>(UINT8_C(0)))
+        {
+          str_apos += ((i == 1U) ? "''" : "'");
+        }
+      }
+
+      result_is_ok = (is_equal(UnsignedType(str_apos.c_str()), u_cp) && result_is_ok);
+
+      // A leading minus sign negates, modulo 2^digits2 for unsigned types.
+      const std::string str_neg { "-" + str_apos };
+
+      result_is_ok = (is_equal(UnsignedType(str_neg.c_str()), (two_pow_digits2 - u_cp) % two_pow_digits2) && result_is_ok);
+      result_is_ok = ((SignedType(str_neg.c_str()) == -SignedType(str_dec.c_str())) && result_is_ok);
+
+      // An invalid character makes the whole input invalid.
+      std::string str_bad { str_dec };
+
+      str_bad[static_cast<std::size_t>(str_bad.length() / static_cast<std::size_t>(i + 2U))] = ((i == 2U) ? 'a' : ((i == 3U) ? ' ' : '.'));
+
+      result_is_ok = ((UnsignedType(str_bad.c_str()) == (std::numeric_limits<UnsignedType>::max)()) && result_is_ok);
+
+      #if (defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L))
+      UnsignedType u_from_chars { };
+
+      const auto result_from_chars = from_chars(str_bad.c_str(), str_bad.c_str() + str_bad.length(), u_from_chars, 10);
+
+      result_is_ok = ((result_from_chars.ec != std::errc()) && result_is_ok);
+      #endif
+
+      // Inputs with more digits than digits10 wrap modulo 2^digits2.
+      const local_cpp_int_type v_cp { generate_hex_string(static_cast<std::size_t>(static_cast<std::size_t>(hex_digit_count * 2U) + static_cast<std::size_t>(i * 131U))) };
+
+      const std::string str_long { ((i == 0U) ? std::string("+") : std::string()) + v_cp.str() };
+
+      result_is_ok = ((str_long.length() > static_cast<std::size_t>(std::numeric_limits<UnsignedType>::digits10)) && result_is_ok);
+
+      result_is_ok = (is_equal(UnsignedType(str_long.c_str()), v_cp % two_pow_digits2) && result_is_ok);
+      result_is_ok = ((UnsignedType(str_long.c_str()) == UnsignedType(local_cpp_int_type(v_cp % two_pow_digits2).str().c_str())) && result_is_ok);
+    }
+
+    return result_is_ok;
+  }
+
+  auto test_dec_input() -> bool;
+
+  auto test_dec_input() -> bool // LCOV_EXCL_LINE
+  {
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t;
+    using local_size_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t;
+    #else
+    using ::math::wide_integer::uintwide_t;
+    using local_size_type = ::math::wide_integer::size_t;
+    #endif
+
+    using local_uint16384_t = uintwide_t<static_cast<local_size_type>(UINT32_C(16384)), std::uint32_t, void, false>;
+    using local_int16384_t  = uintwide_t<static_cast<local_size_type>(UINT32_C(16384)), std::uint32_t, void, true>;
+
+    using local_uint8192_t  = uintwide_t<static_cast<local_size_type>(UINT32_C(8192)), std::uint16_t, void, false>;
+    using local_int8192_t   = uintwide_t<static_cast<local_size_type>(UINT32_C(8192)), std::uint16_t, void, true>;
+
+    bool result_is_ok { true };
+
+    result_is_ok = (test_dec_input_of_width<local_uint16384_t, local_int16384_t>() && result_is_ok);
+    result_is_ok = (test_dec_input_of_width<local_uint8192_t,  local_int8192_t> () && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace decimal_input
+
 namespace karatsuba_squaring
 {
   namespace detail
@@ -2922,6 +3225,1662 @@ namespace karatsuba_squaring
   }
 } // namespace karatsuba_squaring
 
+namespace ntt_multiplication
+{
+  namespace detail
+  {
+    auto test_one_ntt_mul() -> bool;
+
+    auto test_one_ntt_mul() -> bool
+    {
+      // Use 2^18 bits, which (with 32-bit limbs) is at the threshold of NTT multiplication.
+      constexpr auto hex_digit_count = static_cast<std::size_t>(UINT32_C(65536));
+
+      #if defined(WIDE_INTEGER_NAMESPACE)
+      using local_limb_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uint_defaultlimb_t;
+      using local_size_t = WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t;
+      using wi_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<local_size_t>(hex_digit_count * 4U), local_limb_type, std::allocator<local_limb_type>>;
+      #else
+      using local_limb_type = ::math::wide_integer::uint_defaultlimb_t;
+      using local_size_t = ::math::wide_integer::size_t;
+      using wi_type = ::math::wide_integer::uintwide_t<static_cast<local_size_t>(hex_digit_count * 4U), local_limb_type, std::allocator<local_limb_type>>;
+      #endif
+
+      const std::string str_a { generate_hex_string(hex_digit_count) };
+      const std::string str_b { generate_hex_string(hex_digit_count) };
+
+      const wi_type a_wi { str_a.c_str() };
+      const wi_type b_wi { str_b.c_str() };
+
+      wi_type c_wi { a_wi * b_wi };
+      wi_type d_wi { a_wi };
+
+      d_wi *= d_wi;
+
+      const boost::multiprecision::cpp_int a_cp { str_a };
+      const boost::multiprecision::cpp_int b_cp { str_b };
+
+      const boost::multiprecision::cpp_int mask_cp { (boost::multiprecision::cpp_int(1) << static_cast<unsigned>(hex_digit_count * 4U)) - 1 };
+
+      const boost::multiprecision::cpp_int c_cp { (a_cp * b_cp) & mask_cp };
+      const boost::multiprecision::cpp_int d_cp { (a_cp * a_cp) & mask_cp };
+
+      std::stringstream strm_c_wi { };
+      std::stringstream strm_c_cp { };
+      std::stringstream strm_d_wi { };
+      std::stringstream strm_d_cp { };
+
+      strm_c_wi << std::hex << c_wi;
+      strm_c_cp << std::hex << c_cp;
+      strm_d_wi << std::hex << d_wi;
+      strm_d_cp << std::hex << d_cp;
+
+      const bool result_is_ok { (strm_c_wi.str() == strm_c_cp.str()) && (strm_d_wi.str() == strm_d_cp.str()) };
+
+      return result_is_ok;
+    }
+  } // namespace detail
+
+  auto test_ntt_mul() -> bool;
+
+  auto test_ntt_mul() -> bool // LCOV_EXCL_LINE
+  {
+    bool result_is_ok { true };
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(2)); ++i)
+    {
+      result_is_ok = (detail::test_one_ntt_mul() && result_is_ok);
+    }
+
+    return result_is_ok;
+  }
+
+  auto test_ntt_mul_void_alloc() -> bool;
+
+  auto test_ntt_mul_void_alloc() -> bool // LCOV_EXCL_LINE
+  {
+    // The type with the void allocator has a lowered NTT threshold
+    // (see its multiplication_traits above). Its NTT products, squares
+    // and widening products are checked against those of the same type
+    // with std::allocator, which multiplies with Toom-3 or Karatsuba.
+
+    constexpr auto hex_digit_count = static_cast<std::size_t>(UINT16_C(1536));
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using local_size_t = WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t;
+    using ntt_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<local_size_t>(hex_digit_count * 4U), std::uint16_t, void, false>;
+    using ctl_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<local_size_t>(hex_digit_count * 4U), std::uint16_t, std::allocator<void>, false>;
+    #else
+    using local_size_t = ::math::wide_integer::size_t;
+    using ntt_type = ::math::wide_integer::uintwide_t<static_cast<local_size_t>(hex_digit_count * 4U), std::uint16_t, void, false>;
+    using ctl_type = ::math::wide_integer::uintwide_t<static_cast<local_size_t>(hex_digit_count * 4U), std::uint16_t, std::allocator<void>, false>;
+    #endif
+
+    const auto to_hex =
+      [](const auto& x) -> std::string
+      {
+        std::stringstream strm { };
+
+        strm << std::hex << x;
+
+        return strm.str();
+      };
+
+    bool result_is_ok { true };
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(4)); ++i)
+    {
+      const std::string str_a { generate_hex_string(hex_digit_count) };
+      const std::string str_b { generate_hex_string(static_cast<std::size_t>(hex_digit_count - static_cast<std::size_t>(i * 100U))) };
+
+      const ntt_type a_ntt { str_a.c_str() };
+      const ntt_type b_ntt { str_b.c_str() };
+      const ctl_type a_ctl { str_a.c_str() };
+      const ctl_type b_ctl { str_b.c_str() };
+
+      ntt_type d_ntt { a_ntt };
+      ctl_type d_ctl { a_ctl };
+
+      d_ntt *= d_ntt;
+      d_ctl *= d_ctl;
+
+      result_is_ok = ((to_hex(a_ntt * b_ntt)          == to_hex(a_ctl * b_ctl))          && result_is_ok);
+      result_is_ok = ((to_hex(d_ntt)                  == to_hex(d_ctl))                  && result_is_ok);
+      result_is_ok = ((to_hex(mul_wide(a_ntt, b_ntt)) == to_hex(mul_wide(a_ctl, b_ctl))) && result_is_ok);
+      result_is_ok = ((to_hex(mul_wide(a_ntt, a_ntt)) == to_hex(mul_wide(a_ctl, a_ctl))) && result_is_ok);
+    }
+
+    return result_is_ok;
+  }
+} // namespace ntt_multiplication
+
+namespace toom3_multiplication
+{
+  namespace detail
+  {
+    template<const std::size_t LimbCount>
+    auto test_toom3_mul_of_limb_count() -> bool;
+
+    template<const std::size_t LimbCount>
+    auto test_toom3_mul_of_limb_count() -> bool
+    {
+      // Multiply balanced, unbalanced and sparse operands having LimbCount
+      // limbs of 32 bits, and square them, checking against cpp_int.
+
+      constexpr auto hex_digit_count = static_cast<std::size_t>(LimbCount * 8U);
+
+      #if defined(WIDE_INTEGER_NAMESPACE)
+      using local_size_t = WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t;
+      using wi_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<local_size_t>(hex_digit_count * 4U), std::uint32_t>;
+      #else
+      using local_size_t = ::math::wide_integer::size_t;
+      using wi_type = ::math::wide_integer::uintwide_t<static_cast<local_size_t>(hex_digit_count * 4U), std::uint32_t>;
+      #endif
+
+      const boost::multiprecision::cpp_int mask_cp { (boost::multiprecision::cpp_int(1) << static_cast<unsigned>(hex_digit_count * 4U)) - 1 };
+
+      const auto check =
+        [&mask_cp](const std::string& str_a, const std::string& str_b)
+        {
+          const wi_type a_wi { str_a.c_str() };
+          const wi_type b_wi { str_b.c_str() };
+
+          const wi_type c_wi { a_wi * b_wi };
+          const wi_type d_wi { a_wi * a_wi };
+
+          const boost::multiprecision::cpp_int a_cp { str_a };
+          const boost::multiprecision::cpp_int b_cp { str_b };
+
+          const boost::multiprecision::cpp_int c_cp { (a_cp * b_cp) & mask_cp };
+          const boost::multiprecision::cpp_int d_cp { (a_cp * a_cp) & mask_cp };
+
+          std::stringstream strm_c_wi { };
+          std::stringstream strm_c_cp { };
+          std::stringstream strm_d_wi { };
+          std::stringstream strm_d_cp { };
+
+          strm_c_wi << std::hex << c_wi;
+          strm_c_cp << std::hex << c_cp;
+          strm_d_wi << std::hex << d_wi;
+          strm_d_cp << std::hex << d_cp;
+
+          return ((strm_c_wi.str() == strm_c_cp.str()) && (strm_d_wi.str() == strm_d_cp.str()));
+        };
+
+      const std::string str_full  { generate_hex_string(hex_digit_count) };
+      const std::string str_short { generate_hex_string(static_cast<std::size_t>(hex_digit_count / 5U)) };
+      const std::string str_limb  { generate_hex_string(static_cast<std::size_t>(UINT8_C(8))) };
+      const std::string str_max   { "0x" + std::string(hex_digit_count, 'f') };
+
+      // Sparse operands have nonzero limbs only at the ends, or in stripes.
+      const std::string str_ends
+      {
+          generate_hex_string(static_cast<std::size_t>(UINT8_C(8)))
+        + std::string(static_cast<std::size_t>(hex_digit_count - static_cast<std::size_t>(UINT8_C(16))), '0')
+        + generate_hex_string(static_cast<std::size_t>(UINT8_C(8))).substr(static_cast<std::size_t>(UINT8_C(2)))
+      };
+
+      std::string str_stripes { "0x" };
+
+      for(std::size_t i = static_cast<std::size_t>(UINT8_C(0)); i < static_cast<std::size_t>(LimbCount / 2U); ++i)
+      {
+        str_stripes += "ffffffff00000000";
+      }
+
+      bool result_is_ok { true };
+
+      result_is_ok = (check(str_full,    str_full)    && result_is_ok);
+      result_is_ok = (check(str_full,    str_short)   && result_is_ok);
+      result_is_ok = (check(str_short,   str_full)    && result_is_ok);
+      result_is_ok = (check(str_full,    str_limb)    && result_is_ok);
+      result_is_ok = (check(str_ends,    str_full)    && result_is_ok);
+      result_is_ok = (check(str_ends,    str_ends)    && result_is_ok);
+      result_is_ok = (check(str_stripes, str_max)     && result_is_ok);
+      result_is_ok = (check(str_max,     str_stripes) && result_is_ok);
+      result_is_ok = (check(str_max,     str_max)     && result_is_ok);
+
+      return result_is_ok;
+    }
+  } // namespace detail
+
+  auto test_toom3_mul() -> bool;
+
+  auto test_toom3_mul() -> bool // LCOV_EXCL_LINE
+  {
+    // Use limb counts just below, at and just above the Toom-3 threshold.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::multiplication_traits;
+    using local_size_t = WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t;
+    #else
+    using ::math::wide_integer::multiplication_traits;
+    using local_size_t = ::math::wide_integer::size_t;
+    #endif
+
+    constexpr auto toom3_threshold = static_cast<std::size_t>(multiplication_traits<static_cast<local_size_t>(UINT16_C(8192)), std::uint32_t>::number_of_limbs_toom3_threshold);
+
+    bool result_is_ok { true };
+
+    result_is_ok = (detail::test_toom3_mul_of_limb_count<static_cast<std::size_t>(toom3_threshold - 8U)>() && result_is_ok);
+    result_is_ok = (detail::test_toom3_mul_of_limb_count<static_cast<std::size_t>(toom3_threshold + 0U)>() && result_is_ok);
+    result_is_ok = (detail::test_toom3_mul_of_limb_count<static_cast<std::size_t>(toom3_threshold + 8U)>() && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace toom3_multiplication
+
+namespace symmetric_squaring
+{
+  namespace detail
+  {
+    template<const std::size_t HexDigitCount>
+    auto test_one_square(const bool is_max) -> bool
+    {
+      // Check the squaring kernels (which are used for x * x, x *= x and square(x))
+      // against the square of Boost.Multiprecision. The width determines which
+      // of the schoolbook, Karatsuba and Toom-3 squarings are used.
+
+      #if defined(WIDE_INTEGER_NAMESPACE)
+      using local_limb_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uint_defaultlimb_t;
+      using local_size_t = WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t;
+      using wi_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<local_size_t>(HexDigitCount * 4U), local_limb_type, std::allocator<local_limb_type>>;
+      #else
+      using local_limb_type = ::math::wide_integer::uint_defaultlimb_t;
+      using local_size_t = ::math::wide_integer::size_t;
+      using wi_type = ::math::wide_integer::uintwide_t<static_cast<local_size_t>(HexDigitCount * 4U), local_limb_type, std::allocator<local_limb_type>>;
+      #endif
+
+      const std::string str_a { is_max ? std::string("0x" + std::string(HexDigitCount, 'f')) : generate_hex_string(HexDigitCount) };
+
+      const wi_type a_wi { str_a.c_str() };
+
+      const wi_type b_wi { a_wi * a_wi };
+      const wi_type c_wi { square(a_wi) };
+
+      wi_type d_wi { a_wi };
+
+      d_wi *= d_wi;
+
+      const boost::multiprecision::cpp_int a_cp { str_a };
+
+      const boost::multiprecision::cpp_int mask_cp { (boost::multiprecision::cpp_int(1) << static_cast<unsigned>(HexDigitCount * 4U)) - 1 };
+
+      const boost::multiprecision::cpp_int b_cp { (a_cp * a_cp) & mask_cp };
+
+      std::stringstream strm_b_wi { };
+      std::stringstream strm_b_cp { };
+
+      strm_b_wi << std::hex << b_wi;
+      strm_b_cp << std::hex << b_cp;
+
+      const bool result_is_ok { (strm_b_wi.str() == strm_b_cp.str()) && (c_wi == b_wi) && (d_wi == b_wi) };
+
+      return result_is_ok;
+    }
+  } // namespace detail
+
+  auto test_squaring() -> bool;
+
+  auto test_squaring() -> bool // LCOV_EXCL_LINE
+  {
+    bool result_is_ok { true };
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(8)); ++i)
+    {
+      const auto is_max = (i == static_cast<unsigned>(UINT8_C(0)));
+
+      result_is_ok = (detail::test_one_square<static_cast<std::size_t>(UINT32_C(   64))>(is_max) && result_is_ok);
+      result_is_ok = (detail::test_one_square<static_cast<std::size_t>(UINT32_C(  208))>(is_max) && result_is_ok);
+      result_is_ok = (detail::test_one_square<static_cast<std::size_t>(UINT32_C( 1024))>(is_max) && result_is_ok);
+      result_is_ok = (detail::test_one_square<static_cast<std::size_t>(UINT32_C(16384))>(is_max) && result_is_ok);
+    }
+
+    return result_is_ok;
+  }
+} // namespace symmetric_squaring
+
+namespace widening_multiplication
+{
+  namespace detail
+  {
+    template<const std::size_t HexDigitCount,
+             const bool IsSigned>
+    auto test_one_mul_wide(const bool is_max) -> bool
+    {
+      // Check mul_wide(a, b) against the product of a and b which have
+      // been promoted to the double-width type beforehand. The width
+      // determines which multiplication kernels are used.
+
+      #if defined(WIDE_INTEGER_NAMESPACE)
+      using local_limb_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uint_defaultlimb_t;
+      using local_size_t = WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t;
+      using wi_type  = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<local_size_t>(HexDigitCount * 4U), local_limb_type, std::allocator<local_limb_type>, IsSigned>;
+      using wi2_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<local_size_t>(HexDigitCount * 8U), local_limb_type, std::allocator<local_limb_type>, IsSigned>;
+      #else
+      using local_limb_type = ::math::wide_integer::uint_defaultlimb_t;
+      using local_size_t = ::math::wide_integer::size_t;
+      using wi_type  = ::math::wide_integer::uintwide_t<static_cast<local_size_t>(HexDigitCount * 4U), local_limb_type, std::allocator<local_limb_type>, IsSigned>;
+      using wi2_type = ::math::wide_integer::uintwide_t<static_cast<local_size_t>(HexDigitCount * 8U), local_limb_type, std::allocator<local_limb_type>, IsSigned>;
+      #endif
+
+      const std::string str_max { "0x" + std::string(HexDigitCount, 'f') };
+
+      const std::string str_a { is_max ? str_max : generate_hex_string(HexDigitCount) };
+      const std::string str_b { is_max ? str_max : generate_hex_string(HexDigitCount) };
+
+      // For signed types, the hex strings having their highest bit set
+      // are negative. Masking b with the maximum makes it non-negative,
+      // so that the mixed-sign product is also checked.
+      const wi_type a_wi { str_a.c_str() };
+      const wi_type b_wi { wi_type { str_b.c_str() } & (std::numeric_limits<wi_type>::max)() };
+
+      const wi2_type ab_wi { mul_wide(a_wi, b_wi) };
+      const wi2_type aa_wi { mul_wide(a_wi, a_wi) };
+
+      const wi2_type ab_ctrl { wi2_type(a_wi) * wi2_type(b_wi) };
+      const wi2_type aa_ctrl { wi2_type(a_wi) * wi2_type(a_wi) };
+
+      const bool result_is_ok { (ab_wi == ab_ctrl) && (aa_wi == aa_ctrl) };
+
+      return result_is_ok;
+    }
+  } // namespace detail
+
+  auto test_mul_wide() -> bool;
+
+  auto test_mul_wide() -> bool // LCOV_EXCL_LINE
+  {
+    bool result_is_ok { true };
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(8)); ++i)
+    {
+      const auto is_max = (i == static_cast<unsigned>(UINT8_C(0)));
+
+      result_is_ok = (detail::test_one_mul_wide<static_cast<std::size_t>(UINT32_C(  64)), false>(is_max) && result_is_ok);
+      result_is_ok = (detail::test_one_mul_wide<static_cast<std::size_t>(UINT32_C(  64)), true >(is_max) && result_is_ok);
+      result_is_ok = (detail::test_one_mul_wide<static_cast<std::size_t>(UINT32_C( 512)), false>(is_max) && result_is_ok);
+      result_is_ok = (detail::test_one_mul_wide<static_cast<std::size_t>(UINT32_C(1024)), true >(is_max) && result_is_ok);
+    }
+
+    return result_is_ok;
+  }
+} // namespace widening_multiplication
+
+namespace barrett_reduction
+{
+  namespace detail
+  {
+    template<const std::size_t HexDigitCount,
+             typename LimbType>
+    auto test_one_barrett(const std::size_t modulus_hex_digits, const bool is_power_of_two) -> bool
+    {
+      // Check the Barrett reduction against the division for a modulus
+      // having the given number of hex digits, being either random or
+      // a power of two. Reduce products of residues (being less than m^2),
+      // as well as double-width values of any size (using the division
+      // fallback). Then check powm of the reducer against powm.
+
+      #if defined(WIDE_INTEGER_NAMESPACE)
+      using local_size_t = WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t;
+      using wi_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<local_size_t>(HexDigitCount * 4U), LimbType>;
+      using barrett_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::barrett_reducer<static_cast<local_size_t>(HexDigitCount * 4U), LimbType>;
+      #else
+      using local_size_t = ::math::wide_integer::size_t;
+      using wi_type = ::math::wide_integer::uintwide_t<static_cast<local_size_t>(HexDigitCount * 4U), LimbType>;
+      using barrett_type = ::math::wide_integer::barrett_reducer<static_cast<local_size_t>(HexDigitCount * 4U), LimbType>;
+      #endif
+
+      using wi2_type = typename wi_type::double_width_type;
+
+      wi_type m { generate_hex_string(modulus_hex_digits).c_str() };
+
+      if(is_power_of_two)
+      {
+        m = wi_type(static_cast<std::uint8_t>(UINT8_C(1))) << static_cast<unsigned>(static_cast<unsigned>(modulus_hex_digits * 4U) - 1U);
+      }
+
+      const barrett_type reducer(m);
+
+      bool result_is_ok { true };
+
+      for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(16)); ++i)
+      {
+        const wi_type a { wi_type(generate_hex_string(HexDigitCount).c_str()) % m };
+        const wi_type b { wi_type(generate_hex_string(HexDigitCount).c_str()) % m };
+
+        const wi2_type ab { mul_wide(a, b) };
+        const wi2_type x  { generate_hex_string(static_cast<std::size_t>(HexDigitCount * 2U)).c_str() };
+
+        result_is_ok = ((reducer.reduce(ab) == wi_type(ab % wi2_type(m))) && result_is_ok);
+        result_is_ok = ((reducer.reduce(x)  == wi_type(x  % wi2_type(m))) && result_is_ok);
+        result_is_ok = ((reducer.sqr_mod(a) == reducer.mul_mod(a, a))     && result_is_ok);
+      }
+
+      // Obtain the control value of powm with binary exponentiation,
+      // using the division in the double width.
+      const wi_type b { generate_hex_string(HexDigitCount).c_str() };
+      const auto    p { static_cast<std::uint32_t>(eng_dig()()) };
+
+      wi2_type ctrl { wi2_type(static_cast<std::uint8_t>(UINT8_C(1))) % wi2_type(m) };
+
+      for(auto bit = static_cast<int>(INT8_C(31)); bit >= static_cast<int>(INT8_C(0)); --bit)
+      {
+        ctrl = (ctrl * ctrl) % wi2_type(m);
+
+        if((static_cast<std::uint32_t>(p >> static_cast<unsigned>(bit)) & UINT32_C(1)) != UINT32_C(0))
+        {
+          ctrl = (ctrl * wi2_type(b)) % wi2_type(m);
+        }
+      }
+
+      result_is_ok = ((reducer.powm(b, p) == wi_type(ctrl)) && result_is_ok);
+
+      return result_is_ok;
+    }
+  } // namespace detail
+
+  auto test_barrett() -> bool;
+
+  auto test_barrett() -> bool // LCOV_EXCL_LINE
+  {
+    bool result_is_ok { true };
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(8)); ++i)
+    {
+      const auto is_power_of_two = (i == static_cast<unsigned>(UINT8_C(0)));
+
+      const auto digits_small = static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(1)) + static_cast<std::size_t>(dist_dig_hex()(eng_dig()) * 4U));
+      const auto digits_large = static_cast<std::size_t>(static_cast<std::size_t>(UINT8_C(256)) - static_cast<std::size_t>(dist_dig_hex()(eng_dig()) * 16U));
+
+      result_is_ok = (detail::test_one_barrett<static_cast<std::size_t>(UINT32_C( 64)), std::uint32_t>(digits_small, is_power_of_two) && result_is_ok);
+      result_is_ok = (detail::test_one_barrett<static_cast<std::size_t>(UINT32_C( 64)), std::uint32_t>(static_cast<std::size_t>(UINT8_C(64)), is_power_of_two) && result_is_ok);
+      result_is_ok = (detail::test_one_barrett<static_cast<std::size_t>(UINT32_C( 16)), std::uint8_t >(digits_small % 16U + 1U, is_power_of_two) && result_is_ok);
+      result_is_ok = (detail::test_one_barrett<static_cast<std::size_t>(UINT32_C(256)), std::uint32_t>(digits_large, is_power_of_two) && result_is_ok);
+    }
+
+    return result_is_ok;
+  }
+} // namespace barrett_reduction
+
+namespace constant_time_powers
+{
+  auto test_powm_ct_moduli() -> bool;
+
+  auto test_powm_ct_moduli() -> bool // LCOV_EXCL_LINE
+  {
+    // Check powm_ct against powm for an odd modulus. Even moduli
+    // (including zero) and negative moduli are rejected with zero.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::int256_t;
+    #else
+    using ::math::wide_integer::uint256_t;
+    using ::math::wide_integer::int256_t;
+    #endif
+
+    const uint256_t m_odd  { "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141" };
+    const uint256_t m_even { m_odd - 1U };
+
+    uint256_t b { "0x6F73D8E95D6DDBF0EB352A9F0B2CE91931511EDAF9AC8F128D5A4F877C4F0450" };
+    uint256_t p { "0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8" };
+
+    bool result_is_ok { true };
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(8)); ++i)
+    {
+      b = (b * b) + i;
+      p = (p * p) + i;
+
+      result_is_ok = ((powm_ct(b, p, m_odd) == powm(b, p, m_odd)) && result_is_ok);
+
+      result_is_ok = ((powm_ct(b, p, m_even)           == 0U) && result_is_ok);
+      result_is_ok = ((powm_ct(b, p, uint256_t { 0U }) == 0U) && result_is_ok);
+      result_is_ok = ((powm_ct(b, p, uint256_t { 1U }) == 0U) && result_is_ok);
+
+      result_is_ok = ((powm_ct(int256_t { 3 }, 65537U, int256_t { -7 }) == 0) && result_is_ok);
+    }
+
+    return result_is_ok;
+  }
+
+  auto test_ct_primitives() -> bool;
+
+  auto test_ct_primitives() -> bool // LCOV_EXCL_LINE
+  {
+    // Check the windowed powm_ct and the ladder powm_ladder_ct of the
+    // Montgomery context against powm, including the exponents 0 and 1
+    // and the bases 0 and m - 1. Then check the branch-free helpers
+    // is_equal_ct, conditional_select and conditional_subtract.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::montgomery_context;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::unsigned_fast_type;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::detail::is_equal_ct;
+    #else
+    using ::math::wide_integer::uint256_t;
+    using ::math::wide_integer::montgomery_context;
+    using ::math::wide_integer::unsigned_fast_type;
+    using ::math::wide_integer::detail::is_equal_ct;
+    #endif
+
+    using local_montgomery_type = montgomery_context<std::numeric_limits<uint256_t>::digits, typename uint256_t::limb_type>;
+
+    const uint256_t m { "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F" };
+
+    const local_montgomery_type ctx(m);
+
+    bool result_is_ok { true };
+
+    uint256_t x { "0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798" };
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(4)); ++i)
+    {
+      x = (x * x) + i;
+
+      for(const auto& b : { uint256_t { 0U }, uint256_t { 1U }, uint256_t { m - 1U }, uint256_t { x % m } })
+      {
+        for(const auto& p : { uint256_t { 0U }, uint256_t { 1U }, uint256_t { 2U }, uint256_t { m - 2U }, x })
+        {
+          const uint256_t ctrl { powm(b, p, m) };
+
+          result_is_ok = ((ctx.powm_ct       (b, p) == ctrl) && result_is_ok);
+          result_is_ok = ((ctx.powm_ladder_ct(b, p) == ctrl) && result_is_ok);
+        }
+
+        // Built-in exponents are scanned over all of their digits as well.
+        result_is_ok = ((ctx.powm_ct       (b, static_cast<std::uint32_t>(UINT8_C(0))) == powm(b, 0U, m)) && result_is_ok);
+        result_is_ok = ((ctx.powm_ladder_ct(b, static_cast<std::uint32_t>(UINT8_C(1))) == powm(b, 1U, m)) && result_is_ok);
+        result_is_ok = ((ctx.powm_ladder_ct(b, static_cast<std::uint32_t>(i + 65537U)) == powm(b, static_cast<std::uint32_t>(i + 65537U), m)) && result_is_ok);
+      }
+    }
+
+    constexpr auto fast_max = (std::numeric_limits<unsigned_fast_type>::max)();
+    constexpr auto fast_top = static_cast<unsigned_fast_type>(static_cast<unsigned_fast_type>(fast_max >> 1U) + 1U);
+
+    result_is_ok = ( is_equal_ct(0U,       0U)       && result_is_ok);
+    result_is_ok = ( is_equal_ct(fast_max, fast_max) && result_is_ok);
+    result_is_ok = ((!is_equal_ct(0U,       1U))       && result_is_ok);
+    result_is_ok = ((!is_equal_ct(fast_max, 0U))       && result_is_ok);
+    result_is_ok = ((!is_equal_ct(fast_top, 0U))       && result_is_ok);
+    result_is_ok = ((!is_equal_ct(15U,      14U))      && result_is_ok);
+
+    const uint256_t a { x % m };
+    const uint256_t c { m };
+
+    uint256_t u { a };
+
+    u.conditional_select(c, false); result_is_ok = ((u == a) && result_is_ok);
+    u.conditional_select(c, true);  result_is_ok = ((u == c) && result_is_ok);
+
+    // Subtracting a larger value borrows out of the top limb and wraps.
+    u = a; result_is_ok = ((u.conditional_subtract(c, false) == 0U) && (u == a)       && result_is_ok);
+    u = c; result_is_ok = ((u.conditional_subtract(a, true)  == 0U) && (u == (c - a)) && result_is_ok);
+    u = a; result_is_ok = ((u.conditional_subtract(u, true)  == 0U) && (u == 0U)      && result_is_ok);
+
+    u = uint256_t { 1U };
+
+    result_is_ok = ((u.conditional_subtract(c, true) == 1U) && (u == (uint256_t { 1U } - c)) && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace constant_time_powers
+
+namespace recursive_division
+{
+  namespace detail
+  {
+    template<const std::size_t HexDigitCount,
+             typename AllocatorType>
+    auto test_one_division(const std::size_t divisor_hex_digits) -> bool
+    {
+      // Check the division and the modulus against those of Boost.Multiprecision.
+      // Both the divisor and the quotient are long enough for the recursive
+      // Burnikel-Ziegler division to be used.
+
+      #if defined(WIDE_INTEGER_NAMESPACE)
+      using local_size_t = WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t;
+      using wi_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<local_size_t>(HexDigitCount * 4U), std::uint32_t, AllocatorType>;
+      #else
+      using local_size_t = ::math::wide_integer::size_t;
+      using wi_type = ::math::wide_integer::uintwide_t<static_cast<local_size_t>(HexDigitCount * 4U), std::uint32_t, AllocatorType>;
+      #endif
+
+      const std::string str_u { generate_hex_string(HexDigitCount) };
+      const std::string str_v { generate_hex_string(divisor_hex_digits) };
+
+      const wi_type u_wi { str_u.c_str() };
+      const wi_type v_wi { str_v.c_str() };
+
+      const wi_type q_wi { u_wi / v_wi };
+      const wi_type r_wi { u_wi % v_wi };
+
+      const boost::multiprecision::cpp_int u_cp { str_u };
+      const boost::multiprecision::cpp_int v_cp { str_v };
+
+      std::stringstream strm_q_wi { };
+      std::stringstream strm_r_wi { };
+      std::stringstream strm_q_cp { };
+      std::stringstream strm_r_cp { };
+
+      strm_q_wi << std::hex << q_wi;
+      strm_r_wi << std::hex << r_wi;
+      strm_q_cp << std::hex << boost::multiprecision::cpp_int(u_cp / v_cp);
+      strm_r_cp << std::hex << boost::multiprecision::cpp_int(u_cp % v_cp);
+
+      const bool result_is_ok { (strm_q_wi.str() == strm_q_cp.str()) && (strm_r_wi.str() == strm_r_cp.str()) };
+
+      return result_is_ok;
+    }
+  } // namespace detail
+
+  auto test_division() -> bool;
+
+  auto test_division() -> bool // LCOV_EXCL_LINE
+  {
+    bool result_is_ok { true };
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(8)); ++i)
+    {
+      const auto offset = static_cast<std::size_t>(static_cast<std::size_t>(dist_dig_hex()(eng_dig())) * 256U);
+
+      result_is_ok = (detail::test_one_division<static_cast<std::size_t>(UINT32_C(12288)), std::allocator<void>>(static_cast<std::size_t>(static_cast<std::size_t>(UINT32_C(4096)) + offset)) && result_is_ok);
+      result_is_ok = (detail::test_one_division<static_cast<std::size_t>(UINT32_C(16384)), void                >(static_cast<std::size_t>(static_cast<std::size_t>(UINT32_C(6000)) + offset)) && result_is_ok);
+    }
+
+    return result_is_ok;
+  }
+} // namespace recursive_division
+
+namespace reciprocal_division
+{
+  namespace detail
+  {
+    template<const std::size_t HexDigitCount,
+             typename LimbType>
+    auto test_one_limb_divisor(const LimbType d) -> bool
+    {
+      // Divide by the same limb repeatedly with limb_divisor and
+      // check the quotients and remainders against those of Boost.
+
+      #if defined(WIDE_INTEGER_NAMESPACE)
+      using local_size_t = WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t;
+      using wi_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<local_size_t>(HexDigitCount * 4U), LimbType>;
+      using divisor_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::limb_divisor<LimbType>;
+      #else
+      using local_size_t = ::math::wide_integer::size_t;
+      using wi_type = ::math::wide_integer::uintwide_t<static_cast<local_size_t>(HexDigitCount * 4U), LimbType>;
+      using divisor_type = ::math::wide_integer::limb_divisor<LimbType>;
+      #endif
+
+      const divisor_type divisor { d };
+
+      bool result_is_ok { divisor.divisor() == d };
+
+      for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(4)); ++i)
+      {
+        const std::string str_u { generate_hex_string(HexDigitCount) };
+
+        wi_type u_wi { str_u.c_str() };
+
+        const boost::multiprecision::cpp_int u_cp { str_u };
+
+        const auto r_only = divisor.remainder(u_wi);
+        const auto r_wi   = divisor.divide(u_wi);
+
+        std::stringstream strm_q_wi { };
+        std::stringstream strm_q_cp { };
+
+        strm_q_wi << std::hex << u_wi;
+        strm_q_cp << std::hex << boost::multiprecision::cpp_int(u_cp / d);
+
+        const auto r_cp = static_cast<LimbType>(u_cp % d);
+
+        result_is_ok = ((strm_q_wi.str() == strm_q_cp.str()) && (r_wi == r_cp) && (r_only == r_cp) && result_is_ok);
+      }
+
+      return result_is_ok;
+    }
+
+    template<const std::size_t HexDigitCount,
+             typename LimbType>
+    auto test_limb_divisors() -> bool
+    {
+      constexpr auto limb_max = (std::numeric_limits<LimbType>::max)();
+      constexpr auto limb_top = static_cast<LimbType>(static_cast<LimbType>(limb_max >> 1U) + 1U);
+
+      bool result_is_ok { true };
+
+      // Check divisors at the edges of normalization.
+      result_is_ok = (test_one_limb_divisor<HexDigitCount>(static_cast<LimbType>(UINT8_C(1)))                     && result_is_ok);
+      result_is_ok = (test_one_limb_divisor<HexDigitCount>(static_cast<LimbType>(UINT8_C(10)))                    && result_is_ok);
+      result_is_ok = (test_one_limb_divisor<HexDigitCount>(limb_max)                                              && result_is_ok);
+      result_is_ok = (test_one_limb_divisor<HexDigitCount>(limb_top)                                              && result_is_ok);
+      result_is_ok = (test_one_limb_divisor<HexDigitCount>(static_cast<LimbType>(limb_top + 1U))                  && result_is_ok);
+      result_is_ok = (test_one_limb_divisor<HexDigitCount>(static_cast<LimbType>(limb_top - 1U))                  && result_is_ok);
+
+      for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(8)); ++i)
+      {
+        const auto d = static_cast<LimbType>(static_cast<LimbType>(eng_dig()()) >> static_cast<unsigned>(eng_dig()() % static_cast<unsigned>(std::numeric_limits<LimbType>::digits)));
+
+        result_is_ok = (test_one_limb_divisor<HexDigitCount>(static_cast<LimbType>(d | static_cast<LimbType>(UINT8_C(1)))) && result_is_ok);
+      }
+
+      return result_is_ok;
+    }
+  } // namespace detail
+
+  auto test_limb_divisor() -> bool;
+
+  auto test_limb_divisor() -> bool // LCOV_EXCL_LINE
+  {
+    bool result_is_ok { true };
+
+    result_is_ok = (detail::test_limb_divisors<static_cast<std::size_t>(UINT8_C( 64)), std::uint8_t >() && result_is_ok);
+    result_is_ok = (detail::test_limb_divisors<static_cast<std::size_t>(UINT8_C( 64)), std::uint16_t>() && result_is_ok);
+    result_is_ok = (detail::test_limb_divisors<static_cast<std::size_t>(UINT8_C(128)), std::uint32_t>() && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace reciprocal_division
+
+namespace constant_division
+{
+  namespace detail
+  {
+    template<const std::uintmax_t Divisor,
+             typename WideIntegerType>
+    auto test_one_constant(const WideIntegerType& x) -> bool
+    {
+      #if defined(WIDE_INTEGER_NAMESPACE)
+      using WIDE_INTEGER_NAMESPACE::math::wide_integer::div_by_constant;
+      using WIDE_INTEGER_NAMESPACE::math::wide_integer::mod_by_constant;
+      #else
+      using ::math::wide_integer::div_by_constant;
+      using ::math::wide_integer::mod_by_constant;
+      #endif
+
+      const bool result_div_is_ok { div_by_constant<Divisor>(x) == (x / WideIntegerType(Divisor)) };
+      const bool result_mod_is_ok { mod_by_constant<Divisor>(x) == (x % WideIntegerType(Divisor)) };
+
+      return (result_div_is_ok && result_mod_is_ok);
+    }
+
+    template<typename WideIntegerType>
+    auto test_constants() -> bool
+    {
+      bool result_is_ok { true };
+
+      for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(16)); ++i)
+      {
+        WideIntegerType x { };
+
+        for(auto& limb : x.representation())
+        {
+          limb = static_cast<typename WideIntegerType::limb_type>(eng_dig()());
+        }
+
+        // Vary the magnitude of x, and also let some of the signed values be negative.
+        x >>= static_cast<unsigned>(eng_dig()() % static_cast<unsigned>(std::numeric_limits<WideIntegerType>::digits));
+
+        if((i % 4U) == 0U) { x = -x; }
+
+        result_is_ok = (test_one_constant<UINT8_C(1)>(x)                   && result_is_ok);
+        result_is_ok = (test_one_constant<UINT8_C(3)>(x)                   && result_is_ok);
+        result_is_ok = (test_one_constant<UINT8_C(10)>(x)                  && result_is_ok);
+        result_is_ok = (test_one_constant<UINT8_C(255)>(x)                 && result_is_ok);
+        result_is_ok = (test_one_constant<UINT16_C(1000)>(x)               && result_is_ok);
+        result_is_ok = (test_one_constant<UINT32_C(1000000000)>(x)         && result_is_ok);
+        result_is_ok = (test_one_constant<UINT32_C(4294967295)>(x)         && result_is_ok);
+        result_is_ok = (test_one_constant<UINT64_C(10000000000000000000)>(x) && result_is_ok);
+      }
+
+      return result_is_ok;
+    }
+  } // namespace detail
+
+  auto test_div_mod_by_constant() -> bool;
+
+  auto test_div_mod_by_constant() -> bool // LCOV_EXCL_LINE
+  {
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using local_uint256_u8_type  = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(UINT32_C(256)), std::uint8_t>;
+    using local_int512_u32_type  = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(UINT32_C(512)), std::uint32_t, void, true>;
+    using local_uint1024_type    = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(UINT32_C(1024))>;
+    #else
+    using local_uint256_u8_type  = ::math::wide_integer::uintwide_t<static_cast<::math::wide_integer::size_t>(UINT32_C(256)), std::uint8_t>;
+    using local_int512_u32_type  = ::math::wide_integer::uintwide_t<static_cast<::math::wide_integer::size_t>(UINT32_C(512)), std::uint32_t, void, true>;
+    using local_uint1024_type    = ::math::wide_integer::uintwide_t<static_cast<::math::wide_integer::size_t>(UINT32_C(1024))>;
+    #endif
+
+    bool result_is_ok { true };
+
+    result_is_ok = (detail::test_constants<local_uint256_u8_type>() && result_is_ok);
+    result_is_ok = (detail::test_constants<local_int512_u32_type>() && result_is_ok);
+    result_is_ok = (detail::test_constants<local_uint1024_type>  () && result_is_ok);
+
+    return result_is_ok;
+  }
+
+  auto test_narrow_miller_rabin() -> bool;
+
+  auto test_narrow_miller_rabin() -> bool // LCOV_EXCL_LINE
+  {
+    // The products of the small primes that miller_rabin divides by
+    // do not fit in types narrower than 32 bits. Check primes of 24
+    // and of 16 bits, and a constant divisor beyond the range of the type.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::div_by_constant;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::miller_rabin;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::mod_by_constant;
+
+    using local_uint24_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(UINT32_C(24)), std::uint8_t>;
+    using local_uint16_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t>(UINT32_C(16)), std::uint8_t>;
+
+    using local_distribution24_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uniform_int_distribution<local_uint24_type::my_width2, std::uint8_t, void>;
+    using local_distribution16_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uniform_int_distribution<local_uint16_type::my_width2, std::uint8_t, void>;
+    #else
+    using ::math::wide_integer::div_by_constant;
+    using ::math::wide_integer::miller_rabin;
+    using ::math::wide_integer::mod_by_constant;
+
+    using local_uint24_type = ::math::wide_integer::uintwide_t<static_cast<::math::wide_integer::size_t>(UINT32_C(24)), std::uint8_t>;
+    using local_uint16_type = ::math::wide_integer::uintwide_t<static_cast<::math::wide_integer::size_t>(UINT32_C(16)), std::uint8_t>;
+
+    using local_distribution24_type = ::math::wide_integer::uniform_int_distribution<local_uint24_type::my_width2, std::uint8_t, void>;
+    using local_distribution16_type = ::math::wide_integer::uniform_int_distribution<local_uint16_type::my_width2, std::uint8_t, void>;
+    #endif
+
+    using random_engine_type = std::minstd_rand;
+
+    random_engine_type generator(util::util_pseudorandom_time_point_seed::value<typename random_engine_type::result_type>());
+
+    local_distribution24_type distribution24;
+    local_distribution16_type distribution16;
+
+    bool result_is_ok { true };
+
+    // 16777213 = 2^24 - 3 and 65521 = 2^16 - 15 are prime,
+    // 16777211 = 2^24 - 5 and 65517 = 3 * 21839 are not.
+    result_is_ok = (   miller_rabin(local_uint24_type(UINT32_C(16777213)), 25U, distribution24, generator)  && result_is_ok);
+    result_is_ok = ((!miller_rabin(local_uint24_type(UINT32_C(16777211)), 25U, distribution24, generator)) && result_is_ok);
+    result_is_ok = (   miller_rabin(local_uint16_type(UINT16_C(65521)),    25U, distribution16, generator)  && result_is_ok);
+    result_is_ok = ((!miller_rabin(local_uint16_type(UINT16_C(65517)),    25U, distribution16, generator)) && result_is_ok);
+
+    const local_uint24_type x24 { UINT32_C(16777213) };
+
+    result_is_ok = ((div_by_constant<UINT32_C(3234846615)>(x24) == static_cast<unsigned>(UINT8_C(0))) && result_is_ok);
+    result_is_ok = ((mod_by_constant<UINT32_C(3234846615)>(x24) == x24)                              && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace constant_division
+
+namespace lehmer_gcd
+{
+  namespace detail
+  {
+    template<const std::size_t HexDigitCount,
+             typename LimbType>
+    auto test_one_gcd(const std::size_t factor_hex_digits) -> bool
+    {
+      // Check gcd and lcm against those of Boost.Multiprecision. The
+      // operands share a common factor and are wide enough for the
+      // Lehmer steps to be used.
+
+      #if defined(WIDE_INTEGER_NAMESPACE)
+      using local_size_t = WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t;
+      using wi_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<local_size_t>(HexDigitCount * 4U), LimbType>;
+      #else
+      using local_size_t = ::math::wide_integer::size_t;
+      using wi_type = ::math::wide_integer::uintwide_t<static_cast<local_size_t>(HexDigitCount * 4U), LimbType>;
+      #endif
+
+      const auto cofactor_hex_digits = static_cast<std::size_t>((HexDigitCount - factor_hex_digits) / 2U);
+
+      const std::string str_g { generate_hex_string(factor_hex_digits) };
+      const std::string str_u { generate_hex_string(cofactor_hex_digits) };
+      const std::string str_v { generate_hex_string(cofactor_hex_digits) };
+
+      const wi_type u_wi { wi_type { str_u.c_str() } * wi_type { str_g.c_str() } };
+      const wi_type v_wi { wi_type { str_v.c_str() } * wi_type { str_g.c_str() } };
+
+      const boost::multiprecision::cpp_int u_cp { boost::multiprecision::cpp_int { str_u } * boost::multiprecision::cpp_int { str_g } };
+      const boost::multiprecision::cpp_int v_cp { boost::multiprecision::cpp_int { str_v } * boost::multiprecision::cpp_int { str_g } };
+
+      std::stringstream strm_gcd_wi { };
+      std::stringstream strm_lcm_wi { };
+      std::stringstream strm_gcd_cp { };
+      std::stringstream strm_lcm_cp { };
+
+      strm_gcd_wi << std::hex << gcd(u_wi, v_wi);
+      strm_lcm_wi << std::hex << lcm(wi_type { str_u.c_str() }, wi_type { str_v.c_str() });
+      strm_gcd_cp << std::hex << boost::multiprecision::cpp_int(boost::multiprecision::gcd(u_cp, v_cp));
+      strm_lcm_cp << std::hex << boost::multiprecision::cpp_int(boost::multiprecision::lcm(boost::multiprecision::cpp_int { str_u }, boost::multiprecision::cpp_int { str_v }));
+
+      const bool result_is_ok { (strm_gcd_wi.str() == strm_gcd_cp.str()) && (strm_lcm_wi.str() == strm_lcm_cp.str()) };
+
+      return result_is_ok;
+    }
+  } // namespace detail
+
+  auto test_gcd() -> bool;
+
+  auto test_gcd() -> bool // LCOV_EXCL_LINE
+  {
+    bool result_is_ok { true };
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(16)); ++i)
+    {
+      const auto factor_hex_digits = static_cast<std::size_t>(static_cast<std::size_t>(dist_dig_hex()(eng_dig())) * 8U + 1U);
+
+      result_is_ok = (detail::test_one_gcd<static_cast<std::size_t>(UINT32_C( 128)), std::uint8_t >(factor_hex_digits)                   && result_is_ok);
+      result_is_ok = (detail::test_one_gcd<static_cast<std::size_t>(UINT32_C( 256)), std::uint16_t>(factor_hex_digits)                   && result_is_ok);
+      result_is_ok = (detail::test_one_gcd<static_cast<std::size_t>(UINT32_C(1024)), std::uint32_t>(factor_hex_digits * 4U)              && result_is_ok);
+    }
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using local_size_t = WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t;
+    using wi_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<local_size_t>(UINT32_C(2048)), std::uint32_t>;
+    #else
+    using local_size_t = ::math::wide_integer::size_t;
+    using wi_type = ::math::wide_integer::uintwide_t<static_cast<local_size_t>(UINT32_C(2048)), std::uint32_t>;
+    #endif
+
+    // Consecutive Fibonacci numbers have all quotients equal to one.
+    wi_type f0 { 1U };
+    wi_type f1 { 1U };
+
+    while(msb(f1) < static_cast<unsigned>(UINT16_C(2040)))
+    {
+      wi_type f2 { f0 + f1 };
+
+      f0 = std::move(f1);
+      f1 = std::move(f2);
+    }
+
+    result_is_ok = ((gcd(f0, f1) == 1U) && result_is_ok);
+    result_is_ok = ((gcd(f0 * 24U, f1 * 24U) == 24U) && result_is_ok);
+    result_is_ok = ((gcd(f1, f1 + f1) == f1) && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace lehmer_gcd
+
+namespace modular_inverse
+{
+  namespace detail
+  {
+    template<const std::size_t HexDigitCount,
+             typename LimbType,
+             const bool IsSigned>
+    auto test_one_extended_gcd() -> bool
+    {
+      // Check the Bezout identity s * a + t * b = gcd(a, b) and the
+      // modular inverses with Boost.Multiprecision.
+
+      #if defined(WIDE_INTEGER_NAMESPACE)
+      using local_size_t = WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t;
+      using wi_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t<static_cast<local_size_t>(HexDigitCount * 4U), LimbType, void, IsSigned>;
+      #else
+      using local_size_t = ::math::wide_integer::size_t;
+      using wi_type = ::math::wide_integer::uintwide_t<static_cast<local_size_t>(HexDigitCount * 4U), LimbType, void, IsSigned>;
+      #endif
+
+      const auto to_cpp_int =
+        [](const auto& x) // NOLINT(modernize-use-trailing-return-type,-warnings-as-errors)
+        {
+          std::stringstream strm { };
+
+          strm << x;
+
+          return boost::multiprecision::cpp_int { strm.str() };
+        };
+
+      // Keep the operands below 2^(width - 1) for the signed type.
+      const auto digits_a = static_cast<std::size_t>(static_cast<std::size_t>(HexDigitCount - 1U) - static_cast<std::size_t>(dist_dig_hex()(eng_dig())));
+      const auto digits_b = static_cast<std::size_t>(static_cast<std::size_t>(HexDigitCount - 1U) - static_cast<std::size_t>(dist_dig_hex()(eng_dig())));
+
+      const wi_type a { generate_hex_string(digits_a).c_str() };
+      const wi_type b { generate_hex_string(digits_b).c_str() };
+
+      bool result_is_ok { true };
+
+      {
+        const auto r = extended_gcd(a, b);
+
+        const boost::multiprecision::cpp_int a_cp { to_cpp_int(a) };
+        const boost::multiprecision::cpp_int b_cp { to_cpp_int(b) };
+        const boost::multiprecision::cpp_int g_cp { boost::multiprecision::gcd(a_cp, b_cp) };
+
+        result_is_ok = ((to_cpp_int(r.g) == g_cp) && result_is_ok);
+        result_is_ok = ((((to_cpp_int(r.s) * a_cp) + (to_cpp_int(r.t) * b_cp)) == g_cp) && result_is_ok);
+      }
+
+      if(IsSigned)
+      {
+        const auto r = extended_gcd(wi_type(-a), b);
+
+        result_is_ok = ((((to_cpp_int(r.s) * to_cpp_int(wi_type(-a))) + (to_cpp_int(r.t) * to_cpp_int(b))) == to_cpp_int(r.g)) && result_is_ok);
+      }
+      else
+      {
+        // Use an odd modulus, such that the constant-time inverse applies.
+        const wi_type m { b | 1U };
+
+        const wi_type a_mod_m { a % m };
+
+        const wi_type x    { invmod   (a_mod_m, m) };
+        const wi_type x_ct { invmod_ct(a_mod_m, m) };
+
+        const boost::multiprecision::cpp_int m_cp { to_cpp_int(m) };
+
+        const bool a_is_invertible { boost::multiprecision::gcd(to_cpp_int(a_mod_m), m_cp) == 1 };
+
+        result_is_ok = ((x == x_ct) && result_is_ok);
+
+        result_is_ok = ((a_is_invertible ? (((to_cpp_int(x) * to_cpp_int(a_mod_m)) % m_cp) == 1) : (x == 0U)) && result_is_ok);
+      }
+
+      return result_is_ok;
+    }
+  } // namespace detail
+
+  auto test_extended_gcd() -> bool;
+
+  auto test_extended_gcd() -> bool // LCOV_EXCL_LINE
+  {
+    bool result_is_ok { true };
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(64)); ++i)
+    {
+      result_is_ok = (detail::test_one_extended_gcd<static_cast<std::size_t>(UINT32_C( 64)), std::uint8_t,  false>() && result_is_ok);
+      result_is_ok = (detail::test_one_extended_gcd<static_cast<std::size_t>(UINT32_C(128)), std::uint16_t, true >() && result_is_ok);
+      result_is_ok = (detail::test_one_extended_gcd<static_cast<std::size_t>(UINT32_C(512)), std::uint32_t, false>() && result_is_ok);
+    }
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
+    #else
+    using ::math::wide_integer::uint256_t;
+    #endif
+
+    // The inverse of 3 modulo the prime 2^255 - 19 is (2 * p + 1) / 3.
+    const uint256_t p { "0x7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFED" };
+
+    const uint256_t three_inv { ((p * 2U) + 1U) / 3U };
+
+    result_is_ok = ((invmod   (uint256_t { 3U }, p) == three_inv) && result_is_ok);
+    result_is_ok = ((invmod_ct(uint256_t { 3U }, p) == three_inv) && result_is_ok);
+
+    // There is no inverse if the GCD differs from one.
+    result_is_ok = ((invmod(uint256_t { 6U }, uint256_t { 9U }) == 0U) && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace modular_inverse
+
+namespace batch_inversion
+{
+  auto test_batch_invmod() -> bool;
+
+  auto test_batch_invmod() -> bool // LCOV_EXCL_LINE
+  {
+    // Check batch_invmod against invmod of the individual elements,
+    // with separate output, in place and with a non-invertible element.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
+    #else
+    using ::math::wide_integer::uint256_t;
+    #endif
+
+    // The modulus is the prime 2^255 - 19.
+    const uint256_t p { "0x7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFED" };
+
+    std::vector<uint256_t> a      (static_cast<std::size_t>(UINT8_C(33)));
+    std::vector<uint256_t> out    (a.size());
+    std::vector<uint256_t> scratch(a.size());
+    std::vector<uint256_t> ref    (a.size());
+
+    for(auto i = static_cast<std::size_t>(UINT8_C(0)); i < a.size(); ++i)
+    {
+      a[i] = (uint256_t { static_cast<unsigned>(i + 1U) } * uint256_t { "0x1234567890ABCDEF1234567890ABCDEF" }) % p;
+
+      ref[i] = invmod(a[i], p);
+    }
+
+    bool result_is_ok { true };
+
+    result_is_ok = (batch_invmod(a.cbegin(), a.cend(), p, out.begin()) && result_is_ok);
+    result_is_ok = ((out == ref) && result_is_ok);
+
+    std::vector<uint256_t> b(a);
+
+    result_is_ok = (batch_invmod(b.begin(), b.end(), p, b.begin(), scratch.begin()) && result_is_ok);
+    result_is_ok = ((b == ref) && result_is_ok);
+
+    // The element 6 has no inverse modulo 9. Each element is then
+    // inverted on its own, and the non-invertible one is set to zero.
+    const uint256_t m { 9U };
+
+    std::vector<uint256_t> c { uint256_t { 2U }, uint256_t { 6U }, uint256_t { 4U } };
+
+    result_is_ok = ((!batch_invmod(c.begin(), c.end(), m, c.begin(), scratch.begin())) && result_is_ok);
+    result_is_ok = (((c[0U] == 5U) && (c[1U] == 0U) && (c[2U] == 7U)) && result_is_ok);
+
+    // An empty range has nothing to invert.
+    result_is_ok = (batch_invmod(a.cbegin(), a.cbegin(), p, out.begin()) && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace batch_inversion
+
+namespace fixed_base_powers
+{
+  auto test_fixed_base_table() -> bool;
+
+  auto test_fixed_base_table() -> bool // LCOV_EXCL_LINE
+  {
+    // Check powm with fixed-base tables against powm, for an odd
+    // (Montgomery) and an even (Barrett) modulus. The exponents
+    // include zero, one and exponents wider than the table.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::montgomery_context;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::barrett_reducer;
+    #else
+    using ::math::wide_integer::uint256_t;
+    using ::math::wide_integer::montgomery_context;
+    using ::math::wide_integer::barrett_reducer;
+    #endif
+
+    using local_montgomery_type = montgomery_context<std::numeric_limits<uint256_t>::digits, typename uint256_t::limb_type>;
+    using local_barrett_type    = barrett_reducer   <std::numeric_limits<uint256_t>::digits, typename uint256_t::limb_type>;
+
+    const uint256_t m_odd  { "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F" };
+    const uint256_t m_even { "0x8000000000000000000000000000000000000000000000000000000000000002" };
+
+    const uint256_t g { "0x79BE667EF9DCBBAC55A06295CE870B07029BFCDB2DCE28D959F2815B16F81798" };
+
+    const local_montgomery_type ctx(m_odd);
+    const local_barrett_type    brt(m_even);
+
+    const auto table_mont_4 = ctx.make_fixed_base_table<static_cast<unsigned>(UINT16_C(256))>(g);
+    const auto table_mont_1 = ctx.make_fixed_base_table<static_cast<unsigned>(UINT8_C(64)), static_cast<unsigned>(UINT8_C(1))>(g);
+    const auto table_brt_5  = brt.make_fixed_base_table<static_cast<unsigned>(UINT8_C(100)), static_cast<unsigned>(UINT8_C(5))>(g);
+
+    bool result_is_ok { true };
+
+    uint256_t p { "0x483ADA7726A3C4655DA4FBFC0E1108A8FD17B448A68554199C47D08FFB10D4B8" };
+
+    for(auto i = static_cast<unsigned>(UINT8_C(0)); i < static_cast<unsigned>(UINT8_C(16)); ++i)
+    {
+      p = ((i < 2U) ? uint256_t { i } : uint256_t { (p * p) + i });
+
+      result_is_ok = ((ctx.powm(table_mont_4, p) == powm(g, p, m_odd )) && result_is_ok);
+      result_is_ok = ((ctx.powm(table_mont_1, p) == powm(g, p, m_odd )) && result_is_ok);
+      result_is_ok = ((brt.powm(table_brt_5,  p) == powm(g, p, m_even)) && result_is_ok);
+    }
+
+    // Built-in exponents work as well.
+    result_is_ok = ((ctx.powm(table_mont_4, 65537U) == powm(g, 65537U, m_odd)) && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace fixed_base_powers
+
+namespace multi_exponentiation
+{
+  auto test_multi_powm() -> bool;
+
+  auto test_multi_powm() -> bool // LCOV_EXCL_LINE
+  {
+    // Check multi_powm against the product of the individual powers,
+    // for odd and even moduli and for more terms than are combined
+    // in one chain of squarings.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
+    #else
+    using ::math::wide_integer::uint256_t;
+    #endif
+
+    using local_double_type = typename uint256_t::double_width_type;
+
+    using local_term_type = std::pair<uint256_t, uint256_t>;
+
+    const uint256_t m_odd  { "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141" };
+    const uint256_t m_even { "0x7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEE" };
+
+    std::vector<local_term_type> terms { };
+
+    uint256_t x { "0x6F73D8E95D6DDBF0EB352A9F0B2CE91931511EDAF9AC8F128D5A4F877C4F0450" };
+
+    bool result_is_ok { true };
+
+    for(auto n = static_cast<unsigned>(UINT8_C(0)); n < static_cast<unsigned>(UINT8_C(11)); ++n)
+    {
+      for(const auto& m : { m_odd, m_even })
+      {
+        uint256_t product { static_cast<unsigned>(UINT8_C(1)) };
+
+        for(const auto& term : terms)
+        {
+          product = uint256_t((local_double_type(product) * local_double_type(powm(term.first, term.second, m))) % local_double_type(m));
+        }
+
+        result_is_ok = ((multi_powm(terms.cbegin(), terms.cend(), m) == product) && result_is_ok);
+      }
+
+      // Add a term with a pseudo-random base and exponent of varying length.
+      x = (x * x) + n;
+
+      terms.emplace_back(x, ((n == 3U) ? uint256_t { } : (x >> static_cast<unsigned>(n * 23U))));
+    }
+
+    const uint256_t g { 3U };
+    const uint256_t h { 5U };
+
+    result_is_ok = ((multi_powm({ std::make_pair(g, 1000U), std::make_pair(h, 77U) }, m_odd) == uint256_t((local_double_type(powm(g, 1000U, m_odd)) * local_double_type(powm(h, 77U, m_odd))) % local_double_type(m_odd))) && result_is_ok);
+
+    return result_is_ok;
+  }
+} // namespace multi_exponentiation
+
+namespace special_moduli
+{
+  auto test_special_modulus() -> bool;
+
+  auto test_special_modulus() -> bool // LCOV_EXCL_LINE
+  {
+    // Check the folding of special_modulus against the division
+    // for pseudo-Mersenne primes and for a modulus that does not
+    // have the special shape.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::special_modulus;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::barrett_reducer;
+    using local_size_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t;
+    #else
+    using ::math::wide_integer::uint256_t;
+    using ::math::wide_integer::uintwide_t;
+    using ::math::wide_integer::special_modulus;
+    using ::math::wide_integer::barrett_reducer;
+    using local_size_type = ::math::wide_integer::size_t;
+    #endif
+
+    using local_uint576_t = uintwide_t<static_cast<local_size_type>(UINT16_C(576)), std::uint32_t>;
+
+    bool result_is_ok { true };
+
+    const auto check =
+      [&result_is_ok](const auto& m, const bool is_special, auto x) // NOLINT(performance-unnecessary-value-param)
+      {
+        using local_uint_type   = std::decay_t<decltype(m)>;
+        using local_double_type = typename local_uint_type::double_width_type;
+        using local_limb_type   = typename local_uint_type::limb_type;
+
+        constexpr auto width = static_cast<local_size_type>(std::numeric_limits<local_uint_type>::digits);
+
+        const special_modulus<width, local_limb_type> sm(m);
+
+        result_is_ok = ((sm.is_special() == is_special) && result_is_ok);
+
+        for(auto n = static_cast<unsigned>(UINT8_C(0)); n < static_cast<unsigned>(UINT8_C(32)); ++n)
+        {
+          const local_uint_type a { x % m };
+
+          x = (x * x) + n;
+
+          const local_uint_type b { ((n == 0U) ? local_uint_type(m - 1U) : local_uint_type(x % m)) };
+
+          result_is_ok = ((sm.mul_mod(a, b) == local_uint_type((local_double_type(a) * local_double_type(b)) % local_double_type(m))) && result_is_ok);
+          result_is_ok = ((sm.sqr_mod(b)    == local_uint_type((local_double_type(b) * local_double_type(b)) % local_double_type(m))) && result_is_ok);
+
+          const local_double_type y { (local_double_type(x) << static_cast<unsigned>(width)) | local_double_type(a) };
+
+          result_is_ok = ((sm.reduce(y) == local_uint_type(y % local_double_type(m))) && result_is_ok);
+        }
+
+        // The free function powm picks the folding for the pseudo-Mersenne primes.
+        const auto p_pow = powm(x, m - 2U, m);
+
+        result_is_ok = ((p_pow == barrett_reducer<width, local_limb_type>(m).powm(x, m - 2U)) && result_is_ok);
+        result_is_ok = ((p_pow == sm.powm(x, m - 2U)) && result_is_ok);
+      };
+
+    // The primes 2^256 - 2^32 - 977 (secp256k1), 2^255 - 19 and 2^521 - 1,
+    // and the prime of P-256, which is not of pseudo-Mersenne shape.
+    check(uint256_t { "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F" }, true,  uint256_t { "0x6F73D8E95D6DDBF0EB352A9F0B2CE91931511EDAF9AC8F128D5A4F877C4F0450" });
+    check(uint256_t { "0x7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFED" }, true,  uint256_t { "0x1FA8C3E7B5D04267390AF1C6E8D2B4574C9F3E0A1D6B8C2F5E7A9B0C3D4E5F61" });
+    check(uint256_t { "0xFFFFFFFF00000001000000000000000000000000FFFFFFFFFFFFFFFFFFFFFFFF" }, false, uint256_t { "0x6F73D8E95D6DDBF0EB352A9F0B2CE91931511EDAF9AC8F128D5A4F877C4F0450" });
+
+    // The modulus 2^256 - 2^100 - 1 has the special shape, but its offset
+    // is too wide for powm, which uses one of the other reductions.
+    check(uint256_t { "0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFFFFFFFFFFFFFFFFFFFFF" }, true, uint256_t { "0x1FA8C3E7B5D04267390AF1C6E8D2B4574C9F3E0A1D6B8C2F5E7A9B0C3D4E5F61" });
+
+    check((local_uint576_t(1U) << 521U) - 1U, true, local_uint576_t { "0x6F73D8E95D6DDBF0EB352A9F0B2CE91931511EDAF9AC8F128D5A4F877C4F0450" } << 200U);
+
+    return result_is_ok;
+  }
+} // namespace special_moduli
+
+namespace sliding_window
+{
+  auto test_window_bits() -> bool;
+
+  auto test_window_bits() -> bool // LCOV_EXCL_LINE
+  {
+    // Check pow and powm with each window width k = 1...6 against
+    // the automatically chosen width and against cpp_int, for odd,
+    // even and pseudo-Mersenne moduli.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::to_string;
+    #else
+    using ::math::wide_integer::uint256_t;
+    using ::math::wide_integer::to_string;
+    #endif
+
+    using local_cpp_int_type = boost::multiprecision::cpp_int;
+
+    const local_cpp_int_type two_pow_256 { local_cpp_int_type(1) << 256U };
+
+    bool result_is_ok { true };
+
+    for(auto n = static_cast<unsigned>(UINT8_C(0)); n < static_cast<unsigned>(UINT8_C(4)); ++n)
+    {
+      const std::string str_b { generate_hex_string(static_cast<std::size_t>(UINT8_C(64))) };
+      const std::string str_p { generate_hex_string(static_cast<std::size_t>(static_cast<unsigned>(UINT8_C(8)) + static_cast<unsigned>(n * 18U))) };
+
+      const uint256_t b { str_b.c_str() };
+      const uint256_t p { str_p.c_str() };
+
+      const local_cpp_int_type b_cp { str_b };
+      const local_cpp_int_type p_cp { str_p };
+
+      const uint256_t m_odd     { uint256_t(generate_hex_string(static_cast<std::size_t>(UINT8_C(64))).c_str()) | 1U };
+      const uint256_t m_even    { uint256_t(generate_hex_string(static_cast<std::size_t>(UINT8_C(62))).c_str()) << 1U };
+      const uint256_t m_special { (uint256_t { 1U } << 255U) - 19U };
+
+      const uint256_t pow_default { pow(b, p) };
+
+      result_is_ok = ((pow_default == uint256_t(local_cpp_int_type(boost::multiprecision::powm(b_cp, p_cp, two_pow_256)).str().c_str())) && result_is_ok);
+
+      for(auto k = static_cast<std::uint_fast8_t>(UINT8_C(1)); k <= static_cast<std::uint_fast8_t>(UINT8_C(6)); ++k)
+      {
+        result_is_ok = ((pow(b, p, k) == pow_default) && result_is_ok);
+      }
+
+      for(const auto& m : { m_odd, m_even, m_special })
+      {
+        const uint256_t powm_default { powm(b, p, m) };
+
+        const local_cpp_int_type m_cp { to_string(m) };
+
+        result_is_ok = ((powm_default == uint256_t(local_cpp_int_type(boost::multiprecision::powm(b_cp, p_cp, m_cp)).str().c_str())) && result_is_ok);
+
+        for(auto k = static_cast<std::uint_fast8_t>(UINT8_C(1)); k <= static_cast<std::uint_fast8_t>(UINT8_C(6)); ++k)
+        {
+          result_is_ok = ((powm(b, p, m, k) == powm_default) && result_is_ok);
+        }
+      }
+    }
+
+    return result_is_ok;
+  }
+} // namespace sliding_window
+
+namespace scratch_arenas
+{
+  auto allocation_count() -> std::size_t&;
+
+  auto allocation_count() -> std::size_t&
+  {
+    static std::size_t my_count { };
+
+    return my_count;
+  }
+
+  // An allocator that counts its allocations, giving the leases
+  // of this test a scratch arena of their own.
+  template<typename T>
+  class counting_allocator
+  {
+  public:
+    using value_type = T;
+
+    counting_allocator() noexcept = default;
+
+    template<typename U>
+    counting_allocator(const counting_allocator<U>&) noexcept { } // NOLINT(google-explicit-constructor,hicpp-explicit-conversions)
+
+    auto allocate(const std::size_t count) -> T*
+    {
+      ++allocation_count();
+
+      return std::allocator<T>().allocate(count);
+    }
+
+    auto deallocate(T* p, const std::size_t count) -> void
+    {
+      std::allocator<T>().deallocate(p, count);
+    }
+  };
+
+  template<typename T, typename U> auto operator==(const counting_allocator<T>&, const counting_allocator<U>&) -> bool { return true; }
+  template<typename T, typename U> auto operator!=(const counting_allocator<T>&, const counting_allocator<U>&) -> bool { return false; }
+
+  #if defined(WIDE_INTEGER_NAMESPACE)
+  template<const WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t MySize>
+  using scratch_lease_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::detail::scratch_lease<std::uint32_t, MySize, counting_allocator<std::uint32_t>>;
+  #else
+  template<const ::math::wide_integer::size_t MySize>
+  using scratch_lease_type = ::math::wide_integer::detail::scratch_lease<std::uint32_t, MySize, counting_allocator<std::uint32_t>>;
+  #endif
+
+  auto test_nested_leases() -> bool;
+
+  auto test_nested_leases() -> bool // LCOV_EXCL_LINE
+  {
+    // Nest leases deeper than the capacity of the arena. The inner
+    // leases then allocate their own storage. Each time the arena is
+    // idle, it grows to the largest total that it was asked for, so that
+    // the nest is soon served without any further allocations.
+
+    bool result_is_ok { true };
+
+    const auto is_filled_with =
+      [](const auto& lease, const std::uint32_t value)
+      {
+        return std::all_of(lease.cbegin(), lease.cend(), [&value](const std::uint32_t& limb) { return (limb == value); });
+      };
+
+    const auto is_disjoint =
+      [](const auto& lease_a, const auto& lease_b)
+      {
+        return ((lease_a.cend() <= lease_b.cbegin()) || (lease_b.cend() <= lease_a.cbegin()));
+      };
+
+    allocation_count() = static_cast<std::size_t>(UINT8_C(0));
+
+    for(auto n = static_cast<unsigned>(UINT8_C(0)); n < static_cast<unsigned>(UINT8_C(4)); ++n)
+    {
+      scratch_lease_type<16U> a { };
+
+      result_is_ok = (is_filled_with(a, 0U) && result_is_ok);
+
+      std::fill(a.begin(), a.end(), 1U);
+
+      {
+        scratch_lease_type<32U> b { };
+
+        result_is_ok = (is_filled_with(b, 0U) && result_is_ok);
+
+        std::fill(b.begin(), b.end(), 2U);
+
+        {
+          scratch_lease_type<8U> c { };
+
+          result_is_ok = (is_filled_with(c, 0U) && result_is_ok);
+
+          std::fill(c.begin(), c.end(), 3U);
+
+          result_is_ok = ((is_disjoint(a, c) && is_disjoint(b, c)) && result_is_ok);
+        }
+
+        result_is_ok = ((is_filled_with(a, 1U) && is_filled_with(b, 2U) && is_disjoint(a, b)) && result_is_ok);
+
+        #if !defined(WIDE_INTEGER_DISABLE_SCRATCH_ARENA)
+        // After the arena has grown, the nest is laid out in stack order.
+        result_is_ok = (((n == 0U) || (b.cbegin() == a.cend())) && result_is_ok);
+        #endif
+      }
+
+      // With the arena, the first nest allocates the buffer for a, and b
+      // and c allocate their own storage. The second nest grows the buffer
+      // to hold a and b, and c allocates. The third nest grows the buffer
+      // to hold all three. Without the arena, each lease allocates.
+      #if !defined(WIDE_INTEGER_DISABLE_SCRATCH_ARENA)
+      constexpr std::array<std::size_t, static_cast<std::size_t>(UINT8_C(4))> counts_expected { 3U, 5U, 6U, 6U };
+
+      const auto count_expected = counts_expected[static_cast<std::size_t>(n)];
+      #else
+      const auto count_expected = static_cast<std::size_t>(static_cast<std::size_t>(n + 1U) * 3U);
+      #endif
+
+      result_is_ok = ((allocation_count() == count_expected) && result_is_ok);
+    }
+
+    return result_is_ok;
+  }
+
+  template<typename WideIntegerType>
+  auto to_hex_string(const WideIntegerType& u) -> std::string
+  {
+    std::stringstream strm { };
+
+    strm << std::hex << u;
+
+    return strm.str();
+  }
+
+  auto test_concurrent_mul() -> bool;
+
+  auto test_concurrent_mul() -> bool // LCOV_EXCL_LINE
+  {
+    // Multiply and divide with an allocator-backed type, which leases its
+    // temporaries from the scratch arena, in two threads at the same time.
+    // The results must match those of the same type with a void allocator,
+    // which uses no arena. The test is run with and without
+    // WIDE_INTEGER_DISABLE_SCRATCH_ARENA in the CI.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uintwide_t;
+    using local_size_type = WIDE_INTEGER_NAMESPACE::math::wide_integer::size_t;
+    #else
+    using ::math::wide_integer::uintwide_t;
+    using local_size_type = ::math::wide_integer::size_t;
+    #endif
+
+    using local_uint_type = uintwide_t<static_cast<local_size_type>(UINT32_C(8192)), std::uint32_t, std::allocator<void>>;
+    using local_void_type = uintwide_t<static_cast<local_size_type>(UINT32_C(8192)), std::uint32_t>;
+
+    constexpr auto pair_count = static_cast<std::size_t>(UINT8_C(8));
+
+    std::vector<std::string> str_a(pair_count);
+    std::vector<std::string> str_b(pair_count);
+    std::vector<std::string> str_p(pair_count);
+    std::vector<std::string> str_q(pair_count);
+
+    for(std::size_t i = static_cast<std::size_t>(UINT8_C(0)); i < pair_count; ++i)
+    {
+      str_a[i] = generate_hex_string(static_cast<std::size_t>(static_cast<std::size_t>(UINT16_C(2048)) - static_cast<std::size_t>(i * 97U)));
+      str_b[i] = generate_hex_string(static_cast<std::size_t>(static_cast<std::size_t>(UINT16_C(1024)) - static_cast<std::size_t>(i * 61U)));
+
+      const local_void_type a { str_a[i].c_str() };
+      const local_void_type b { str_b[i].c_str() };
+
+      str_p[i] = to_hex_string(a * b);
+      str_q[i] = to_hex_string(a / b) + to_hex_string(a % b);
+    }
+
+    const auto run =
+      [&str_a, &str_b, &str_p, &str_q](char* p_result_is_ok)
+      {
+        bool result_is_ok { true };
+
+        for(auto n = static_cast<unsigned>(UINT8_C(0)); n < static_cast<unsigned>(UINT8_C(4)); ++n)
+        {
+          for(std::size_t i = static_cast<std::size_t>(UINT8_C(0)); i < str_a.size(); ++i)
+          {
+            const local_uint_type a { str_a[i].c_str() };
+            const local_uint_type b { str_b[i].c_str() };
+
+            result_is_ok = ((to_hex_string(a * b) == str_p[i])                       && result_is_ok);
+            result_is_ok = (((to_hex_string(a / b) + to_hex_string(a % b)) == str_q[i]) && result_is_ok);
+          }
+        }
+
+        *p_result_is_ok = static_cast<char>(result_is_ok);
+      };
+
+    std::array<char, static_cast<std::size_t>(UINT8_C(2))> results_are_ok { };
+
+    std::thread thread_0(run, &results_are_ok[static_cast<std::size_t>(UINT8_C(0))]);
+    std::thread thread_1(run, &results_are_ok[static_cast<std::size_t>(UINT8_C(1))]);
+
+    thread_0.join();
+    thread_1.join();
+
+    return ((results_are_ok[static_cast<std::size_t>(UINT8_C(0))] != static_cast<char>(0)) && (results_are_ok[static_cast<std::size_t>(UINT8_C(1))] != static_cast<char>(0)));
+  }
+} // namespace scratch_arenas
+
+namespace string_constants
+{
+  constexpr char str_p25519[] = "0x7FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFED"; // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+  constexpr char str_dec_m1[] = "-12345678901234567890123456789";                                    // NOLINT(cppcoreguidelines-avoid-c-arrays,hicpp-avoid-c-arrays,modernize-avoid-c-arrays)
+
+  auto test_from_string_constant() -> bool;
+
+  auto test_from_string_constant() -> bool // LCOV_EXCL_LINE
+  {
+    // Check that from_string_constant is a constant expression
+    // and that it matches the construction at run time.
+
+    #if defined(WIDE_INTEGER_NAMESPACE)
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::uint256_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::int256_t;
+    using WIDE_INTEGER_NAMESPACE::math::wide_integer::from_string_constant;
+    #else
+    using ::math::wide_integer::uint256_t;
+    using ::math::wide_integer::int256_t;
+    using ::math::wide_integer::from_string_constant;
+    #endif
+
+    using p25519_constant_type = from_string_constant<uint256_t, str_p25519>; // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+    using dec_m1_constant_type = from_string_constant<int256_t, str_dec_m1>;  // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+
+    static_assert(p25519_constant_type::value == ((uint256_t { 1U } << 255U) - 19U), "Error: Wrong value of the string constant");
+    static_assert(dec_m1_constant_type::value < 0, "Error: Wrong sign of the string constant");
+
+    bool result_is_ok { true };
+
+    result_is_ok = ((p25519_constant_type::value == uint256_t { str_p25519 }) && result_is_ok); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+    result_is_ok = ((dec_m1_constant_type::value == int256_t { str_dec_m1 })  && result_is_ok); // NOLINT(cppcoreguidelines-pro-bounds-array-to-pointer-decay,hicpp-no-array-decay)
+
+    return result_is_ok;
+  }
+} // namespace string_constants
+
 } // namespace test_uintwide_t_edge
 
 // LCOV_EXCL_START
@@ -2951,7 +4910,31 @@ auto ::math::wide_integer::test_uintwide_t_edge_cases() -> bool
   result_is_ok = (test_uintwide_t_edge::test_export_bits                             () && result_is_ok);
   result_is_ok = (test_uintwide_t_edge::test_edge_uintwide_t_backend                 () && result_is_ok);
   result_is_ok = (test_uintwide_t_edge::from_pr_454::test_proj_specific_containers   () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::decimal_output::test_dec_output              () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::decimal_input::test_dec_input                () && result_is_ok);
   result_is_ok = (test_uintwide_t_edge::karatsuba_squaring::test_kara_squaring       () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::ntt_multiplication::test_ntt_mul             () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::ntt_multiplication::test_ntt_mul_void_alloc  () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::toom3_multiplication::test_toom3_mul         () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::symmetric_squaring::test_squaring            () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::widening_multiplication::test_mul_wide       () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::barrett_reduction::test_barrett              () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::constant_time_powers::test_powm_ct_moduli    () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::constant_time_powers::test_ct_primitives     () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::recursive_division::test_division            () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::reciprocal_division::test_limb_divisor       () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::constant_division::test_div_mod_by_constant  () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::constant_division::test_narrow_miller_rabin  () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::lehmer_gcd::test_gcd                         () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::modular_inverse::test_extended_gcd           () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::batch_inversion::test_batch_invmod           () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::fixed_base_powers::test_fixed_base_table     () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::multi_exponentiation::test_multi_powm        () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::special_moduli::test_special_modulus         () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::sliding_window::test_window_bits             () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::scratch_arenas::test_nested_leases           () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::scratch_arenas::test_concurrent_mul          () && result_is_ok);
+  result_is_ok = (test_uintwide_t_edge::string_constants::test_from_string_constant  () && result_is_ok);
 
   return result_is_ok;
 }
@@ -32,6 +32,7 @@ auto ::math::wide_integer::test_uintwide_t_examples() -> bool
   result_is_ok = (math::wide_integer::example004_rootk_pow                 () && result_is_ok); std::cout << "result_is_ok after example004_rootk_pow               : " << std::boolalpha << result_is_ok << std::endl;
   result_is_ok = (math::wide_integer::example005_powm                      () && result_is_ok); std::cout << "result_is_ok after example005_powm                    : " << std::boolalpha << result_is_ok << std::endl;
   result_is_ok = (math::wide_integer::example005a_pow_factors_of_p99       () && result_is_ok); std::cout << "result_is_ok after example005a_pow_factors_of_p99     : " << std::boolalpha << result_is_ok << std::endl;
+  result_is_ok = (math::wide_integer::example005b_powm_ct_timing           () && result_is_ok); std::cout << "result_is_ok after example005b_powm_ct_timing         : " << std::boolalpha << result_is_ok << std::endl;
   result_is_ok = (math::wide_integer::example006_gcd                       () && result_is_ok); std::cout << "result_is_ok after example006_gcd                     : " << std::boolalpha << result_is_ok << std::endl;
   result_is_ok = (math::wide_integer::example007_random_generator          () && result_is_ok); std::cout << "result_is_ok after example007_random_generator        : " << std::boolalpha << result_is_ok << std::endl;
   result_is_ok = (math::wide_integer::example008_miller_rabin_prime        () && result_is_ok); std::cout << "result_is_ok after example008_miller_rabin_prime      : " << std::boolalpha << result_is_ok << std::endl;
@@ -40,6 +41,8 @@ auto ::math::wide_integer::test_uintwide_t_examples() -> bool
   result_is_ok = (math::wide_integer::example009_timed_mul                 () && result_is_ok); std::cout << "result_is_ok after example009_timed_mul               : " << std::boolalpha << result_is_ok << std::endl;
   result_is_ok = (math::wide_integer::example009a_timed_mul_4_by_4         () && result_is_ok); std::cout << "result_is_ok after example009a_timed_mul_4_by_4       : " << std::boolalpha << result_is_ok << std::endl;
   result_is_ok = (math::wide_integer::example009b_timed_mul_8_by_8         () && result_is_ok); std::cout << "result_is_ok after example009b_timed_mul_8_by_8       : " << std::boolalpha << result_is_ok << std::endl;
+  result_is_ok = (math::wide_integer::example009c_timed_mul_calibrate      () && result_is_ok); std::cout << "result_is_ok after example009c_timed_mul_calibrate    : " << std::boolalpha << result_is_ok << std::endl;
+  result_is_ok = (math::wide_integer::example009d_timed_sqr                () && result_is_ok); std::cout << "result_is_ok after example009d_timed_sqr              : " << std::boolalpha << result_is_ok << std::endl;
   result_is_ok = (math::wide_integer::example010_uint48_t                  () && result_is_ok); std::cout << "result_is_ok after example010_uint48_t                : " << std::boolalpha << result_is_ok << std::endl;
   result_is_ok = (math::wide_integer::example011_uint24_t                  () && result_is_ok); std::cout << "result_is_ok after example011_uint24_t                : " << std::boolalpha << result_is_ok << std::endl;
   #if !(defined(WIDE_INTEGER_MSVC) && defined(_DEBUG))
@@ -47,6 +50,7 @@ auto ::math::wide_integer::test_uintwide_t_examples() -> bool
   #endif
   result_is_ok = (math::wide_integer::example013_ecdsa_sign_verify         () && result_is_ok); std::cout << "result_is_ok after example013_ecdsa_sign_verify       : " << std::boolalpha << result_is_ok << std::endl;
   result_is_ok = (math::wide_integer::example014_pi_spigot_wide            () && result_is_ok); std::cout << "result_is_ok after example014_pi_spigot_wide          : " << std::boolalpha << result_is_ok << std::endl;
+  result_is_ok = (math::wide_integer::example015_x25519_key_exchange       () && result_is_ok); std::cout << "result_is_ok after example015_x25519_key_exchange     : " << std::boolalpha << result_is_ok << std::endl;
 
   std::cout.flags(flg);
 
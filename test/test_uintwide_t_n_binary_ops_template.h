@@ -15,6 +15,7 @@
   #include <atomic>
   #include <cstddef>
   #include <random>
+  #include <type_traits>
   #include <vector>
 
   #if defined(WIDE_INTEGER_NAMESPACE)
@@ -110,6 +111,9 @@
 
         std::cout << "test_binary_sqrt() boost compare with uintwide_t: round " << i << ",  digits2: " << this->get_digits2() << std::endl;
         result_is_ok = (test_binary_sqrt() && result_is_ok);
+
+        std::cout << "test_binary_powm() boost compare with uintwide_t: round " << i << ",  digits2: " << this->get_digits2() << std::endl;
+        result_is_ok = (test_binary_powm() && result_is_ok);
       }
 
       return result_is_ok;
@@ -291,6 +295,66 @@
       return result_is_ok;
     }
 
+    WIDE_INTEGER_NODISCARD auto test_binary_powm() const -> bool
+    {
+      std::atomic_flag test_lock = ATOMIC_FLAG_INIT;
+
+      my_gen().seed(util::util_pseudorandom_time_point_seed::value<typename random_generator_type::result_type>());
+      std::uniform_int_distribution<> dis(1, static_cast<int>(digits2 - 1U));
+
+      bool result_is_ok = true;
+
+      // Limit the count and the exponent width, since powm is expensive
+      // for the wide types. Both odd moduli (using Montgomery multiplication)
+      // and even moduli (using division) are exercised.
+      const auto exponent_shift = static_cast<std::size_t>(digits2 - (std::min)(digits2, static_cast<std::remove_cv_t<decltype(digits2)>>(UINT8_C(32))));
+
+      my_concurrency::parallel_for
+      (
+        static_cast<std::size_t>(0U),
+        (std::min)(size(), static_cast<std::size_t>(UINT8_C(64))),
+        [&result_is_ok, this, &dis, &test_lock, &exponent_shift](std::size_t i)
+        {
+          while(test_lock.test_and_set()) { ; }
+          const auto right_shift_amount = static_cast<std::size_t>(dis(my_gen()));
+          test_lock.clear();
+
+          // The control value is computed with the unbounded boost::multiprecision::cpp_int,
+          // since powm of the fixed-width boost type can overflow internally at large widths.
+          using boost_uint_unbounded_type = boost::multiprecision::cpp_int;
+
+          const boost_uint_type c_boost =
+            boost_uint_type
+            (
+              powm(boost_uint_unbounded_type(b_boost[i]),
+                   boost_uint_unbounded_type(a_boost[i] >> exponent_shift),
+                   boost_uint_unbounded_type((std::max)(boost_uint_type(1U), boost_uint_type(b_boost[i] >> right_shift_amount))))
+            );
+
+          const local_uint_type m_local = (std::max)(local_uint_type(1U), (b_local[i] >> right_shift_amount));
+
+          const local_uint_type c_local = powm(b_local[i],                (a_local[i] >> exponent_shift), m_local);
+
+          // For odd moduli, also check the constant-time powm_ct
+          // with the (at most 32-bit) exponent in a built-in type.
+          const bool ct_is_ok =
+            (
+                 (static_cast<std::uint32_t>(m_local & 1U) == static_cast<std::uint32_t>(UINT8_C(0)))
+              || (powm_ct(b_local[i], static_cast<std::uint32_t>(a_local[i] >> exponent_shift), m_local) == c_local)
+            );
+
+          const std::string str_boost = hexlexical_cast(c_boost);
+          const std::string str_local = hexlexical_cast(c_local);
+
+          while(test_lock.test_and_set()) { ; }
+          result_is_ok = ((str_boost == str_local) && ct_is_ok && result_is_ok);
+          test_lock.clear();
+        }
+      );
+
+      return result_is_ok;
+    }
+
   private:
     std::vector<local_uint_type> a_local { }; // NOLINT(readability-identifier-naming)
     std::vector<local_uint_type> b_local { }; // NOLINT(readability-identifier-naming)